@@ -651,6 +651,13 @@ macro(hpx_check_for_cxx17_fallthrough_attribute)
     FILE ${ARGN})
 endmacro()
 
+###############################################################################
+macro(hpx_check_for_cxx17_aligned_new)
+  add_hpx_config_test(HPX_WITH_CXX17_ALIGNED_NEW
+    SOURCE cmake/tests/cxx17_aligned_new.cpp
+    FILE ${ARGN})
+endmacro()
+
 ###############################################################################
 macro(hpx_check_for_mm_prefetch)
   add_hpx_config_test(HPX_WITH_MM_PREFETCH
@@ -195,5 +195,8 @@ macro(hpx_perform_cxx_feature_tests)
 
     hpx_check_for_cxx17_fallthrough_attribute(
       DEFINITIONS HPX_HAVE_CXX17_FALLTHROUGH_ATTRIBUTE)
+
+    hpx_check_for_cxx17_aligned_new(
+      DEFINITIONS HPX_HAVE_CXX17_ALIGNED_NEW)
   endif()
 endmacro()
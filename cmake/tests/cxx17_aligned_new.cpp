@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <new>
+
+struct alignas(2 * alignof(std::max_align_t)) overaligned
+{
+    static void* operator new(std::size_t size, std::align_val_t align)
+    {
+        return ::operator new(size, align);
+    }
+    static void operator delete(void* p, std::align_val_t align)
+    {
+        ::operator delete(p, align);
+    }
+
+    char c;
+};
+
+int main()
+{
+    delete new overaligned;
+    return 0;
+}
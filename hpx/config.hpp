@@ -458,6 +458,9 @@
 #  define HPX_HUGE_STACK_SIZE     0x2000000       // 32MByte
 #endif
 
+// Stackless threads don't allocate a stack, this value marks their stack size
+#define HPX_NOSTACK_STACK_SIZE    0x7fffffff
+
 ///////////////////////////////////////////////////////////////////////////////
 // This limits how deep the internal recursion of future continuations will go
 // before a new operation is re-spawned.
@@ -479,6 +482,16 @@
 #endif
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// This limits how many of the continuations attached to the same future are
+// run directly once the future becomes ready. All remaining continuations are
+// handed to the scheduler at once, each of them running on a new thread. Only
+// the continuations run directly are guaranteed to execute in the order they
+// were attached, the others may run concurrently with or ahead of them.
+#if !defined(HPX_CONTINUATION_MAX_INLINE_CALLBACKS)
+#define HPX_CONTINUATION_MAX_INLINE_CALLBACKS 4
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Make sure we have support for more than 64 threads for Xeon Phi
 #if defined(__MIC__) && !defined(HPX_HAVE_MORE_THAN_64_THREADS)
@@ -8,6 +8,7 @@
 #define HPX_PARALLEL_MISMATCH_JUL_13_2014_0820PM
 
 #include <hpx/parallel/algorithms/mismatch.hpp>
+#include <hpx/parallel/segmented_algorithms/mismatch.hpp>
 
 #endif
 
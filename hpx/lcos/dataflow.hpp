@@ -13,10 +13,12 @@
 #include <hpx/apply.hpp>
 #include <hpx/lcos/detail/future_transforms.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/cancellation_token.hpp>
 #include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/traits/acquire_future.hpp>
 #include <hpx/traits/extract_action.hpp>
+#include <hpx/traits/is_cancellable_executor.hpp>
 #include <hpx/traits/future_access.hpp>
 #include <hpx/traits/is_action.hpp>
 #include <hpx/traits/is_executor.hpp>
@@ -176,6 +178,23 @@ namespace hpx { namespace lcos { namespace detail
             }
         }
 
+        /// Sets the result future to a cancellation error instead of
+        /// invoking the evaluation function if the token was cancelled
+        /// before the scheduled task started running.
+        void execute_cancellable(
+            lcos::local::cancellation_token const& token, Futures&& futures)
+        {
+            if (token.is_cancelled())
+            {
+                this->set_exception(
+                    lcos::local::cancellation_token::get_exception(
+                        "hpx::dataflow"));
+                return;
+            }
+
+            execute(is_void{}, std::move(futures));
+        }
+
         HPX_FORCEINLINE void done(Futures futures)
         {
             hpx::util::annotate_function annotate(func_);
@@ -252,9 +271,10 @@ namespace hpx { namespace lcos { namespace detail
         template <typename Executor>
         HPX_FORCEINLINE
         typename std::enable_if<
-            traits::is_one_way_executor<Executor>::value ||
-            traits::is_two_way_executor<Executor>::value ||
-            traits::is_threads_executor<Executor>::value
+            (traits::is_one_way_executor<Executor>::value ||
+                traits::is_two_way_executor<Executor>::value ||
+                traits::is_threads_executor<Executor>::value) &&
+            !traits::is_cancellable_executor<Executor>::value
         >::type
         finalize(Executor&& exec, Futures&& futures)
         {
@@ -272,6 +292,22 @@ namespace hpx { namespace lcos { namespace detail
                 f, std::move(this_), is_void{}, std::move(futures));
         }
 
+        // Executors carrying a cancellation token: the task is scheduled on
+        // the wrapped executor, the frame itself checks the token to be able
+        // to report the cancellation through the result future.
+        template <typename Executor>
+        HPX_FORCEINLINE
+        typename std::enable_if<
+            traits::is_cancellable_executor<Executor>::value
+        >::type
+        finalize(Executor&& exec, Futures&& futures)
+        {
+            boost::intrusive_ptr<dataflow_frame> this_(this);
+            parallel::execution::post(exec.base_executor(),
+                &dataflow_frame::execute_cancellable, std::move(this_),
+                exec.get_cancellation_token(), std::move(futures));
+        }
+
     public:
         /// Check whether the current future is ready
         template <typename T>
@@ -23,6 +23,8 @@
 #include <hpx/util/atomic_count.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/decay.hpp>
+#include <hpx/util/slab_allocator.hpp>
+#include <hpx/util/small_vector.hpp>
 #include <hpx/util/steady_clock.hpp>
 #include <hpx/util/unique_function.hpp>
 #include <hpx/util/unused.hpp>
@@ -34,6 +36,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -86,6 +89,42 @@ namespace detail
             delete this;
         }
 
+#if defined(HPX_HAVE_SHARED_STATE_SLAB_ALLOCATOR)
+        // Shared states are allocated from the slabs of the current OS
+        // thread, they are handed back to that thread once they are released.
+        static void* operator new(std::size_t size)
+        {
+            return util::slab_allocate(size);
+        }
+        static void operator delete(void* p)
+        {
+            util::slab_deallocate(p);
+        }
+
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+        // The slabs guarantee the alignment of std::max_align_t only,
+        // over-aligned shared states are allocated from the global heap.
+        static void* operator new(std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+        static void operator delete(void* p, std::align_val_t align)
+        {
+            ::operator delete(p, align);
+        }
+#endif
+
+        // The placement operators have to be overloaded as well (the global
+        // placement operators are hidden because of the overloads above).
+        static void* operator new(std::size_t, void* p)
+        {
+            return p;
+        }
+        static void operator delete(void*, void*)
+        {
+        }
+#endif
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref {};
@@ -194,75 +233,6 @@ namespace detail
         std::size_t& count_;
     };
 
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename F1, typename F2>
-    struct compose_cb_impl
-    {
-        template <typename A1, typename A2>
-        compose_cb_impl(A1 && f1, A2 && f2)
-          : f1_(std::forward<A1>(f1))
-          , f2_(std::forward<A2>(f2))
-        {}
-
-        compose_cb_impl(compose_cb_impl&& other)
-          : f1_(std::move(other.f1_))
-          , f2_(std::move(other.f2_))
-        {}
-
-        void operator()()
-        {
-            bool recurse_asynchronously = hpx::threads::get_self_ptr() == nullptr;
-#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
-            recurse_asynchronously =
-                !this_thread::has_sufficient_stack_space();
-#else
-            handle_continuation_recursion_count cnt;
-            recurse_asynchronously = recurse_asynchronously ||
-                cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
-#endif
-            if (recurse_asynchronously)
-            {
-                error_code ec;
-                threads::thread_id_type id = threads::register_thread_nullary(
-                    compose_cb_impl(std::move(f1_), std::move(f2_)),
-                    "compose_cb",
-                    threads::pending, true, threads::thread_priority_boost,
-                    std::size_t(-1), threads::thread_stacksize_current, ec);
-                return;
-            }
-
-            {
-                hpx::util::annotate_function annotate(f1_);
-                (void)annotate;
-                f1_();
-            }
-            {
-                hpx::util::annotate_function annotate(f2_);
-                (void)annotate;
-                f2_();
-            }
-        }
-
-        F1 f1_;
-        F2 f2_;
-    };
-
-    template <typename F1, typename F2>
-    static HPX_FORCEINLINE util::unique_function_nonser<void()>
-    compose_cb(F1 && f1, F2 && f2)
-    {
-        if (!f1)
-            return std::forward<F2>(f2);
-        else if (!f2)
-            return std::forward<F1>(f1);
-
-        // otherwise create a combined callback
-        typedef compose_cb_impl<
-            typename util::decay<F1>::type, typename util::decay<F2>::type
-        > result_type;
-        return result_type(std::forward<F1>(f1), std::forward<F2>(f2));
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct future_data_base;
@@ -282,6 +252,8 @@ namespace detail
         typedef lcos::local::spinlock mutex_type;
         typedef util::unused_type result_type;
         typedef util::unique_function_nonser<void()> completed_callback_type;
+        typedef util::small_vector<completed_callback_type, 1>
+            completed_callback_vector_type;
         typedef future_data_refcnt_base::init_no_addref init_no_addref;
 
         virtual ~future_data_base();
@@ -346,11 +318,21 @@ namespace detail
         // deferred execution of a given continuation
         bool run_on_completed(completed_callback_type && on_completed,
             std::exception_ptr& ptr);
+        bool run_on_completed(completed_callback_vector_type && on_completed,
+            std::exception_ptr& ptr);
 
         // make sure continuation invocation does not recurse deeper than
         // allowed
         void handle_on_completed(completed_callback_type && on_completed);
 
+        // run the given continuations, hands all continuations beyond
+        // HPX_CONTINUATION_MAX_INLINE_CALLBACKS to the scheduler at once
+        void handle_on_completed(completed_callback_vector_type && on_completed);
+
+        // run a continuation which was handed to the scheduler, exceptions
+        // are handled the same way as for continuations run directly
+        void run_on_completed_spawned(completed_callback_type && on_completed);
+
         /// Set the callback which needs to be invoked when the future becomes
         /// ready. If the future is ready the function will be invoked
         /// immediately.
@@ -379,7 +361,7 @@ namespace detail
     protected:
         mutable mutex_type mtx_;
         state state_;                               // current state
-        completed_callback_type on_completed_;
+        completed_callback_vector_type on_completed_;
         local::detail::condition_variable cond_;    // threads waiting in read
     };
 
@@ -392,6 +374,8 @@ namespace detail
         typedef typename future_data_result<Result>::type result_type;
         typedef util::unique_function_nonser<void()> completed_callback_type;
         typedef future_data_base<traits::detail::future_data_void> base_type;
+        typedef base_type::completed_callback_vector_type
+            completed_callback_vector_type;
         typedef lcos::local::spinlock mutex_type;
         typedef typename base_type::init_no_addref init_no_addref;
 
@@ -477,7 +461,8 @@ namespace detail
                 return;
             }
 
-            completed_callback_type on_completed = std::move(on_completed_);
+            completed_callback_vector_type on_completed =
+                std::move(on_completed_);
 
             // set the data
             result_type* value_ptr =
@@ -504,7 +489,7 @@ namespace detail
             //       it unlocked when returning.
 
             // invoke the callback (continuation) function
-            if (on_completed)
+            if (!on_completed.empty())
                 handle_on_completed(std::move(on_completed));
         }
 
@@ -522,7 +507,8 @@ namespace detail
                 return;
             }
 
-            completed_callback_type on_completed = std::move(on_completed_);
+            completed_callback_vector_type on_completed =
+                std::move(on_completed_);
 
             // set the data
             std::exception_ptr* exception_ptr =
@@ -548,7 +534,7 @@ namespace detail
             //       it unlocked when returning.
 
             // invoke the callback (continuation) function
-            if (on_completed)
+            if (!on_completed.empty())
                 handle_on_completed(std::move(on_completed));
         }
 
@@ -614,7 +600,7 @@ namespace detail
             }
 
             state_ = empty;
-            on_completed_ = completed_callback_type();
+            on_completed_.clear();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -1006,31 +992,6 @@ namespace hpx { namespace traits
             typedef lcos::detail::future_data_allocator<R, Allocator> type;
         };
     }
-
-#if defined(HPX_HAVE_THREAD_DESCRIPTION)
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename F1, typename F2>
-    struct get_function_annotation<lcos::detail::compose_cb_impl<F1, F2> >
-    {
-        static char const*
-            call(lcos::detail::compose_cb_impl<F1, F2> const& f) noexcept
-        {
-            return get_function_annotation<F1>::call(f.f1_);
-        }
-    };
-
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename F1, typename F2>
-    struct get_function_annotation_itt<lcos::detail::compose_cb_impl<F1, F2> >
-    {
-        static util::itt::string_handle
-            call(lcos::detail::compose_cb_impl<F1, F2> const& f) noexcept
-        {
-            return get_function_annotation_itt<F1>::call(f.f1_);
-        }
-    };
-#endif
-#endif
 }}
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lcos/local/cancellation_token.hpp
+
+#if !defined(HPX_LCOS_LOCAL_CANCELLATION_TOKEN_HPP)
+#define HPX_LCOS_LOCAL_CANCELLATION_TOKEN_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace hpx { namespace lcos { namespace local
+{
+    class cancellation_source;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A cancellation_token observes the cancellation state of the
+    /// \a cancellation_source it was obtained from. Tokens are cheap to copy
+    /// and can be carried by executors (see
+    /// \a hpx::parallel::execution::cancellable_executor), which drop the
+    /// tasks scheduled through them once the token has been cancelled.
+    ///
+    /// A default constructed token is never cancelled.
+    class cancellation_token
+    {
+    private:
+        typedef std::atomic<bool> flag_type;
+
+        friend class cancellation_source;
+
+        explicit cancellation_token(std::shared_ptr<flag_type> const& flag)
+          : was_cancelled_(flag)
+        {}
+
+    public:
+        cancellation_token() = default;
+
+        /// Returns whether the associated source has been cancelled.
+        bool is_cancelled() const noexcept
+        {
+            return was_cancelled_ &&
+                was_cancelled_->load(std::memory_order_acquire);
+        }
+
+        /// Returns whether this token is associated with a source.
+        bool can_be_cancelled() const noexcept
+        {
+            return was_cancelled_ != nullptr;
+        }
+
+        /// Throws an hpx::exception with the error code
+        /// hpx::future_cancelled if the associated source has been
+        /// cancelled.
+        void throw_if_cancelled(char const* function_name) const
+        {
+            if (is_cancelled())
+            {
+                HPX_THROW_EXCEPTION(hpx::future_cancelled, function_name,
+                    "the operation was cancelled");
+            }
+        }
+
+        /// Returns the exception used to signal the cancellation of an
+        /// operation.
+        static std::exception_ptr get_exception(char const* function_name)
+        {
+            return HPX_GET_EXCEPTION(hpx::future_cancelled, function_name,
+                "the operation was cancelled");
+        }
+
+        friend bool operator==(cancellation_token const& lhs,
+            cancellation_token const& rhs) noexcept
+        {
+            return lhs.was_cancelled_ == rhs.was_cancelled_;
+        }
+
+        friend bool operator!=(cancellation_token const& lhs,
+            cancellation_token const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        std::shared_ptr<flag_type> was_cancelled_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A cancellation_source hands out tokens which all observe the
+    /// cancellation requested through this source.
+    class cancellation_source
+    {
+    private:
+        typedef cancellation_token::flag_type flag_type;
+
+    public:
+        cancellation_source()
+          : was_cancelled_(std::make_shared<flag_type>(false))
+        {}
+
+        /// Returns a new token associated with this source.
+        cancellation_token get_token() const
+        {
+            return cancellation_token(was_cancelled_);
+        }
+
+        /// Request the cancellation of all operations associated with the
+        /// tokens of this source. Returns false if the source had already
+        /// been cancelled.
+        bool cancel() noexcept
+        {
+            return !was_cancelled_->exchange(true, std::memory_order_acq_rel);
+        }
+
+        bool is_cancelled() const noexcept
+        {
+            return was_cancelled_->load(std::memory_order_acquire);
+        }
+
+    private:
+        std::shared_ptr<flag_type> was_cancelled_;
+    };
+}}}
+
+#endif
@@ -9,8 +9,10 @@
 #include <hpx/config.hpp>
 #include <hpx/exception.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/bounded_mpmc_queue.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/lcos/local/packaged_task.hpp>
+#include <hpx/lcos/local/promise.hpp>
 #include <hpx/lcos/local/receive_buffer.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/launch_policy.hpp>
@@ -24,12 +26,15 @@
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <exception>
 #include <iterator>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace local
 {
@@ -503,6 +508,328 @@ namespace hpx { namespace lcos { namespace local
             bool closed_;
         };
 
+
+        ///////////////////////////////////////////////////////////////////////
+        // Channel with a fixed capacity. Values are stored in a lock-free ring
+        // buffer, the internal lock is acquired only if a consumer has to wait
+        // for a value or a producer has to wait for a free slot. The size of
+        // the ring buffer (and therefore the capacity) is the requested
+        // capacity rounded up to the next power of two.
+        template <typename T>
+        class bounded_channel : public channel_impl_base<T>
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+            struct waiting_get
+            {
+                waiting_get(local::promise<T>&& p, T&& val)
+                  : promise_(std::move(p)), val_(std::move(val))
+                {}
+
+                local::promise<T> promise_;
+                T val_;
+            };
+
+            struct waiting_set
+            {
+                explicit waiting_set(T&& val)
+                  : val_(std::move(val))
+                {}
+
+                T val_;
+                local::promise<void> promise_;
+            };
+
+        public:
+            HPX_NON_COPYABLE(bounded_channel);
+
+        public:
+            explicit bounded_channel(std::size_t capacity)
+              : buffer_(capacity), num_waiting_gets_(0),
+                num_waiting_sets_(0), closed_(false)
+            {}
+
+        protected:
+            hpx::future<T> get(std::size_t, bool blocking)
+            {
+                T val;
+                if (pop(val))
+                    return hpx::make_ready_future(std::move(val));
+
+                return get_slow(blocking);
+            }
+
+            bool try_get(std::size_t, hpx::future<T>* f = nullptr)
+            {
+                T val;
+                if (pop(val))
+                {
+                    if (f != nullptr)
+                        *f = hpx::make_ready_future(std::move(val));
+                    return true;
+                }
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (closed_.load(std::memory_order_relaxed) &&
+                        waiting_sets_.empty() && buffer_.empty())
+                    {
+                        return false;
+                    }
+                }
+
+                if (f != nullptr)
+                    *f = get_slow(false);
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t, T && t)
+            {
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                // don't overtake values of producers which are already
+                // waiting for a free slot
+                if (num_waiting_sets_.load(std::memory_order_relaxed) == 0 &&
+                    push(t))
+                {
+                    return hpx::make_ready_future();
+                }
+
+                return set_slow(std::move(t));
+            }
+
+            std::size_t close(bool force_delete_entries = false)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::channel::close",
+                        "attempting to close an already closed channel");
+                    return 0;
+                }
+
+                closed_.store(true, std::memory_order_release);
+
+                if (waiting_gets_.empty())
+                    return 0;
+
+                // all consumers still waiting for a value can't be satisfied
+                // anymore
+                std::deque<local::promise<T> > waiting_gets;
+                std::swap(waiting_gets, waiting_gets_);
+                num_waiting_gets_.fetch_sub(
+                    waiting_gets.size(), std::memory_order_relaxed);
+
+                l.unlock();
+
+                std::exception_ptr e = HPX_GET_EXCEPTION(
+                    hpx::future_cancelled, hpx::lightweight,
+                    "hpx::lcos::local::close",
+                    "canceled waiting on this entry");
+
+                for (local::promise<T>& p : waiting_gets)
+                    p.set_exception(e);
+
+                return waiting_gets.size();
+            }
+
+        private:
+            // Pop a value from the ring buffer, notify producers waiting for
+            // a free slot.
+            bool pop(T& val)
+            {
+                if (!buffer_.try_pop(val))
+                    return false;
+
+                // pairs with the fence in set_slow
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (num_waiting_sets_.load(std::memory_order_relaxed) != 0)
+                    process_waiting();
+
+                return true;
+            }
+
+            // Push a value into the ring buffer, notify consumers waiting for
+            // a value.
+            bool push(T& val)
+            {
+                if (!buffer_.try_push(val))
+                    return false;
+
+                // pairs with the fence in get_slow
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (num_waiting_gets_.load(std::memory_order_relaxed) != 0)
+                    process_waiting();
+
+                return true;
+            }
+
+            hpx::future<T> get_slow(bool blocking)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                // take the value from a waiting producer, if any
+                if (!waiting_sets_.empty())
+                {
+                    waiting_set s(std::move(waiting_sets_.front()));
+                    waiting_sets_.pop_front();
+                    num_waiting_sets_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+
+                    s.promise_.set_value();
+                    return hpx::make_ready_future(std::move(s.val_));
+                }
+
+                num_waiting_gets_.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                T val;
+                if (buffer_.try_pop(val))
+                {
+                    num_waiting_gets_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+                    return hpx::make_ready_future(std::move(val));
+                }
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    num_waiting_gets_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed"));
+                }
+
+                if (blocking && this->use_count() == 1)
+                {
+                    num_waiting_gets_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and is not accessible "
+                            "by any other thread causing a deadlock"));
+                }
+
+                waiting_gets_.emplace_back();
+                return waiting_gets_.back().get_future();
+            }
+
+            hpx::future<void> set_slow(T && t)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    l.unlock();
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                // hand the value directly to a waiting consumer, if any
+                if (!waiting_gets_.empty())
+                {
+                    local::promise<T> p(std::move(waiting_gets_.front()));
+                    waiting_gets_.pop_front();
+                    num_waiting_gets_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+
+                    p.set_value(std::move(t));
+                    return hpx::make_ready_future();
+                }
+
+                num_waiting_sets_.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (waiting_sets_.empty() && buffer_.try_push(t))
+                {
+                    num_waiting_sets_.fetch_sub(1, std::memory_order_relaxed);
+                    return hpx::make_ready_future();
+                }
+
+                // the buffer is full, the returned future becomes ready once
+                // the value has been moved into the buffer
+                waiting_sets_.emplace_back(std::move(t));
+                return waiting_sets_.back().promise_.get_future();
+            }
+
+            // Move values of waiting producers into the buffer and values from
+            // the buffer to waiting consumers.
+            void process_waiting()
+            {
+                std::vector<local::promise<void> > ready_sets;
+                std::vector<waiting_get> ready_gets;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    bool progress = true;
+                    while (progress)
+                    {
+                        progress = false;
+
+                        while (!waiting_sets_.empty() &&
+                            buffer_.try_push(waiting_sets_.front().val_))
+                        {
+                            ready_sets.push_back(
+                                std::move(waiting_sets_.front().promise_));
+                            waiting_sets_.pop_front();
+                            num_waiting_sets_.fetch_sub(
+                                1, std::memory_order_relaxed);
+                            progress = true;
+                        }
+
+                        while (!waiting_gets_.empty())
+                        {
+                            T val;
+                            if (!buffer_.try_pop(val))
+                                break;
+
+                            ready_gets.emplace_back(
+                                std::move(waiting_gets_.front()),
+                                std::move(val));
+                            waiting_gets_.pop_front();
+                            num_waiting_gets_.fetch_sub(
+                                1, std::memory_order_relaxed);
+                            progress = true;
+                        }
+                    }
+                }
+
+                // make futures ready without holding the lock
+                for (local::promise<void>& p : ready_sets)
+                    p.set_value();
+
+                for (waiting_get& g : ready_gets)
+                    g.promise_.set_value(std::move(g.val_));
+            }
+
+        private:
+            bounded_mpmc_queue<T> buffer_;
+
+            mutable mutex_type mtx_;
+            std::deque<local::promise<T> > waiting_gets_;
+            std::deque<waiting_set> waiting_sets_;
+
+            // allow to check for waiting consumers and producers without
+            // acquiring the lock
+            std::atomic<std::size_t> num_waiting_gets_;
+            std::atomic<std::size_t> num_waiting_sets_;
+
+            std::atomic<bool> closed_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T> class channel_base;
     }
@@ -510,6 +837,7 @@ namespace hpx { namespace lcos { namespace local
     ///////////////////////////////////////////////////////////////////////////
     template <typename T = void> class channel;
     template <typename T = void> class one_element_channel;
+    template <typename T = void> class bounded_channel;
     template <typename T = void> class receive_channel;
     template <typename T = void> class send_channel;
 
@@ -788,6 +1116,37 @@ namespace hpx { namespace lcos { namespace local
         using base_type::range;
     };
 
+    // channel with a buffer of fixed capacity, writing to a full channel
+    // returns a future which becomes ready once there is room for the value
+    //
+    // Note: the capacity is rounded up to the next power of two (but at least
+    //       two), the channel may hold more values than requested.
+    template <typename T>
+    class bounded_channel : protected detail::channel_base<T>
+    {
+        typedef detail::channel_base<T> base_type;
+
+    private:
+        friend class channel_iterator<T>;
+        friend class receive_channel<T>;
+        friend class send_channel<T>;
+
+    public:
+        typedef T value_type;
+
+        // The capacity is rounded up to the next power of two.
+        explicit bounded_channel(std::size_t capacity)
+          : base_type(new detail::bounded_channel<T>(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     class receive_channel : protected detail::channel_base<T>
@@ -805,6 +1164,9 @@ namespace hpx { namespace lcos { namespace local
         receive_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        receive_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::get;
         using base_type::begin;
@@ -825,6 +1187,9 @@ namespace hpx { namespace lcos { namespace local
         send_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        send_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::set;
         using base_type::close;
@@ -1051,6 +1416,33 @@ namespace hpx { namespace lcos { namespace local
         using base_type::range;
     };
 
+    template <>
+    class bounded_channel<void> : protected detail::channel_base<void>
+    {
+        typedef detail::channel_base<void> base_type;
+
+    private:
+        friend class channel_iterator<void>;
+        friend class receive_channel<void>;
+        friend class send_channel<void>;
+
+    public:
+        typedef void value_type;
+
+        // The capacity is rounded up to the next power of two.
+        explicit bounded_channel(std::size_t capacity)
+          : base_type(
+                new detail::bounded_channel<util::unused_type>(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <>
     class receive_channel<void> : protected detail::channel_base<void>
@@ -1068,6 +1460,9 @@ namespace hpx { namespace lcos { namespace local
         receive_channel(one_element_channel<void> const& c)
           : base_type(c.get_channel_impl())
         {}
+        receive_channel(bounded_channel<void> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::get;
         using base_type::begin;
@@ -1088,6 +1483,9 @@ namespace hpx { namespace lcos { namespace local
         send_channel(one_element_channel<void> const& c)
           : base_type(c.get_channel_impl())
         {}
+        send_channel(bounded_channel<void> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::set;
         using base_type::close;
@@ -8,6 +8,7 @@
 #define HPX_LCOS_COUNTING_SEMAPHORE_OCT_16_2008_1007AM
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/detail/counting_semaphore.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 
@@ -87,6 +88,22 @@ namespace hpx { namespace lcos { namespace local
             return sem_.try_wait(l, count);
         }
 
+        /// \brief Asynchronously wait for the semaphore to be signaled
+        ///
+        /// \param count    [in] The value by which the internal lock count will
+        ///                 be decremented. At the same time this is the minimum
+        ///                 value of the lock count at which the returned
+        ///                 future becomes ready.
+        ///
+        /// \returns        A future which becomes ready once the requested
+        ///                 amount of credits has been acquired. The calling
+        ///                 thread is not suspended.
+        future<void> async_acquire(std::int64_t count = 1)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            return sem_.async_wait(l, count);
+        }
+
         /// \brief Signal the semaphore
         void signal(std::int64_t count = 1)
         {
@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_ASYNC_WAIT_QUEUE_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_ASYNC_WAIT_QUEUE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    // A FIFO queue of asynchronous waiters. Instead of suspending the waiting
+    // thread, each waiter is represented by a promise which is made ready
+    // as soon as the requested resource has been granted. The queue has to be
+    // protected by the lock of the owning synchronization primitive. The
+    // released promises have to be made ready only after this lock has been
+    // released, as making them ready runs the attached continuations.
+    class async_wait_queue
+    {
+    private:
+        struct waiter
+        {
+            explicit waiter(std::int64_t value)
+              : value_(value)
+            {}
+
+            std::int64_t value_;    // the amount of the requested resource
+            lcos::local::promise<void> promise_;
+        };
+
+    public:
+        typedef std::vector<lcos::local::promise<void> > released_type;
+
+        bool empty() const
+        {
+            return queue_.empty();
+        }
+
+        // Enqueue a new waiter requesting the given amount of the resource.
+        future<void> push(std::int64_t value = 1)
+        {
+            queue_.emplace_back(value);
+            return queue_.back().promise_.get_future();
+        }
+
+        // Release the first waiter.
+        lcos::local::promise<void> pop()
+        {
+            HPX_ASSERT(!queue_.empty());
+
+            lcos::local::promise<void> p = std::move(queue_.front().promise_);
+            queue_.pop_front();
+            return p;
+        }
+
+        // Release waiters in FIFO order as long as f returns true for the
+        // amount of the resource they have requested.
+        template <typename F>
+        void release_while(F && f, released_type& released)
+        {
+            while (!queue_.empty() && f(queue_.front().value_))
+            {
+                released.push_back(std::move(queue_.front().promise_));
+                queue_.pop_front();
+            }
+        }
+
+        // Release all waiters for which f returns true for the amount of the
+        // resource they have requested.
+        template <typename F>
+        void release_if(F && f, released_type& released)
+        {
+            std::deque<waiter> remaining;
+            for (waiter& w : queue_)
+            {
+                if (f(w.value_))
+                    released.push_back(std::move(w.promise_));
+                else
+                    remaining.push_back(std::move(w));
+            }
+            queue_ = std::move(remaining);
+        }
+
+        // Make the released promises ready, this must be called without
+        // holding any lock.
+        static void set_ready(released_type& released)
+        {
+            for (lcos::local::promise<void>& p : released)
+                p.set_value();
+            released.clear();
+        }
+
+    private:
+        std::deque<waiter> queue_;
+    };
+}}}}
+
+#endif
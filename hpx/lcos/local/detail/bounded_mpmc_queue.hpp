@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the bounded multi-producer/multi-consumer queue
+// described by Dmitry Vyukov, see:
+// http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_BOUNDED_MPMC_QUEUE_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_BOUNDED_MPMC_QUEUE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A fixed size ring buffer which can be concurrently pushed to and popped
+    // from by any number of threads. Neither operation ever blocks, both fail
+    // instead if the queue is full or empty, respectively.
+    template <typename T>
+    class bounded_mpmc_queue
+    {
+    private:
+        static std::size_t const cache_line_size = 64;
+
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type data_;
+        };
+
+        static std::size_t round_to_power_of_two(std::size_t size)
+        {
+            std::size_t result = 2;
+            while (result < size)
+                result <<= 1;
+            return result;
+        }
+
+    public:
+        HPX_NON_COPYABLE(bounded_mpmc_queue);
+
+    public:
+        // The capacity is rounded up to the next power of two, at least two
+        // values can be stored.
+        explicit bounded_mpmc_queue(std::size_t capacity)
+          : mask_(round_to_power_of_two(capacity) - 1),
+            buffer_(new cell[mask_ + 1]),
+            enqueue_pos_(0), dequeue_pos_(0)
+        {
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+
+        ~bounded_mpmc_queue()
+        {
+            // destroy all values which have not been popped
+            std::size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+            for (std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+                 pos != end; ++pos)
+            {
+                cell& c = buffer_[pos & mask_];
+                HPX_ASSERT(c.sequence_.load(std::memory_order_relaxed) ==
+                    pos + 1);
+                reinterpret_cast<T*>(&c.data_)->~T();
+            }
+        }
+
+        std::size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        // Move the given value into the queue, the value is left untouched
+        // if the queue is full.
+        bool try_push(T& val)
+        {
+            cell* c = nullptr;
+            std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;       // the queue is full
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (&c->data_) T(std::move(val));
+            c->sequence_.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T& val)
+        {
+            cell* c = nullptr;
+            std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;       // the queue is empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            T* data = reinterpret_cast<T*>(&c->data_);
+            val = std::move(*data);
+            data->~T();
+
+            c->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+        // This is only a snapshot and may be outdated by the time it is
+        // returned.
+        bool empty() const
+        {
+            return dequeue_pos_.load(std::memory_order_acquire) >=
+                enqueue_pos_.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::size_t const mask_;
+        std::unique_ptr<cell[]> buffer_;
+
+        // producers and consumers operate on separate cache lines
+        char pad0_[cache_line_size];
+        std::atomic<std::size_t> enqueue_pos_;
+        char pad1_[cache_line_size - sizeof(std::atomic<std::size_t>)];
+        std::atomic<std::size_t> dequeue_pos_;
+        char pad2_[cache_line_size - sizeof(std::atomic<std::size_t>)];
+    };
+}}}}
+
+#endif
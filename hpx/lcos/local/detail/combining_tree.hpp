@@ -0,0 +1,99 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_COMBINING_TREE_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_COMBINING_TREE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    // A software combining tree used to count the arrival of a fixed number
+    // of participants. Each participant arrives at a leaf shared with at most
+    // fan_in - 1 other participants, only the last participant arriving at
+    // a node proceeds to its parent. Every node occupies its own cache line,
+    // which limits the contention on any of the counters to fan_in threads.
+    class HPX_EXPORT combining_tree
+    {
+    private:
+        static std::size_t const cache_line_size = 64;
+
+        struct node
+        {
+            std::atomic<std::size_t> count_;
+            std::size_t initial_;
+            std::size_t parent_;
+            char pad_[cache_line_size - 3 * sizeof(std::size_t)];
+        };
+
+    public:
+        combining_tree(std::size_t num_participants, std::size_t fan_in);
+
+        std::size_t size() const
+        {
+            return num_participants_;
+        }
+
+        // Register the arrival of the given participant. Returns true for
+        // the participant which arrived last, i.e. which completed the
+        // root node. If reset is true, all nodes are re-armed while
+        // traversing the tree, which allows the tree to be reused once all
+        // participants have observed the completion.
+        bool arrive(std::size_t participant, bool reset);
+
+    private:
+        std::size_t const num_participants_;
+        std::size_t const fan_in_;
+        std::unique_ptr<node[]> nodes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A generation counter which is advanced whenever a tree based
+    // synchronization primitive is completed. Waiting threads spin for a
+    // short period of time before they are suspended.
+    class HPX_EXPORT release_flag
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        static std::size_t const cache_line_size = 64;
+
+    public:
+        release_flag();
+        ~release_flag();
+
+        std::size_t generation() const
+        {
+            return generation_.load(std::memory_order_acquire);
+        }
+
+        // wait for the generation to be advanced beyond the given one
+        void wait(std::size_t generation, char const* description);
+
+        // advance the generation, releasing all waiting threads
+        void release();
+
+    private:
+        std::atomic<std::size_t> generation_;
+        char pad_[cache_line_size - sizeof(std::atomic<std::size_t>)];
+
+        std::size_t sleepers_;
+        mutable mutex_type mtx_;
+        local::detail::condition_variable cond_;
+    };
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
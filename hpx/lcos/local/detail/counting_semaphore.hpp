@@ -8,6 +8,8 @@
 #define HPX_LCOS_DETAIL_COUNTING_SEMAPHORE_AUG_03_2015_0657PM
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/async_wait_queue.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/util/assert.hpp>
@@ -60,14 +62,41 @@ namespace hpx { namespace lcos { namespace local { namespace detail
             return false;
         }
 
+        future<void> async_wait(std::unique_lock<mutex_type>& l,
+            std::int64_t count)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            // asynchronous waiters are served in FIFO order
+            if (async_waiters_.empty() && !(value_ < count))
+            {
+                value_ -= count;
+                return make_ready_future();
+            }
+            return async_waiters_.push(count);
+        }
+
         void signal(std::unique_lock<mutex_type> l, std::int64_t count)
         {
             HPX_ASSERT_OWNS_LOCK(l);
 
             mutex_type* mtx = l.mutex();
 
-            // release no more threads than we get resources
             value_ += count;
+
+            // asynchronous waiters are granted their credits first
+            async_wait_queue::released_type released;
+            async_waiters_.release_while(
+                [this](std::int64_t requested) -> bool
+                {
+                    if (value_ < requested)
+                        return false;
+                    value_ -= requested;
+                    return true;
+                },
+                released);
+
+            // release no more threads than we get resources
             for (std::int64_t i = 0; value_ >= 0 && i < count; ++i)
             {
                 // notify_one() returns false if no more threads are
@@ -77,6 +106,13 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
                 l = std::unique_lock<mutex_type>(*mtx);
             }
+
+            if (!released.empty())
+            {
+                if (l.owns_lock())
+                    l.unlock();
+                async_wait_queue::set_ready(released);
+            }
         }
 
         std::int64_t signal_all(std::unique_lock<mutex_type> l)
@@ -91,6 +127,7 @@ namespace hpx { namespace lcos { namespace local { namespace detail
     private:
         std::int64_t value_;
         local::detail::condition_variable cond_;
+        async_wait_queue async_waiters_;
     };
 }}}}
 
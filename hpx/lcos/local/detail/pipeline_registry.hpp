@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_PIPELINE_REGISTRY_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_PIPELINE_REGISTRY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/jenkins_hash.hpp>
+#include <hpx/util/static.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    // The statistics collected for each of the stages of a pipeline.
+    struct pipeline_stage_statistics
+    {
+        pipeline_stage_statistics()
+          : processed_(0), queued_(0)
+        {}
+
+        std::atomic<std::int64_t> processed_;   // items processed so far
+        std::atomic<std::int64_t> queued_;      // items waiting for the stage
+    };
+
+    // The registry maps the names of the stages of all live pipelines
+    // (<pipeline-name>/<stage-name>) to their statistics. It is used by the
+    // performance counters /pipeline/count/processed and
+    // /pipeline/queue/length.
+    class HPX_EXPORT pipeline_stage_registry
+    {
+    public:
+        HPX_NON_COPYABLE(pipeline_stage_registry);
+
+    public:
+        typedef std::shared_ptr<pipeline_stage_statistics> statistics_ptr;
+
+        enum counter_kind
+        {
+            processed_items,
+            queue_length
+        };
+
+        pipeline_stage_registry() {}
+
+        static pipeline_stage_registry& instance();
+
+        // A stage registered under an already existing name replaces the
+        // previous registration.
+        void register_stage(std::string const& name,
+            statistics_ptr const& stats);
+        void unregister_stage(std::string const& name,
+            pipeline_stage_statistics const* stats);
+
+        hpx::util::function_nonser<std::int64_t(bool)>
+            get_counter(std::string const& name, counter_kind kind) const;
+
+        bool counter_discoverer(
+            performance_counters::counter_info const& info,
+            performance_counters::counter_path_elements& p,
+            performance_counters::discover_counter_func const& f,
+            performance_counters::discover_counters_mode mode, error_code& ec);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::unordered_map<
+                std::string, std::weak_ptr<pipeline_stage_statistics>,
+                hpx::util::jenkins_hash
+            > map_type;
+
+        struct tag {};
+
+        friend struct hpx::util::static_<pipeline_stage_registry, tag>;
+
+        mutable mutex_type mtx_;
+        map_type map_;
+    };
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
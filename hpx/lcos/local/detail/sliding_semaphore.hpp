@@ -7,6 +7,8 @@
 #define HPX_LCOS_DETAIL_SLIDING_SEMAPHORE_AUG_25_2016_1026AM
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/async_wait_queue.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/util/assert.hpp>
@@ -58,6 +60,16 @@ namespace hpx { namespace lcos { namespace local { namespace detail
             return false;
         }
 
+        future<void> async_wait(std::unique_lock<mutex_type>& l,
+            std::int64_t upper_limit)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            if (!(upper_limit - max_difference_ > lower_limit_))
+                return make_ready_future();
+            return async_waiters_.push(upper_limit);
+        }
+
         void signal(std::unique_lock<mutex_type> l, std::int64_t lower_limit)
         {
             HPX_ASSERT_OWNS_LOCK(l);
@@ -66,6 +78,15 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
             lower_limit_ = (std::max)(lower_limit, lower_limit_);
 
+            // release all asynchronous waiters which are within range
+            async_wait_queue::released_type released;
+            async_waiters_.release_if(
+                [this](std::int64_t upper_limit) -> bool
+                {
+                    return !(upper_limit - max_difference_ > lower_limit_);
+                },
+                released);
+
             // touch upon all threads
             std::int64_t count = static_cast<std::int64_t>(cond_.size(l));
             for (/**/; count > 0; --count)
@@ -76,6 +97,13 @@ namespace hpx { namespace lcos { namespace local { namespace detail
 
                 l = std::unique_lock<mutex_type>(*mtx);
             }
+
+            if (!released.empty())
+            {
+                if (l.owns_lock())
+                    l.unlock();
+                async_wait_queue::set_ready(released);
+            }
         }
 
         std::int64_t signal_all(std::unique_lock<mutex_type> l)
@@ -90,6 +118,7 @@ namespace hpx { namespace lcos { namespace local { namespace detail
         std::int64_t max_difference_;
         std::int64_t lower_limit_;
         local::detail::condition_variable cond_;
+        async_wait_queue async_waiters_;
     };
 }}}}
 
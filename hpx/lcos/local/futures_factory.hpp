@@ -32,6 +32,16 @@ namespace hpx { namespace lcos { namespace local
 {
     namespace detail
     {
+        ///////////////////////////////////////////////////////////////////////
+        // A stackless thread can't yield to a forked thread, in this case the
+        // new thread is scheduled as if launch::async was used.
+        inline bool is_fork_policy(launch policy)
+        {
+            return policy == launch::fork &&
+                threads::get_self_stacksize() !=
+                    std::size_t(HPX_NOSTACK_STACK_SIZE);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Result, typename F, typename Executor,
             typename Base = lcos::detail::task_base<Result> >
@@ -102,7 +112,7 @@ namespace hpx { namespace lcos { namespace local
                 typedef typename Base::future_base_type future_base_type;
                 future_base_type this_(this);
 
-                if (policy == launch::fork) {
+                if (is_fork_policy(policy)) {
                     return threads::register_thread_nullary(
                         util::deferred_call(
                             &base_type::run_impl, std::move(this_)),
@@ -190,7 +200,7 @@ namespace hpx { namespace lcos { namespace local
                             &base_type::run_impl, std::move(this_)));
                     return threads::invalid_thread_id;
                 }
-                else if (policy == launch::fork) {
+                else if (is_fork_policy(policy)) {
                     return threads::register_thread_nullary(
                         util::deferred_call(
                             &base_type::run_impl, std::move(this_)),
@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_MCS_SPINLOCK_HPP)
+#define HPX_LCOS_LOCAL_MCS_SPINLOCK_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/itt_notify.hpp>
+#include <hpx/util/register_locks.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// boost::mutex-compatible queued spinlock class (after Mellor-Crummey
+    /// and Scott). Waiting threads form a queue and each of them spins on a
+    /// flag in its own queue node only, which avoids all waiters contending
+    /// for the cache line holding the lock. The lock is handed over to the
+    /// waiting threads in FIFO order. HPX threads are suspended after a
+    /// short spinning period.
+    struct mcs_spinlock
+    {
+    public:
+        HPX_NON_COPYABLE(mcs_spinlock);
+
+    private:
+        static std::size_t const cache_line_size = 64;
+
+        struct node
+        {
+            std::atomic<node*> next_;
+            std::atomic<bool> locked_;
+            node* cache_next_;      // used by the node cache only
+            char pad_[cache_line_size - 3 * sizeof(void*)];
+        };
+
+        // Queue nodes are kept in a per (kernel-) thread cache. A node may be
+        // acquired on one thread and released on another one, if the HPX
+        // thread holding the lock has been moved in between.
+        HPX_EXPORT static node* acquire_node();
+        HPX_EXPORT static void release_node(node* n) noexcept;
+
+    public:
+        mcs_spinlock(char const* const desc = "hpx::lcos::local::mcs_spinlock")
+          : tail_(nullptr), owner_(nullptr)
+        {
+            HPX_ITT_SYNC_CREATE(this, desc, "");
+        }
+
+        ~mcs_spinlock()
+        {
+            HPX_ITT_SYNC_DESTROY(this);
+        }
+
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            node* n = acquire_node();
+            n->next_.store(nullptr, std::memory_order_relaxed);
+            n->locked_.store(true, std::memory_order_relaxed);
+
+            node* pred = tail_.exchange(n, std::memory_order_acq_rel);
+            if (pred != nullptr)
+            {
+                // enqueue ourselves and wait for our predecessor to hand
+                // over the lock
+                pred->next_.store(n, std::memory_order_release);
+                for (std::size_t k = 0;
+                     n->locked_.load(std::memory_order_acquire); ++k)
+                {
+                    util::detail::yield_k(k,
+                        "hpx::lcos::local::mcs_spinlock::lock");
+                }
+            }
+            owner_ = n;
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        bool try_lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            if (tail_.load(std::memory_order_relaxed) == nullptr)
+            {
+                node* n = acquire_node();
+                n->next_.store(nullptr, std::memory_order_relaxed);
+                n->locked_.store(false, std::memory_order_relaxed);
+
+                node* expected = nullptr;
+                if (tail_.compare_exchange_strong(expected, n,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    owner_ = n;
+
+                    HPX_ITT_SYNC_ACQUIRED(this);
+                    util::register_lock(this);
+                    return true;
+                }
+                release_node(n);
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        void unlock()
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+
+            node* n = owner_;
+            node* succ = n->next_.load(std::memory_order_acquire);
+            if (succ == nullptr)
+            {
+                // no known successor, try to release the lock altogether
+                node* expected = n;
+                if (tail_.compare_exchange_strong(expected, nullptr,
+                        std::memory_order_release, std::memory_order_relaxed))
+                {
+                    release_node(n);
+
+                    HPX_ITT_SYNC_RELEASED(this);
+                    util::unregister_lock(this);
+                    return;
+                }
+
+                // a successor is about to enqueue itself, wait for it
+                for (std::size_t k = 0;
+                     (succ = n->next_.load(std::memory_order_acquire)) == nullptr;
+                     ++k)
+                {
+                    util::detail::yield_k(k,
+                        "hpx::lcos::local::mcs_spinlock::unlock");
+                }
+            }
+
+            succ->locked_.store(false, std::memory_order_release);
+            release_node(n);
+
+            HPX_ITT_SYNC_RELEASED(this);
+            util::unregister_lock(this);
+        }
+
+    private:
+        std::atomic<node*> tail_;
+        node* owner_;       // accessed by the thread holding the lock only
+    };
+}}}
+
+#endif
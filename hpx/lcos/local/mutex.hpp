@@ -9,6 +9,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/error_code.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/async_wait_queue.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
@@ -44,12 +46,19 @@ namespace hpx { namespace lcos { namespace local
             return try_lock("mutex::try_lock", ec);
         }
 
+        /// Acquire the mutex without suspending the calling thread. The
+        /// returned future becomes ready once the mutex has been acquired.
+        /// A mutex acquired this way is not owned by any particular thread,
+        /// it may be released by calling unlock() from any thread.
+        HPX_EXPORT future<void> async_lock();
+
         HPX_EXPORT void unlock(error_code& ec = throws);
 
     protected:
         mutable mutex_type mtx_;
         threads::thread_id_repr_type owner_id_;
         detail::condition_variable cond_;
+        detail::async_wait_queue async_waiters_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -65,6 +74,7 @@ namespace hpx { namespace lcos { namespace local
 
         using mutex::lock;
         using mutex::try_lock;
+        using mutex::async_lock;
         using mutex::unlock;
 
         HPX_EXPORT bool try_lock_until(util::steady_time_point const& abs_time,
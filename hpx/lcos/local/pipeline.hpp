@@ -0,0 +1,916 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lcos/local/pipeline.hpp
+
+#if !defined(HPX_LCOS_LOCAL_PIPELINE_HPP)
+#define HPX_LCOS_LOCAL_PIPELINE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/channel.hpp>
+#include <hpx/lcos/local/detail/pipeline_registry.hpp>
+#include <hpx/lcos/local/mutex.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/result_of.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local
+{
+    /// The processing mode of a pipeline stage.
+    enum class pipeline_mode
+    {
+        /// The stage passes on its results in the order the corresponding
+        /// items were pushed into the pipeline. A sink stage consumes the
+        /// items in this order, one at a time.
+        ordered,
+
+        /// The stage passes on its results as soon as they are available.
+        unordered
+    };
+
+    template <typename T> class pipeline;
+    template <typename T, typename U> class pipeline_builder;
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Items are passed between the stages in batches. The sequence number
+        // of a batch is assigned when it enters the pipeline, it allows the
+        // ordered stages to restore the original order.
+        template <typename T>
+        struct pipeline_batch
+        {
+            pipeline_batch()
+              : sequence_(0)
+            {}
+
+            explicit pipeline_batch(std::size_t sequence)
+              : sequence_(sequence)
+            {}
+
+            std::size_t sequence_;
+            std::vector<T> items_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // State shared by all stages of a pipeline.
+        class pipeline_state
+        {
+        private:
+            typedef lcos::local::spinlock mutex_type;
+
+            typedef hpx::util::function_nonser<void()> worker_type;
+            typedef hpx::util::function_nonser<
+                    hpx::future<void>(worker_type const&)
+                > spawn_type;
+
+            template <typename Executor>
+            struct spawner
+            {
+                hpx::future<void> operator()(worker_type const& f)
+                {
+                    return parallel::execution::async_execute(exec_, f);
+                }
+
+                Executor exec_;
+            };
+
+        public:
+            template <typename Executor>
+            pipeline_state(Executor && exec, std::string name,
+                    std::size_t batch_size, std::size_t capacity)
+              : spawn_(spawner<typename hpx::util::decay<Executor>::type>{
+                    std::forward<Executor>(exec)}),
+                name_(std::move(name)), batch_size_(batch_size),
+                capacity_(capacity)
+            {
+                HPX_ASSERT(batch_size_ != 0 && capacity_ != 0);
+            }
+
+            // run the given function on the executor of the pipeline
+            hpx::future<void> spawn(worker_type const& f)
+            {
+                return spawn_(f);
+            }
+
+            // the name the statistics of a stage are registered with, empty
+            // if the pipeline has no name
+            std::string stage_name(std::string const& name,
+                std::size_t index) const
+            {
+                if (name_.empty())
+                    return std::string();
+
+                if (name.empty())
+                    return name_ + "/stage#" + std::to_string(index);
+
+                return name_ + "/" + name;
+            }
+
+            std::size_t batch_size() const
+            {
+                return batch_size_;
+            }
+
+            std::size_t capacity() const
+            {
+                return capacity_;
+            }
+
+            // Errors thrown by the functions of the stages are stored and
+            // reported once the pipeline has been drained. The failing
+            // items are dropped.
+            void set_exception(std::exception_ptr e)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (!exception_)
+                    exception_ = std::move(e);
+            }
+
+            std::exception_ptr get_exception() const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                return exception_;
+            }
+
+        private:
+            spawn_type spawn_;
+
+            std::string const name_;
+            std::size_t const batch_size_;
+            std::size_t const capacity_;
+
+            mutable mutex_type mtx_;
+            std::exception_ptr exception_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The bounded queue feeding a stage. Producers are suspended while
+        // the queue is full, which propagates the backpressure of a slow
+        // stage to the preceding stages and finally to the pipeline input.
+        template <typename T>
+        class pipeline_queue
+        {
+        public:
+            HPX_NON_COPYABLE(pipeline_queue);
+
+        public:
+            explicit pipeline_queue(std::size_t capacity)
+              : channel_(capacity),
+                statistics_(std::make_shared<pipeline_stage_statistics>())
+            {}
+
+            void put(pipeline_batch<T> && batch)
+            {
+                statistics_->queued_.fetch_add(
+                    std::int64_t(batch.items_.size()), std::memory_order_relaxed);
+                channel_.set(hpx::launch::sync, std::move(batch));
+            }
+
+            // same as put, but never suspends the calling thread, the queue
+            // may exceed its capacity
+            void post(pipeline_batch<T> && batch)
+            {
+                statistics_->queued_.fetch_add(
+                    std::int64_t(batch.items_.size()), std::memory_order_relaxed);
+                channel_.set(hpx::launch::async, std::move(batch));
+            }
+
+            // The given function is invoked whenever get() is about to wait
+            // for the next batch. This has to be set before the first call
+            // to get().
+            void set_idle_handler(hpx::util::function_nonser<void()> f)
+            {
+                idle_handler_ = std::move(f);
+            }
+
+            // returns false once the queue has been closed and drained
+            bool get(pipeline_batch<T>& batch)
+            {
+                error_code ec(lightweight);
+                hpx::future<pipeline_batch<T> > f =
+                    channel_.get(hpx::launch::async);
+                if (!f.is_ready() && idle_handler_)
+                    idle_handler_();
+
+                batch = f.get(ec);
+                if (ec)
+                    return false;
+
+                statistics_->queued_.fetch_sub(
+                    std::int64_t(batch.items_.size()), std::memory_order_relaxed);
+                return true;
+            }
+
+            void close()
+            {
+                channel_.close();
+            }
+
+            std::shared_ptr<pipeline_stage_statistics> const&
+                statistics() const
+            {
+                return statistics_;
+            }
+
+        private:
+            lcos::local::bounded_channel<pipeline_batch<T> > channel_;
+            std::shared_ptr<pipeline_stage_statistics> statistics_;
+            hpx::util::function_nonser<void()> idle_handler_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Restores the order of the batches processed by an ordered stage.
+        template <typename T>
+        class pipeline_sequencer
+        {
+        private:
+            typedef lcos::local::mutex mutex_type;
+
+        public:
+            pipeline_sequencer()
+              : next_(0)
+            {}
+
+            // Invoke f for the given batch and for all pending batches
+            // directly following it. The invocations of f are serialized and
+            // happen in the order of the sequence numbers of the batches.
+            template <typename F>
+            void deliver(pipeline_batch<T> && batch, F && f)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                if (batch.sequence_ != next_)
+                {
+                    std::size_t const sequence = batch.sequence_;
+                    pending_.emplace(sequence, std::move(batch));
+                    return;
+                }
+
+                f(batch);
+                ++next_;
+
+                auto it = pending_.begin();
+                while (it != pending_.end() && it->first == next_)
+                {
+                    f(it->second);
+                    it = pending_.erase(it);
+                    ++next_;
+                }
+            }
+
+        private:
+            mutex_type mtx_;
+            std::size_t next_;
+            std::map<std::size_t, pipeline_batch<T> > pending_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Common part of the stages: the input queue, the worker threads and
+        // the registration of the statistics.
+        template <typename T, typename F>
+        class pipeline_stage_base
+        {
+        public:
+            HPX_NON_COPYABLE(pipeline_stage_base);
+
+        public:
+            template <typename F_>
+            pipeline_stage_base(std::shared_ptr<pipeline_state> state,
+                    std::shared_ptr<pipeline_queue<T> > input, F_ && f,
+                    pipeline_mode mode, std::size_t parallelism,
+                    std::string name)
+              : state_(std::move(state)), input_(std::move(input)),
+                f_(std::forward<F_>(f)), mode_(mode),
+                parallelism_(parallelism), active_(parallelism),
+                name_(std::move(name))
+            {
+                HPX_ASSERT(parallelism_ != 0);
+                if (!name_.empty())
+                {
+                    pipeline_stage_registry::instance().register_stage(
+                        name_, input_->statistics());
+                }
+            }
+
+            ~pipeline_stage_base()
+            {
+                if (!name_.empty())
+                {
+                    pipeline_stage_registry::instance().unregister_stage(
+                        name_, input_->statistics().get());
+                }
+            }
+
+            // Launch the workers of the given stage, each worker keeps the
+            // stage alive until the input queue has been drained.
+            template <typename Stage>
+            static void start(std::shared_ptr<Stage> const& stage,
+                std::vector<hpx::future<void> >& workers)
+            {
+                for (std::size_t i = 0; i != stage->parallelism_; ++i)
+                {
+                    workers.push_back(stage->state_->spawn(
+                        [stage]() { stage->run(); }));
+                }
+            }
+
+        protected:
+            // returns true for the last worker to finish
+            bool worker_done()
+            {
+                return --active_ == 0;
+            }
+
+            void processed(std::size_t count)
+            {
+                input_->statistics()->processed_.fetch_add(
+                    std::int64_t(count), std::memory_order_relaxed);
+            }
+
+            std::shared_ptr<pipeline_state> state_;
+            std::shared_ptr<pipeline_queue<T> > input_;
+            F f_;
+            pipeline_mode const mode_;
+            std::size_t const parallelism_;
+
+        private:
+            std::atomic<std::size_t> active_;
+            std::string const name_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A stage transforming each item of type T into an item of type U.
+        template <typename T, typename U, typename F>
+        class pipeline_stage : public pipeline_stage_base<T, F>
+        {
+            typedef pipeline_stage_base<T, F> base_type;
+
+        public:
+            template <typename F_>
+            pipeline_stage(std::shared_ptr<pipeline_state> state,
+                    std::shared_ptr<pipeline_queue<T> > input,
+                    std::shared_ptr<pipeline_queue<U> > output, F_ && f,
+                    pipeline_mode mode, std::size_t parallelism,
+                    std::string name)
+              : base_type(std::move(state), std::move(input),
+                    std::forward<F_>(f), mode, parallelism, std::move(name)),
+                output_(std::move(output))
+            {}
+
+            void run()
+            {
+                pipeline_batch<T> batch;
+                while (this->input_->get(batch))
+                {
+                    pipeline_batch<U> result(batch.sequence_);
+                    result.items_.reserve(batch.items_.size());
+
+                    try {
+                        for (T& item : batch.items_)
+                        {
+                            result.items_.push_back(
+                                hpx::util::invoke(this->f_, std::move(item)));
+                        }
+                    }
+                    catch (...) {
+                        // pass on an empty batch to keep the sequence intact
+                        this->state_->set_exception(std::current_exception());
+                        result.items_.clear();
+                    }
+                    this->processed(batch.items_.size());
+
+                    if (this->mode_ == pipeline_mode::ordered)
+                    {
+                        sequencer_.deliver(std::move(result),
+                            [this](pipeline_batch<U>& b)
+                            {
+                                forward(std::move(b));
+                            });
+                    }
+                    else
+                    {
+                        forward(std::move(result));
+                    }
+                }
+
+                // the last worker signals the end of the stream to the next
+                // stage
+                if (this->worker_done())
+                    output_->close();
+            }
+
+        private:
+            void forward(pipeline_batch<U> && batch)
+            {
+                try {
+                    output_->put(std::move(batch));
+                }
+                catch (...) {
+                    this->state_->set_exception(std::current_exception());
+                }
+            }
+
+            std::shared_ptr<pipeline_queue<U> > output_;
+            pipeline_sequencer<U> sequencer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The final stage of a pipeline consuming all items.
+        template <typename T, typename F>
+        class pipeline_sink : public pipeline_stage_base<T, F>
+        {
+            typedef pipeline_stage_base<T, F> base_type;
+
+        public:
+            template <typename F_>
+            pipeline_sink(std::shared_ptr<pipeline_state> state,
+                    std::shared_ptr<pipeline_queue<T> > input, F_ && f,
+                    pipeline_mode mode, std::size_t parallelism,
+                    std::string name)
+              : base_type(std::move(state), std::move(input),
+                    std::forward<F_>(f), mode, parallelism, std::move(name))
+            {}
+
+            void run()
+            {
+                pipeline_batch<T> batch;
+                while (this->input_->get(batch))
+                {
+                    if (this->mode_ == pipeline_mode::ordered)
+                    {
+                        sequencer_.deliver(std::move(batch),
+                            [this](pipeline_batch<T>& b)
+                            {
+                                consume(b);
+                            });
+                    }
+                    else
+                    {
+                        consume(batch);
+                    }
+                }
+                this->worker_done();
+            }
+
+        private:
+            void consume(pipeline_batch<T>& batch)
+            {
+                try {
+                    for (T& item : batch.items_)
+                        hpx::util::invoke(this->f_, std::move(item));
+                }
+                catch (...) {
+                    this->state_->set_exception(std::current_exception());
+                }
+                this->processed(batch.items_.size());
+            }
+
+            pipeline_sequencer<T> sequencer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Collects the pushed items into batches and feeds them to the first
+        // stage. A partial batch is passed on as soon as one of the workers
+        // of the first stage runs out of work, or if flush is called.
+        template <typename T>
+        class pipeline_source
+        {
+        public:
+            HPX_NON_COPYABLE(pipeline_source);
+
+        private:
+            typedef lcos::local::spinlock mutex_type;
+
+        public:
+            pipeline_source(std::shared_ptr<pipeline_queue<T> > queue,
+                    std::size_t batch_size)
+              : queue_(std::move(queue)), batch_size_(batch_size),
+                next_sequence_(0), closed_(false)
+            {}
+
+            // Let the first stage pull the partial batch whenever one of its
+            // workers is about to wait for input.
+            static void set_idle_handler(
+                std::shared_ptr<pipeline_source> const& source)
+            {
+                std::weak_ptr<pipeline_source> weak_source(source);
+                source->queue_->set_idle_handler(
+                    [weak_source]()
+                    {
+                        std::shared_ptr<pipeline_source> source =
+                            weak_source.lock();
+                        if (source)
+                            source->flush_idle();
+                    });
+            }
+
+            void push(T && val)
+            {
+                pipeline_batch<T> batch;
+                bool closed = false;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (!(closed = closed_))
+                    {
+                        current_.push_back(std::move(val));
+                        if (current_.size() == batch_size_)
+                        {
+                            batch.sequence_ = next_sequence_++;
+                            std::swap(batch.items_, current_);
+                        }
+                    }
+                }
+
+                if (closed)
+                {
+                    HPX_THROW_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::pipeline::push",
+                        "attempting to push to a closed pipeline");
+                }
+
+                if (!batch.items_.empty())
+                    queue_->put(std::move(batch));
+            }
+
+            // pass on the current partial batch (if any)
+            void flush()
+            {
+                pipeline_batch<T> batch;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (closed_ || current_.empty())
+                        return;
+
+                    batch.sequence_ = next_sequence_++;
+                    std::swap(batch.items_, current_);
+                }
+
+                queue_->put(std::move(batch));
+            }
+
+            // returns false if the source was already closed
+            bool close()
+            {
+                pipeline_batch<T> batch;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (closed_)
+                        return false;
+
+                    closed_ = true;
+                    if (!current_.empty())
+                    {
+                        batch.sequence_ = next_sequence_++;
+                        std::swap(batch.items_, current_);
+                    }
+                }
+
+                if (!batch.items_.empty())
+                    queue_->put(std::move(batch));
+
+                queue_->close();
+                return true;
+            }
+
+        private:
+            // Invoked by the workers of the first stage, this must not
+            // suspend as the worker may be the only one to drain the queue.
+            // The batch is queued while holding the lock to make sure it
+            // can't be overtaken by a concurrent close.
+            void flush_idle()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (closed_ || current_.empty())
+                    return;
+
+                pipeline_batch<T> batch(next_sequence_++);
+                std::swap(batch.items_, current_);
+                queue_->post(std::move(batch));
+            }
+
+            std::shared_ptr<pipeline_queue<T> > queue_;
+            std::size_t const batch_size_;
+
+            mutex_type mtx_;
+            std::vector<T> current_;
+            std::size_t next_sequence_;
+            bool closed_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A running pipeline accepting items of type \a T. The items are
+    /// processed by the stages the pipeline has been built from, see
+    /// \a make_pipeline.
+    template <typename T>
+    class pipeline
+    {
+        template <typename T1, typename U1> friend class pipeline_builder;
+
+        pipeline(std::shared_ptr<detail::pipeline_state> state,
+                std::shared_ptr<detail::pipeline_source<T> > source,
+                std::vector<hpx::future<void> > && workers)
+          : state_(std::move(state)), source_(std::move(source)),
+            workers_(std::move(workers))
+        {}
+
+    public:
+        typedef T value_type;
+
+        pipeline(pipeline && rhs) = default;
+
+        pipeline& operator=(pipeline && rhs)
+        {
+            if (this != &rhs)
+            {
+                if (source_)
+                    source_->close();
+
+                state_ = std::move(rhs.state_);
+                source_ = std::move(rhs.source_);
+                workers_ = std::move(rhs.workers_);
+            }
+            return *this;
+        }
+
+        /// Closes the pipeline if this has not been done yet, this does not
+        /// wait for the pipeline to be drained.
+        ~pipeline()
+        {
+            if (source_)
+                source_->close();
+        }
+
+        /// Push a new item into the pipeline. The items are passed on to
+        /// the first stage in batches, the calling thread is suspended as
+        /// long as the first stage is not able to accept a new batch.
+        void push(T val)
+        {
+            HPX_ASSERT(source_);
+            source_->push(std::move(val));
+        }
+
+        /// Pass on the items pushed since the last complete batch to the
+        /// first stage without waiting for the batch to fill up. This
+        /// happens automatically whenever one of the workers of the first
+        /// stage runs out of work.
+        void flush()
+        {
+            HPX_ASSERT(source_);
+            source_->flush();
+        }
+
+        /// Signal the end of the input, the last (partial) batch is passed
+        /// on to the first stage.
+        void close()
+        {
+            HPX_ASSERT(source_);
+            if (!source_->close())
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::pipeline::close",
+                    "attempting to close an already closed pipeline");
+            }
+        }
+
+        /// Returns a future which becomes ready once all stages have
+        /// processed all items pushed before the pipeline was closed. The
+        /// future holds the first exception thrown by any of the stages.
+        /// This function can be called only once.
+        hpx::future<void> get_future()
+        {
+            std::shared_ptr<detail::pipeline_state> state = state_;
+            return hpx::when_all(std::move(workers_)).then(
+                [state](hpx::future<std::vector<hpx::future<void> > > && f)
+                {
+                    std::vector<hpx::future<void> > workers = f.get();
+                    for (hpx::future<void>& w : workers)
+                        w.get();
+
+                    std::exception_ptr e = state->get_exception();
+                    if (e)
+                        std::rethrow_exception(e);
+                });
+        }
+
+        /// Close the pipeline (if this has not been done yet) and wait for
+        /// it to be drained.
+        void wait()
+        {
+            HPX_ASSERT(source_);
+            source_->close();
+            get_future().get();
+        }
+
+    private:
+        std::shared_ptr<detail::pipeline_state> state_;
+        std::shared_ptr<detail::pipeline_source<T> > source_;
+        std::vector<hpx::future<void> > workers_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Assembles the stages of a pipeline accepting items of type \a T. The
+    /// last stage added so far produces items of type \a U. The workers of
+    /// the stages are launched once the pipeline is completed by adding
+    /// its sink.
+    template <typename T, typename U>
+    class pipeline_builder
+    {
+        template <typename T1, typename U1> friend class pipeline_builder;
+
+        typedef hpx::util::function_nonser<
+                void(std::vector<hpx::future<void> >&)
+            > starter_type;
+
+        pipeline_builder(std::shared_ptr<detail::pipeline_state> state,
+                std::shared_ptr<detail::pipeline_queue<T> > first,
+                std::shared_ptr<detail::pipeline_queue<U> > last,
+                std::vector<starter_type> starters)
+          : state_(std::move(state)), first_(std::move(first)),
+            last_(std::move(last)), starters_(std::move(starters))
+        {}
+
+    public:
+        // create the builder of an empty pipeline
+        explicit pipeline_builder(std::shared_ptr<detail::pipeline_state> state)
+          : state_(std::move(state)),
+            first_(std::make_shared<detail::pipeline_queue<T> >(
+                state_->capacity())),
+            last_(first_)
+        {}
+
+        /// Append a stage applying \a f to each item. The stage runs
+        /// \a parallelism workers, each processing one batch at a time.
+        /// The statistics of the stage are registered as
+        /// <pipeline-name>/<name> if the pipeline has a name.
+        template <typename F,
+            typename R = typename hpx::util::decay<
+                typename hpx::util::invoke_result<F, U>::type
+            >::type>
+        pipeline_builder<T, R> stage(std::string const& name,
+            pipeline_mode mode, std::size_t parallelism, F && f) const
+        {
+            typedef detail::pipeline_stage<
+                    U, R, typename hpx::util::decay<F>::type
+                > stage_type;
+
+            auto output = std::make_shared<detail::pipeline_queue<R> >(
+                state_->capacity());
+            auto stage = std::make_shared<stage_type>(state_, last_, output,
+                std::forward<F>(f), mode, parallelism,
+                state_->stage_name(name, starters_.size()));
+
+            std::vector<starter_type> starters = starters_;
+            starters.push_back(
+                [stage](std::vector<hpx::future<void> >& workers)
+                {
+                    stage_type::start(stage, workers);
+                });
+
+            return pipeline_builder<T, R>(
+                state_, first_, std::move(output), std::move(starters));
+        }
+
+        template <typename F>
+        auto stage(pipeline_mode mode, std::size_t parallelism, F && f) const
+        ->  decltype(this->stage(std::string(), mode, parallelism,
+                std::forward<F>(f)))
+        {
+            return stage(std::string(), mode, parallelism, std::forward<F>(f));
+        }
+
+        template <typename F>
+        auto stage(F && f) const
+        ->  decltype(this->stage(std::string(), pipeline_mode::ordered,
+                std::size_t(1), std::forward<F>(f)))
+        {
+            return stage(std::string(), pipeline_mode::ordered, 1,
+                std::forward<F>(f));
+        }
+
+        /// Complete the pipeline with a stage invoking \a f for each item
+        /// and launch the workers of all stages. An ordered sink invokes
+        /// \a f for one item at a time, in the order the items were pushed.
+        template <typename F>
+        pipeline<T> sink(std::string const& name, pipeline_mode mode,
+            std::size_t parallelism, F && f) const
+        {
+            typedef detail::pipeline_sink<
+                    U, typename hpx::util::decay<F>::type
+                > sink_type;
+
+            auto sink = std::make_shared<sink_type>(state_, last_,
+                std::forward<F>(f), mode, parallelism,
+                state_->stage_name(name, starters_.size()));
+
+            auto source = std::make_shared<detail::pipeline_source<T> >(
+                first_, state_->batch_size());
+            detail::pipeline_source<T>::set_idle_handler(source);
+
+            std::vector<hpx::future<void> > workers;
+            for (starter_type const& start : starters_)
+                start(workers);
+            sink_type::start(sink, workers);
+
+            return pipeline<T>(state_, std::move(source), std::move(workers));
+        }
+
+        template <typename F>
+        pipeline<T> sink(pipeline_mode mode, std::size_t parallelism,
+            F && f) const
+        {
+            return sink(std::string(), mode, parallelism, std::forward<F>(f));
+        }
+
+        template <typename F>
+        pipeline<T> sink(F && f) const
+        {
+            return sink(std::string(), pipeline_mode::ordered, 1,
+                std::forward<F>(f));
+        }
+
+    private:
+        std::shared_ptr<detail::pipeline_state> state_;
+        std::shared_ptr<detail::pipeline_queue<T> > first_;
+        std::shared_ptr<detail::pipeline_queue<U> > last_;
+        std::vector<starter_type> starters_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Start building a pipeline accepting items of type \a T. The workers
+    /// of the stages are run on the executor of the given execution policy.
+    ///
+    /// \param name         The name of the pipeline. The statistics of the
+    ///                     stages of named pipelines are exposed through the
+    ///                     performance counters /pipeline/count/processed and
+    ///                     /pipeline/queue/length.
+    /// \param batch_size   The (maximum) number of items passed between the
+    ///                     stages at once. Partial batches are passed on
+    ///                     whenever the first stage runs out of work.
+    /// \param capacity     The number of batches which can be queued in front
+    ///                     of each stage before the preceding stage is
+    ///                     suspended.
+    ///
+    /// \code
+    ///     auto p = make_pipeline<int>(par, "squares", 16)
+    ///         .stage("square", pipeline_mode::unordered, 4,
+    ///             [](int i) { return i * i; })
+    ///         .sink("print", pipeline_mode::ordered, 1,
+    ///             [](int i) { std::cout << i << '\n'; });
+    ///
+    ///     for (int i = 0; i != 1000; ++i)
+    ///         p.push(i);
+    ///     p.wait();
+    /// \endcode
+    template <typename T, typename ExPolicy>
+    typename std::enable_if<
+        parallel::execution::is_execution_policy<ExPolicy>::value,
+        pipeline_builder<T, T>
+    >::type
+    make_pipeline(ExPolicy && policy, std::string name = std::string(),
+        std::size_t batch_size = 1, std::size_t capacity = 16)
+    {
+        return pipeline_builder<T, T>(
+            std::make_shared<detail::pipeline_state>(policy.executor(),
+                std::move(name), batch_size, capacity));
+    }
+
+    template <typename T>
+    pipeline_builder<T, T>
+    make_pipeline(std::string name = std::string(),
+        std::size_t batch_size = 1, std::size_t capacity = 16)
+    {
+        return make_pipeline<T>(parallel::execution::par, std::move(name),
+            batch_size, capacity);
+    }
+}}}
+
+#endif
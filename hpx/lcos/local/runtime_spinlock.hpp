@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_RUNTIME_SPINLOCK_HPP)
+#define HPX_LCOS_LOCAL_RUNTIME_SPINLOCK_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MCS_SPINLOCK)
+#include <hpx/lcos/local/mcs_spinlock.hpp>
+#else
+#include <hpx/lcos/local/spinlock.hpp>
+#endif
+
+namespace hpx { namespace lcos { namespace local
+{
+    /// The lock type used to protect (potentially heavily contended) internal
+    /// data structures of the runtime system. This is either the plain
+    /// test-and-set spinlock or the queued mcs_spinlock, depending on
+    /// HPX_WITH_MCS_SPINLOCK.
+#if defined(HPX_HAVE_MCS_SPINLOCK)
+    typedef mcs_spinlock runtime_spinlock;
+#else
+    typedef spinlock runtime_spinlock;
+#endif
+}}}
+
+#endif
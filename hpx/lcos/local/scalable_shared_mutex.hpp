@@ -0,0 +1,230 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_HPP)
+#define HPX_LCOS_LOCAL_SCALABLE_SHARED_MUTEX_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A reader-writer lock optimized for read-mostly data. Each worker thread
+    // announces its readers in a separate (cache line sized) reader slot,
+    // thus readers running on different cores do not contend with each
+    // other. Acquiring the lock exclusively is comparatively expensive as
+    // all reader slots have to be inspected.
+    //
+    // HPX threads which have to wait for the lock to become available are
+    // suspended. By default the lock prefers readers, i.e. new readers may
+    // enter while a writer is waiting for the lock. If writer preference is
+    // requested, a waiting writer blocks all new readers instead.
+    class scalable_shared_mutex
+    {
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        static std::size_t const cache_line_size = 64;
+
+        struct reader_slot
+        {
+            reader_slot() : count_(0) {}
+
+            // The number of readers which have entered through this slot.
+            // Readers may leave through a different slot (if they were
+            // moved to a different core in the meantime), only the sum
+            // over all slots is meaningful.
+            std::atomic<std::size_t> count_;
+            char pad_[cache_line_size - sizeof(std::atomic<std::size_t>)];
+        };
+
+        enum writer_state
+        {
+            no_writer = 0,
+            writer_pending = 1,     // writer is waiting for readers to leave
+            writer_active = 2       // writer owns the lock
+        };
+
+        static std::size_t round_to_power_of_two(std::size_t size)
+        {
+            std::size_t result = 1;
+            while (result < size)
+                result <<= 1;
+            return result;
+        }
+
+    public:
+        HPX_NON_COPYABLE(scalable_shared_mutex);
+
+    public:
+        explicit scalable_shared_mutex(bool writer_preference = false)
+          : mask_(round_to_power_of_two(threads::hardware_concurrency()) - 1),
+            slots_(new reader_slot[mask_ + 1]),
+            writer_(no_writer),
+            writer_preference_(writer_preference)
+        {}
+
+        ///////////////////////////////////////////////////////////////////////
+        void lock_shared()
+        {
+            for (;;)
+            {
+                std::atomic<std::size_t>& count = get_slot();
+                count.fetch_add(1, std::memory_order_seq_cst);
+
+                if (!readers_blocked(writer_.load(std::memory_order_seq_cst)))
+                    return;
+
+                // back off and wait for the writer to release the lock
+                count.fetch_sub(1, std::memory_order_release);
+
+                std::unique_lock<mutex_type> l(mtx_);
+                while (readers_blocked(writer_.load(std::memory_order_relaxed)))
+                {
+                    readers_cond_.wait(l,
+                        "scalable_shared_mutex::lock_shared");
+                }
+            }
+        }
+
+        bool try_lock_shared()
+        {
+            std::atomic<std::size_t>& count = get_slot();
+            count.fetch_add(1, std::memory_order_seq_cst);
+
+            if (!readers_blocked(writer_.load(std::memory_order_seq_cst)))
+                return true;
+
+            count.fetch_sub(1, std::memory_order_release);
+            return false;
+        }
+
+        void unlock_shared()
+        {
+            get_slot().fetch_sub(1, std::memory_order_release);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void lock()
+        {
+            // wait for other writers to leave
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (writer_.load(std::memory_order_relaxed) != no_writer)
+                {
+                    writers_cond_.wait(l, "scalable_shared_mutex::lock");
+                }
+                writer_.store(writer_pending, std::memory_order_seq_cst);
+            }
+
+            for (std::size_t k = 0; /**/; ++k)
+            {
+                // wait for all readers to leave, readers are not able to
+                // notify the writer, so we have to poll
+                for (/**/; readers_active(); ++k)
+                {
+                    util::detail::yield_k(k, "scalable_shared_mutex::lock");
+                }
+
+                if (writer_preference_)
+                {
+                    // no new readers have been admitted in the meantime
+                    writer_.store(writer_active, std::memory_order_seq_cst);
+                    return;
+                }
+
+                // new readers may have entered while we were checking, make
+                // sure they see the writer before trying again
+                writer_.store(writer_active, std::memory_order_seq_cst);
+                if (!readers_active())
+                    return;
+
+                // let the readers in which have backed off in the meantime
+                std::unique_lock<mutex_type> l(mtx_);
+                writer_.store(writer_pending, std::memory_order_seq_cst);
+                readers_cond_.notify_all(std::move(l));
+            }
+        }
+
+        bool try_lock()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (writer_.load(std::memory_order_relaxed) != no_writer)
+                return false;
+
+            writer_.store(writer_pending, std::memory_order_seq_cst);
+            if (!readers_active())
+            {
+                writer_.store(writer_active, std::memory_order_seq_cst);
+                return true;
+            }
+
+            // readers and writers may have started waiting in the meantime
+            writer_.store(no_writer, std::memory_order_seq_cst);
+            release_waiters(std::move(l));
+            return false;
+        }
+
+        void unlock()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            writer_.store(no_writer, std::memory_order_seq_cst);
+            release_waiters(std::move(l));
+        }
+
+    private:
+        std::atomic<std::size_t>& get_slot()
+        {
+            // threads not managed by HPX all share the last slot
+            return slots_[hpx::get_worker_thread_num() & mask_].count_;
+        }
+
+        bool readers_blocked(int state) const
+        {
+            return state == writer_active ||
+                (state == writer_pending && writer_preference_);
+        }
+
+        bool readers_active() const
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+                count += slots_[i].count_.load(std::memory_order_seq_cst);
+            return count != 0;
+        }
+
+        void release_waiters(std::unique_lock<mutex_type> l)
+        {
+            writers_cond_.notify_one(std::move(l));
+
+            l = std::unique_lock<mutex_type>(mtx_);
+            readers_cond_.notify_all(std::move(l));
+        }
+
+    private:
+        std::size_t const mask_;
+        std::unique_ptr<reader_slot[]> slots_;
+
+        std::atomic<int> writer_;
+        bool const writer_preference_;
+
+        mutex_type mtx_;
+        detail::condition_variable readers_cond_;
+        detail::condition_variable writers_cond_;
+    };
+}}}
+
+#endif
@@ -7,6 +7,7 @@
 #define HPX_LCOS_SLIDING_SEMAPHORE_AUG_25_2016_1028AM
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/detail/sliding_semaphore.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 
@@ -89,6 +90,22 @@ namespace hpx { namespace lcos { namespace local
             return sem_.try_wait(l, upper_limit);
         }
 
+        /// \brief Asynchronously wait for the semaphore to be signaled
+        ///
+        /// \param upper_limit [in] The new upper limit.
+        ///           The returned future becomes ready once the difference
+        ///           between this value and the largest lower_limit which was
+        ///           set by signal() is not larger than the max_difference.
+        ///
+        /// \returns  A future which becomes ready once the calling thread
+        ///           would not block if it was calling wait(). The calling
+        ///           thread is not suspended.
+        future<void> async_acquire(std::int64_t upper_limit)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            return sem_.async_wait(l, upper_limit);
+        }
+
         /// \brief Signal the semaphore
         ///
         /// \param lower_limit  [in] The new lower limit. This will update the
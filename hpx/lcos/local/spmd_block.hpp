@@ -9,6 +9,7 @@
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/barrier.hpp>
 #include <hpx/lcos/local/mutex.hpp>
+#include <hpx/lcos/local/tree_barrier.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/traits/is_execution_policy.hpp>
 #include <hpx/traits/is_iterator.hpp>
@@ -42,13 +43,14 @@ namespace hpx { namespace lcos { namespace local
     {
     private:
         using barrier_type = hpx::lcos::local::barrier;
+        using all_barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
 
     public:
         explicit spmd_block(std::size_t num_images, std::size_t image_id,
-            barrier_type & barrier,table_type & barriers, mutex_type & mtx)
+            all_barrier_type & barrier,table_type & barriers, mutex_type & mtx)
         : num_images_(num_images), image_id_(image_id), barrier_(barrier),
             barriers_(barriers), mtx_(mtx)
         {}
@@ -74,7 +76,7 @@ namespace hpx { namespace lcos { namespace local
 
         void sync_all() const
         {
-           barrier_.get().wait();
+           barrier_.get().wait(image_id_);
         }
 
         void sync_images(std::set<std::size_t> const & images) const
@@ -133,7 +135,7 @@ namespace hpx { namespace lcos { namespace local
     private:
         std::size_t num_images_;
         std::size_t image_id_;
-        mutable std::reference_wrapper<barrier_type> barrier_;
+        mutable std::reference_wrapper<all_barrier_type> barrier_;
         mutable std::reference_wrapper<table_type> barriers_;
         mutable std::reference_wrapper<mutex_type> mtx_;
     };
@@ -145,12 +147,13 @@ namespace hpx { namespace lcos { namespace local
         {
         private:
             using barrier_type = hpx::lcos::local::barrier;
+            using all_barrier_type = hpx::lcos::local::tree_barrier;
             using table_type =
                 std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
             using mutex_type = hpx::lcos::local::mutex;
 
         public:
-            std::shared_ptr<barrier_type> barrier_;
+            std::shared_ptr<all_barrier_type> barrier_;
             std::shared_ptr<table_type> barriers_;
             std::shared_ptr<mutex_type> mtx_;
             typename std::decay<F>::type f_;
@@ -187,6 +190,7 @@ namespace hpx { namespace lcos { namespace local
             typename hpx::util::decay<ExPolicy>::type::executor_type;
 
         using barrier_type = hpx::lcos::local::barrier;
+        using all_barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
@@ -195,8 +199,8 @@ namespace hpx { namespace lcos { namespace local
             "define_spmd_block() needs a function or lambda that " \
             "has at least a local spmd_block as 1st argument");
 
-        std::shared_ptr<barrier_type> barrier
-            = std::make_shared<barrier_type>(num_images);
+        std::shared_ptr<all_barrier_type> barrier
+            = std::make_shared<all_barrier_type>(num_images);
         std::shared_ptr<table_type> barriers
             = std::make_shared<table_type>();
         std::shared_ptr<mutex_type> mtx
@@ -234,6 +238,7 @@ namespace hpx { namespace lcos { namespace local
             typename hpx::util::decay<ExPolicy>::type::executor_type;
 
         using barrier_type = hpx::lcos::local::barrier;
+        using all_barrier_type = hpx::lcos::local::tree_barrier;
         using table_type =
             std::map<std::set<std::size_t>,std::shared_ptr<barrier_type>>;
         using mutex_type = hpx::lcos::local::mutex;
@@ -242,8 +247,8 @@ namespace hpx { namespace lcos { namespace local
             "define_spmd_block() needs a lambda that " \
             "has at least a spmd_block as 1st argument");
 
-        std::shared_ptr<barrier_type> barrier
-            = std::make_shared<barrier_type>(num_images);
+        std::shared_ptr<all_barrier_type> barrier
+            = std::make_shared<all_barrier_type>(num_images);
         std::shared_ptr<table_type> barriers
             = std::make_shared<table_type>();
         std::shared_ptr<mutex_type> mtx
@@ -0,0 +1,68 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_TREE_BARRIER_HPP)
+#define HPX_LCOS_LOCAL_TREE_BARRIER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/combining_tree.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// A tree_barrier can be used to synchronize a specific number of
+    /// threads, blocking all of the entering threads until all of the threads
+    /// have entered the barrier. Each of the threads has to identify itself
+    /// by a unique participant number in the range [0, number_of_threads).
+    ///
+    /// In contrast to \a barrier, the arrival of the threads is counted using
+    /// a combining tree, which avoids serializing all threads on a single
+    /// lock. Waiting threads spin for a short period of time before they are
+    /// suspended.
+    ///
+    /// \note   The barrier must not be destroyed before all threads have
+    ///         returned from \a wait.
+    class tree_barrier
+    {
+    public:
+        HPX_NON_COPYABLE(tree_barrier);
+
+    public:
+        explicit tree_barrier(std::size_t number_of_threads,
+                std::size_t fan_in = 4)
+          : tree_(number_of_threads, fan_in)
+        {}
+
+        std::size_t size() const
+        {
+            return tree_.size();
+        }
+
+        /// The function \a wait will block the number of entering \a threads
+        /// (as given by the constructor parameter \a number_of_threads),
+        /// releasing all waiting threads as soon as the last \a thread
+        /// entered this function.
+        ///
+        /// \param participant  [in] The number identifying the calling
+        ///                     thread, each thread has to use a different
+        ///                     number in the range [0, number_of_threads).
+        void wait(std::size_t participant)
+        {
+            std::size_t const generation = flag_.generation();
+            if (tree_.arrive(participant, true))
+                flag_.release();
+            else
+                flag_.wait(generation, "tree_barrier::wait");
+        }
+
+    private:
+        detail::combining_tree tree_;
+        detail::release_flag flag_;
+    };
+}}}
+
+#endif
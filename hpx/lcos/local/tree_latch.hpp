@@ -0,0 +1,75 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_TREE_LATCH_HPP)
+#define HPX_LCOS_LOCAL_TREE_LATCH_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/combining_tree.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// A tree_latch is a single-use synchronization primitive which allows
+    /// one or more threads to wait for a fixed number of participants to
+    /// arrive. Each of the participants has to identify itself by a unique
+    /// number in the range [0, count) and has to count down exactly once.
+    ///
+    /// In contrast to \a latch, the arrival of the participants is counted
+    /// using a combining tree, which avoids serializing all participants on
+    /// a single lock. Waiting threads spin for a short period of time before
+    /// they are suspended.
+    class tree_latch
+    {
+    public:
+        HPX_NON_COPYABLE(tree_latch);
+
+    public:
+        explicit tree_latch(std::size_t count, std::size_t fan_in = 4)
+          : tree_(count, fan_in)
+        {
+            if (count == 0)
+                flag_.release();
+        }
+
+        /// Decrements the counter by one on behalf of the given participant.
+        /// Releases all waiting threads if this was the last participant to
+        /// arrive.
+        void count_down(std::size_t participant)
+        {
+            if (tree_.arrive(participant, false))
+                flag_.release();
+        }
+
+        /// Decrements the counter by one on behalf of the given participant
+        /// and blocks until all participants have arrived.
+        void count_down_and_wait(std::size_t participant)
+        {
+            count_down(participant);
+            wait();
+        }
+
+        /// Returns true if all participants have arrived.
+        bool is_ready() const
+        {
+            return flag_.generation() != 0;
+        }
+
+        /// Blocks until all participants have arrived.
+        void wait()
+        {
+            if (!is_ready())
+                flag_.wait(0, "tree_latch::wait");
+        }
+
+    private:
+        detail::combining_tree tree_;
+        detail::release_flag flag_;
+    };
+}}}
+
+#endif
@@ -147,6 +147,9 @@ namespace hpx
 #include <hpx/util/pack_traversal_async.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <boost/intrusive_ptr.hpp>
+
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -224,6 +227,102 @@ namespace hpx { namespace lcos
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Join on a homogeneous range of futures. A continuation is attached
+        // to all of the futures at once, the last one to become ready makes
+        // the frame ready. The continuations refer to the frame through a
+        // plain pointer which avoids any allocation for them.
+        template <typename Container>
+        class when_all_range_frame : public future_data<Container>
+        {
+        public:
+            typedef Container result_type;
+            typedef hpx::lcos::future<result_type> type;
+            typedef hpx::lcos::detail::future_data<result_type> base_type;
+
+        private:
+            struct on_ready
+            {
+                void operator()() const
+                {
+                    frame_->decrement(1);
+                }
+
+                when_all_range_frame* frame_;
+            };
+
+        public:
+            when_all_range_frame(Container && values,
+                    typename base_type::init_no_addref no_addref)
+              : base_type(no_addref), values_(std::move(values)), count_(0)
+            {}
+
+            void attach()
+            {
+                // The frame keeps itself alive until all futures are ready.
+                // The additional count protects against the frame becoming
+                // ready before all continuations are attached.
+                intrusive_ptr_add_ref(this);
+                count_.store(values_.size() + 1, std::memory_order_relaxed);
+
+                std::size_t ready = 1;
+                for (auto& f : values_)
+                {
+                    auto const& state = traits::detail::get_shared_state(f);
+                    if (state.get() == nullptr || state->is_ready())
+                    {
+                        ++ready;
+                        continue;
+                    }
+
+                    state->execute_deferred();
+
+                    // execute_deferred might have made the future ready
+                    if (state->is_ready())
+                    {
+                        ++ready;
+                        continue;
+                    }
+
+                    state->set_on_completed(on_ready{this});
+                }
+
+                decrement(ready);
+            }
+
+        private:
+            void decrement(std::size_t count)
+            {
+                if (count_.fetch_sub(count, std::memory_order_acq_rel) ==
+                    count)
+                {
+                    this->set_value(std::move(values_));
+                    intrusive_ptr_release(this);
+                }
+            }
+
+            Container values_;
+            std::atomic<std::size_t> count_;
+        };
+
+        template <typename Container>
+        typename when_all_range_frame<Container>::type
+        when_all_range_impl(Container && values)
+        {
+            typedef when_all_range_frame<Container> frame_type;
+
+            typename frame_type::base_type::init_no_addref no_addref;
+
+            boost::intrusive_ptr<frame_type> frame(
+                new frame_type(std::move(values), no_addref), false);
+            frame->attach();
+
+            using traits::future_access;
+            return future_access<typename frame_type::type>::create(
+                std::move(frame));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
         template <typename... T>
         typename detail::async_when_all_frame<
             util::tuple<
@@ -248,6 +347,22 @@ namespace hpx { namespace lcos
             return future_access<typename frame_type::type>::create(
                 std::move(frame));
         }
+
+        // a single range of futures is joined using the specialized frame
+        template <typename T>
+        typename std::enable_if<
+            traits::is_future_range<
+                typename traits::acquire_future<T>::type
+            >::value,
+            typename when_all_range_frame<
+                typename traits::acquire_future<T>::type
+            >::type
+        >::type
+        when_all_impl(T&& values)
+        {
+            traits::acquire_future_disp func;
+            return when_all_range_impl(func(std::forward<T>(values)));
+        }
     }
 
     template <typename First, typename Second>
@@ -263,7 +378,7 @@ namespace hpx { namespace lcos
             typename detail::future_iterator_traits<Iterator>::type>>
     future<Container> when_all(Iterator begin, Iterator end)
     {
-        return detail::when_all_impl(
+        return detail::when_all_range_impl(
             detail::acquire_future_iterators<Iterator, Container>(begin, end));
     }
 
@@ -280,7 +395,7 @@ namespace hpx { namespace lcos
             typename lcos::detail::future_iterator_traits<Iterator>::type>>
     lcos::future<Container> when_all_n(Iterator begin, std::size_t count)
     {
-        return detail::when_all_impl(
+        return detail::when_all_range_impl(
             detail::acquire_future_n<Iterator, Container>(begin, count));
     }
 
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/zip_iterator.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -103,6 +104,51 @@ namespace hpx { namespace parallel { inline namespace v1
                     });
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter2>::type
+        adjacent_difference_(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 dest, Op && op, std::false_type)
+        {
+#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
+            static_assert(
+                (hpx::traits::is_input_iterator<FwdIter1>::value),
+                "Requires at least input iterator.");
+            static_assert(
+                (hpx::traits::is_output_iterator<FwdIter2>::value ||
+                    hpx::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least output iterator.");
+
+            typedef std::integral_constant<bool,
+                    execution::is_sequenced_execution_policy<ExPolicy>::value ||
+                   !hpx::traits::is_forward_iterator<FwdIter2>::value ||
+                   !hpx::traits::is_forward_iterator<FwdIter1>::value
+                > is_seq;
+#else
+            static_assert(
+                (hpx::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert(
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+#endif
+
+            return detail::adjacent_difference<FwdIter2>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first, last, dest,
+                std::forward<Op>(op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter2>::type
+        adjacent_difference_(ExPolicy&& policy, SegIter1 first, SegIter1 last,
+            SegIter2 dest, Op && op, std::true_type);
         /// \endcond
     }
     ////////////////////////////////////////////////////////////////////////////
@@ -168,34 +214,14 @@ namespace hpx { namespace parallel { inline namespace v1
     {
         typedef typename std::iterator_traits<FwdIter1>::value_type value_type;
 
-#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter1>::value),
-            "Requires at least input iterator.");
-        static_assert(
-            (hpx::traits::is_output_iterator<FwdIter2>::value ||
-                hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least output iterator.");
-
         typedef std::integral_constant<bool,
-                execution::is_sequenced_execution_policy<ExPolicy>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter2>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter1>::value
-            > is_seq;
-#else
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter1>::value),
-            "Requires at least forward iterator.");
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least forward iterator.");
+                hpx::traits::is_segmented_iterator<FwdIter1>::value &&
+                hpx::traits::is_segmented_iterator<FwdIter2>::value
+            > is_segmented;
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
-#endif
-
-        return detail::adjacent_difference<FwdIter2>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first, last, dest,
-            std::minus<value_type>());
+        return detail::adjacent_difference_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::minus<value_type>(), is_segmented());
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -272,34 +298,14 @@ namespace hpx { namespace parallel { inline namespace v1
     adjacent_difference(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
         FwdIter2 dest, Op && op)
     {
-#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter1>::value),
-            "Requires at least input iterator.");
-        static_assert(
-            (hpx::traits::is_output_iterator<FwdIter2>::value ||
-                hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least output iterator.");
-
         typedef std::integral_constant<bool,
-                execution::is_sequenced_execution_policy<ExPolicy>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter2>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter1>::value
-            > is_seq;
-#else
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter1>::value),
-            "Requires at least forward iterator.");
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least forward iterator.");
-
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
-#endif
+                hpx::traits::is_segmented_iterator<FwdIter1>::value &&
+                hpx::traits::is_segmented_iterator<FwdIter2>::value
+            > is_segmented;
 
-        return detail::adjacent_difference<FwdIter2>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first, last, dest,
-            std::forward<Op>(op));
+        return detail::adjacent_difference_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::forward<Op>(op), is_segmented());
     }
 }}}
 
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
@@ -101,6 +102,26 @@ namespace hpx { namespace parallel { inline namespace v1
                         });
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        adjacent_find_(ExPolicy && policy, FwdIter first, FwdIter last,
+            Pred && op, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::adjacent_find<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<Pred>(op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        adjacent_find_(ExPolicy && policy, SegIter first, SegIter last,
+            Pred && op, std::true_type);
         /// \endcond
     }
 
@@ -180,11 +201,11 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_forward_iterator<FwdIter>::value),
             "Requires at least a forward iterator");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
 
-        return detail::adjacent_find<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<Pred>(op));
+        return detail::adjacent_find_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<Pred>(op), is_segmented());
     }
 }}}
 
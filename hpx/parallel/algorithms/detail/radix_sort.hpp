@@ -0,0 +1,552 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/detail/radix_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_parameters.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // Number of bits sorted by each pass of the radix sort and the resulting
+    // number of buckets.
+    static const std::size_t radix_sort_bits = 8;
+    static const std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_bits;
+
+    // Number of elements collected for each bucket before they are written
+    // to their destination (write-combining), this keeps the scatter from
+    // touching a different cache line for every element.
+    static const std::size_t radix_sort_block = 16;
+
+    // Sequences shorter than this are handled by std::sort.
+    static const std::size_t radix_sort_limit = 1024ul;
+
+    // Minimal number of elements handled by a single task, shorter sequences
+    // are sorted without spawning any tasks.
+    static const std::size_t radix_sort_min_chunk = 16384ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps the arithmetic sort keys onto unsigned integers of the same size
+    // such that the order of the integers matches the order of the keys.
+    template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static const bool value = false;
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value
+        >::type>
+    {
+        static const bool value = true;
+
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type call(T value)
+        {
+            // flip the sign bit for signed types to order negative values
+            // before the positive ones
+            return std::is_signed<T>::value ?
+                type(type(value) ^
+                    (type(1) << (std::numeric_limits<type>::digits - 1))) :
+                type(value);
+        }
+    };
+
+    template <typename T, typename Bits>
+    struct radix_float_key_traits
+    {
+        static const bool value = true;
+
+        typedef Bits type;
+
+        static type call(T value)
+        {
+            type bits;
+            std::memcpy(&bits, &value, sizeof(type));
+
+            // negative values are ordered in reverse, positive values have
+            // to be moved past the negative ones
+            type const sign =
+                type(1) << (std::numeric_limits<type>::digits - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+            typename std::enable_if<
+                std::is_same<T, float>::value &&
+                std::numeric_limits<float>::is_iec559 &&
+                sizeof(float) == sizeof(std::uint32_t)
+            >::type>
+      : radix_float_key_traits<float, std::uint32_t>
+    {};
+
+    template <typename T>
+    struct radix_key_traits<T,
+            typename std::enable_if<
+                std::is_same<T, double>::value &&
+                std::numeric_limits<double>::is_iec559 &&
+                sizeof(double) == sizeof(std::uint64_t)
+            >::type>
+      : radix_float_key_traits<double, std::uint64_t>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Projections which are known to return the sort key of an element
+    // without side effects.
+    template <typename Proj>
+    struct is_radix_projection
+      : std::false_type
+    {};
+
+    template <>
+    struct is_radix_projection<util::projection_identity>
+      : std::true_type
+    {};
+
+    // Comparison function objects the radix sort can stand in for: 1 for
+    // ascending, -1 for descending order, 0 otherwise.
+    template <typename Compare, typename Key>
+    struct radix_sort_order
+      : std::integral_constant<int, 0>
+    {};
+
+    template <typename Key>
+    struct radix_sort_order<detail::less, Key>
+      : std::integral_constant<int, 1>
+    {};
+
+    template <typename Key>
+    struct radix_sort_order<std::less<Key>, Key>
+      : std::integral_constant<int, 1>
+    {};
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<Key>, Key>
+      : std::integral_constant<int, -1>
+    {};
+
+#if defined(__cpp_lib_transparent_operators)
+    template <typename Key>
+    struct radix_sort_order<std::less<void>, Key>
+      : std::integral_constant<int, 1>
+    {};
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<void>, Key>
+      : std::integral_constant<int, -1>
+    {};
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort is used instead of the comparison based sort if the
+    // projected key is arithmetic and is compared using (the equivalent of)
+    // std::less or std::greater.
+    template <typename Iter, typename Compare, typename Proj,
+        typename Enable = void>
+    struct is_radix_sortable
+      : std::false_type
+    {};
+
+    template <typename Iter, typename Compare, typename Proj>
+    struct is_radix_sortable<Iter, Compare, Proj,
+            typename std::enable_if<
+                hpx::traits::is_random_access_iterator<Iter>::value &&
+                is_radix_projection<
+                    typename hpx::util::decay<Proj>::type
+                >::value
+            >::type>
+      : std::integral_constant<bool,
+            radix_key_traits<
+                typename hpx::util::decay<
+                    typename traits::projected_result_of<
+                        typename hpx::util::decay<Proj>::type, Iter
+                    >::type
+                >::type
+            >::value &&
+            radix_sort_order<
+                typename hpx::util::decay<Compare>::type,
+                typename hpx::util::decay<
+                    typename traits::projected_result_of<
+                        typename hpx::util::decay<Proj>::type, Iter
+                    >::type
+                >::type
+            >::value != 0 &&
+            std::is_default_constructible<
+                typename std::iterator_traits<Iter>::value_type
+            >::value>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extracts the (order preserving) unsigned radix key from an element.
+    template <typename Key, bool Descending, typename Proj>
+    struct radix_key
+    {
+        typedef radix_key_traits<Key> key_traits;
+        typedef typename key_traits::type type;
+
+        template <typename T>
+        type operator()(T const& t) const
+        {
+            type key = key_traits::call(hpx::util::invoke(proj_, t));
+            return Descending ? type(~key) : key;
+        }
+
+        Proj proj_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invokes f(i) for each chunk index i concurrently, rethrowing any of the
+    // exceptions thrown by f.
+    template <typename ExPolicy, typename F>
+    void sort_for_each_chunk(ExPolicy& policy, std::size_t chunks,
+        F const& f)
+    {
+        if (chunks == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        std::vector<hpx::future<void> > workitems;
+        workitems.reserve(chunks);
+
+        for (std::size_t i = 0; i != chunks; ++i)
+        {
+            workitems.push_back(
+                execution::async_execute(policy.executor(), f, i));
+        }
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+    }
+
+    // Moves the elements of the given chunk of [first, first + count) to
+    // their bucket in the destination sequence, starting at the positions
+    // in 'pos'. Elements are collected in small per-bucket blocks first.
+    template <typename SrcIter, typename DestIter, typename Key>
+    void radix_sort_scatter(SrcIter first, SrcIter last, DestIter dest,
+        std::size_t* pos, Key const& key, std::size_t shift)
+    {
+        typedef typename std::iterator_traits<SrcIter>::value_type value_type;
+
+        std::unique_ptr<value_type[]> blocks(
+            new value_type[radix_sort_buckets * radix_sort_block]);
+        std::array<std::size_t, radix_sort_buckets> fill;
+        fill.fill(0);
+
+        for (/**/; first != last; ++first)
+        {
+            std::size_t d =
+                std::size_t(key(*first) >> shift) & (radix_sort_buckets - 1);
+
+            value_type* block = blocks.get() + d * radix_sort_block;
+            block[fill[d]] = std::move(*first);
+
+            if (++fill[d] == radix_sort_block)
+            {
+                std::move(block, block + radix_sort_block, dest + pos[d]);
+                pos[d] += radix_sort_block;
+                fill[d] = 0;
+            }
+        }
+
+        for (std::size_t d = 0; d != radix_sort_buckets; ++d)
+        {
+            value_type* block = blocks.get() + d * radix_sort_block;
+            std::move(block, block + fill[d], dest + pos[d]);
+        }
+    }
+
+    // One pass of the LSD radix sort, moving [src, src + count) to 'dest'
+    // ordered by the digit starting at bit 'shift'.
+    template <typename ExPolicy, typename SrcIter, typename DestIter,
+        typename Key>
+    void radix_sort_pass(ExPolicy& policy, SrcIter src, DestIter dest,
+        std::size_t count, std::size_t chunks, Key const& key,
+        std::size_t shift)
+    {
+        std::size_t const chunk_size = (count + chunks - 1) / chunks;
+
+        // per chunk histograms: counts[c * radix_sort_buckets + d]
+        std::vector<std::size_t> counts(chunks * radix_sort_buckets, 0);
+
+        sort_for_each_chunk(policy, chunks,
+            [&](std::size_t c)
+            {
+                std::size_t* hist = counts.data() + c * radix_sort_buckets;
+
+                SrcIter it = src + c * chunk_size;
+                SrcIter end = src + (std::min)(count, (c + 1) * chunk_size);
+                for (/**/; it != end; ++it)
+                {
+                    ++hist[std::size_t(key(*it) >> shift) &
+                        (radix_sort_buckets - 1)];
+                }
+            });
+
+        // Turn the counts into the starting positions of each bucket for
+        // each chunk, i.e. an exclusive scan over the counts ordered by
+        // bucket first and chunk second. Each task scans a group of
+        // buckets, the bucket totals are combined sequentially afterwards.
+        std::vector<std::size_t> totals(radix_sort_buckets);
+        std::size_t const groups = (std::min)(chunks, radix_sort_buckets);
+        std::size_t const group_size =
+            (radix_sort_buckets + groups - 1) / groups;
+
+        sort_for_each_chunk(policy, groups,
+            [&](std::size_t g)
+            {
+                std::size_t const end =
+                    (std::min)(radix_sort_buckets, (g + 1) * group_size);
+                for (std::size_t d = g * group_size; d < end; ++d)
+                {
+                    std::size_t sum = 0;
+                    for (std::size_t c = 0; c != chunks; ++c)
+                    {
+                        std::size_t& cnt = counts[c * radix_sort_buckets + d];
+                        std::size_t n = cnt;
+                        cnt = sum;
+                        sum += n;
+                    }
+                    totals[d] = sum;
+                }
+            });
+
+        std::size_t base = 0;
+        for (std::size_t d = 0; d != radix_sort_buckets; ++d)
+        {
+            std::size_t n = totals[d];
+            totals[d] = base;
+            base += n;
+        }
+        HPX_ASSERT(base == count);
+
+        sort_for_each_chunk(policy, chunks,
+            [&](std::size_t c)
+            {
+                std::size_t* pos = counts.data() + c * radix_sort_buckets;
+                for (std::size_t d = 0; d != radix_sort_buckets; ++d)
+                    pos[d] += totals[d];
+
+                radix_sort_scatter(src + c * chunk_size,
+                    src + (std::min)(count, (c + 1) * chunk_size),
+                    dest, pos, key, shift);
+            });
+    }
+
+    // Sorts [first, last) using a least significant digit first radix sort
+    // which processes the sequence in 'chunks' concurrent pieces.
+    template <typename ExPolicy, typename RandIter, typename Key>
+    void radix_sort(ExPolicy& policy, RandIter first, RandIter last,
+        Key const& key, std::size_t chunks)
+    {
+        typedef typename std::iterator_traits<RandIter>::value_type
+            value_type;
+        typedef typename Key::type key_type;
+
+        std::size_t const count = std::size_t(last - first);
+        std::size_t const chunk_size = (count + chunks - 1) / chunks;
+
+        // Determine which of the key bits differ between the elements,
+        // passes over digits which are the same for all keys are skipped.
+        std::vector<key_type> and_masks(chunks, key_type(~key_type(0)));
+        std::vector<key_type> or_masks(chunks, key_type(0));
+
+        sort_for_each_chunk(policy, chunks,
+            [&](std::size_t c)
+            {
+                key_type and_mask = key_type(~key_type(0));
+                key_type or_mask = key_type(0);
+
+                RandIter it = first + c * chunk_size;
+                RandIter end = first + (std::min)(count, (c + 1) * chunk_size);
+                for (/**/; it != end; ++it)
+                {
+                    key_type k = key(*it);
+                    and_mask &= k;
+                    or_mask |= k;
+                }
+
+                and_masks[c] = and_mask;
+                or_masks[c] = or_mask;
+            });
+
+        key_type and_mask = key_type(~key_type(0));
+        key_type or_mask = key_type(0);
+        for (std::size_t c = 0; c != chunks; ++c)
+        {
+            and_mask &= and_masks[c];
+            or_mask |= or_masks[c];
+        }
+        key_type const differ = key_type(and_mask ^ or_mask);
+
+        std::unique_ptr<value_type[]> buffer(new value_type[count]);
+        bool in_buffer = false;
+
+        for (std::size_t shift = 0;
+             shift < std::size_t(std::numeric_limits<key_type>::digits);
+             shift += radix_sort_bits)
+        {
+            if ((std::size_t(differ >> shift) & (radix_sort_buckets - 1)) == 0)
+                continue;
+
+            if (in_buffer)
+            {
+                radix_sort_pass(policy, buffer.get(), first, count, chunks,
+                    key, shift);
+            }
+            else
+            {
+                radix_sort_pass(policy, first, buffer.get(), count, chunks,
+                    key, shift);
+            }
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+        {
+            sort_for_each_chunk(policy, chunks,
+                [&](std::size_t c)
+                {
+                    value_type* src = buffer.get() + c * chunk_size;
+                    std::move(src,
+                        buffer.get() + (std::min)(count, (c + 1) * chunk_size),
+                        first + c * chunk_size);
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Compare, typename Proj, typename Iter>
+    struct radix_key_type
+    {
+        typedef typename hpx::util::decay<Proj>::type projection_type;
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<
+                    projection_type, Iter
+                >::type
+            >::type key_type;
+
+        typedef radix_key<
+                key_type,
+                radix_sort_order<
+                    typename hpx::util::decay<Compare>::type, key_type
+                >::value < 0,
+                projection_type
+            > type;
+    };
+
+    template <typename ExPolicy, typename RandIter, typename Compare,
+        typename Proj>
+    RandIter sequential_radix_sort(ExPolicy& policy, RandIter first,
+        RandIter last, Compare && comp, Proj && proj)
+    {
+        if (std::size_t(last - first) < radix_sort_limit)
+        {
+            std::sort(first, last,
+                util::compare_projected<Compare, Proj>(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            return last;
+        }
+
+        typedef typename radix_key_type<Compare, Proj, RandIter>::type key;
+        radix_sort(policy, first, last, key{std::forward<Proj>(proj)}, 1);
+        return last;
+    }
+
+    template <typename ExPolicy, typename RandIter, typename Compare,
+        typename Proj>
+    hpx::future<RandIter>
+    parallel_radix_sort_async(ExPolicy && policy, RandIter first,
+        RandIter last, Compare && comp, Proj && proj)
+    {
+        std::size_t const count = std::size_t(last - first);
+        if (count < radix_sort_min_chunk)
+        {
+            try {
+                return hpx::make_ready_future(sequential_radix_sort(
+                    policy, first, last, std::forward<Compare>(comp),
+                    std::forward<Proj>(proj)));
+            }
+            catch (...) {
+                return detail::handle_exception<ExPolicy, RandIter>::call(
+                    std::current_exception());
+            }
+        }
+
+        typedef typename radix_key_type<Compare, Proj, RandIter>::type key;
+
+        return execution::async_execute(
+            policy.executor(),
+            [=](key const& k) mutable -> RandIter
+            {
+                try {
+                    std::size_t const cores =
+                        execution::processing_units_count(
+                            policy.executor(), policy.parameters());
+                    std::size_t const chunks = (std::max)(std::size_t(1),
+                        (std::min)(cores, count / radix_sort_min_chunk));
+
+                    radix_sort(policy, first, last, k, chunks);
+                    return last;
+                }
+                catch (...) {
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        std::current_exception());
+                }
+
+                // Not reachable.
+                HPX_ASSERT(false);
+            },
+            key{std::forward<Proj>(proj)});
+    }
+
+    /// \endcond
+}}}}
+
+#endif
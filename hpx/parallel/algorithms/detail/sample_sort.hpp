@@ -0,0 +1,462 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/detail/sample_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_SAMPLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_SAMPLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/compute/host/block_allocator.hpp>
+#include <hpx/compute/host/block_executor.hpp>
+#include <hpx/compute/host/numa_domains.hpp>
+#include <hpx/compute/host/target.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/traits/detail/wrap_int.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_parameters.hpp>
+#include <hpx/parallel/executors/parallel_executor.hpp>
+#include <hpx/parallel/executors/sample_sort_threshold.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // defined in parallel/algorithms/sort.hpp
+    template <typename ExPolicy, typename RandomIt, typename Compare>
+    hpx::future<RandomIt> sort_thread(ExPolicy& policy,
+        RandomIt first, RandomIt last, Compare comp);
+
+    // Number of samples taken per bucket to determine the splitters.
+    static const std::size_t sample_sort_oversampling = 32;
+
+    // Stride used to touch the pages of the bucket storage, this places
+    // each page onto the NUMA domain touching it first.
+    static const std::size_t sample_sort_page_size = 4096;
+
+    // The number of elements above which the sample sort is used can be
+    // customized using the execution::sample_sort_threshold parameters.
+    struct sample_sort_threshold_helper
+    {
+        template <typename Parameters>
+        static std::size_t
+        call(hpx::traits::detail::wrap_int, Parameters const&)
+        {
+            return execution::sample_sort_threshold()
+                .get_sample_sort_threshold();
+        }
+
+        template <typename Parameters>
+        static auto call(int, Parameters const& params)
+        ->  decltype(params.get_sample_sort_threshold())
+        {
+            return params.get_sample_sort_threshold();
+        }
+    };
+
+    template <typename Parameters>
+    std::size_t get_sample_sort_threshold(Parameters const& params)
+    {
+        return sample_sort_threshold_helper::call(0, params);
+    }
+
+    // The buckets are sorted by threads running on the NUMA domain
+    // holding their memory, unless a specific executor was requested.
+    template <typename ExPolicy, typename F>
+    hpx::future<void> sample_sort_bucket_execute(ExPolicy&,
+        compute::host::block_executor<>& exec, F && f, std::true_type)
+    {
+        return execution::async_execute(exec, std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename F>
+    hpx::future<void> sample_sort_bucket_execute(ExPolicy& policy,
+        compute::host::block_executor<>&, F && f, std::false_type)
+    {
+        return execution::async_execute(
+            policy.executor(), std::forward<F>(f));
+    }
+
+    // Uninitialized memory holding the buckets placed on one NUMA domain.
+    // The elements are constructed in place when they are moved to their
+    // bucket and destroyed after they have been moved back, also if sorting
+    // fails.
+    template <typename T>
+    class sample_sort_storage
+    {
+    public:
+        typedef compute::host::block_allocator<T> allocator_type;
+
+        sample_sort_storage(allocator_type const& alloc, std::size_t size)
+          : alloc_(alloc), size_(size),
+            data_(size != 0 ? alloc_.allocate(size) : nullptr)
+        {}
+
+        sample_sort_storage(sample_sort_storage && rhs)
+          : alloc_(rhs.alloc_), size_(rhs.size_), data_(rhs.data_)
+        {
+            rhs.size_ = 0;
+            rhs.data_ = nullptr;
+        }
+
+        ~sample_sort_storage()
+        {
+            if (data_ != nullptr)
+                alloc_.deallocate(data_, size_);
+        }
+
+        T* data() const { return data_; }
+        std::size_t size() const { return size_; }
+
+    private:
+        allocator_type alloc_;
+        std::size_t size_;
+        T* data_;
+    };
+
+    // Move the elements of [first, last) to dest and destroy them. All of
+    // the elements are destroyed even if moving one of them fails, in this
+    // case the remaining elements are not moved and the error is rethrown.
+    template <typename T, typename RandomIt>
+    void sample_sort_move_back(T* first, T* last, RandomIt dest)
+    {
+        std::exception_ptr e;
+        for (/**/; first != last; ++first, ++dest)
+        {
+            if (!e)
+            {
+                try {
+                    *dest = std::move(*first);
+                }
+                catch (...) {
+                    e = std::current_exception();
+                }
+            }
+            first->~T();
+        }
+
+        if (e)
+            std::rethrow_exception(e);
+    }
+
+    //------------------------------------------------------------------------
+    //  function : sample_sort
+    /// \brief sorts large sequences by distributing the elements onto
+    ///        one bucket per core using splitters selected from a random
+    ///        sample, the buckets are then sorted concurrently
+    //------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt, typename Compare>
+    RandomIt sample_sort(ExPolicy& policy, RandomIt first, RandomIt last,
+        Compare comp)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+        typedef sample_sort_storage<value_type> storage_type;
+        typedef typename storage_type::allocator_type allocator_type;
+        typedef std::is_same<
+                typename hpx::util::decay<
+                    decltype(policy.executor())
+                >::type,
+                execution::parallel_executor
+            > use_domain_executors;
+
+        std::size_t const count = std::size_t(last - first);
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+
+        std::vector<compute::host::target> domains =
+            compute::host::numa_domains();
+        std::size_t const num_domains = domains.size();
+        std::size_t const buckets = (std::max)(cores, num_domains);
+        std::size_t const chunks = cores;
+        std::size_t const chunk_size = (count + chunks - 1) / chunks;
+
+        // The elements are compared by their position in the sequence,
+        // this allows to refer to the splitters without copying them.
+        auto less = [&](std::size_t lhs, std::size_t rhs) -> bool
+            {
+                return comp(first[lhs], first[rhs]);
+            };
+
+        // select the splitters from a sorted random sample
+        std::vector<std::size_t> splitters;
+        {
+            std::minstd_rand gen(static_cast<unsigned int>(count));
+            std::uniform_int_distribution<std::size_t> dist(0, count - 1);
+
+            std::vector<std::size_t> samples(
+                buckets * sample_sort_oversampling);
+            for (std::size_t& s : samples)
+                s = dist(gen);
+            std::sort(samples.begin(), samples.end(), less);
+
+            splitters.reserve(buckets - 1);
+            for (std::size_t b = 1; b != buckets; ++b)
+                splitters.push_back(samples[b * sample_sort_oversampling]);
+        }
+
+        auto bucket_of = [&](std::size_t i) -> std::size_t
+            {
+                return std::upper_bound(
+                        splitters.begin(), splitters.end(), i, less
+                    ) - splitters.begin();
+            };
+
+        // Classify all elements before moving any of them, this keeps the
+        // splitters in place while they are compared against. Only moving
+        // the elements can fail afterwards.
+        HPX_ASSERT(buckets <= (std::numeric_limits<std::uint32_t>::max)());
+        std::vector<std::uint32_t> bucket_ids(count);
+
+        // count the elements of each bucket for each chunk:
+        // counts[c * buckets + b]
+        std::vector<std::size_t> counts(chunks * buckets, 0);
+
+        sort_for_each_chunk(policy, chunks,
+            [&](std::size_t c)
+            {
+                std::size_t* cnt = counts.data() + c * buckets;
+                std::size_t const end =
+                    (std::min)(count, (c + 1) * chunk_size);
+                for (std::size_t i = c * chunk_size; i < end; ++i)
+                {
+                    std::size_t const b = bucket_of(i);
+                    bucket_ids[i] = static_cast<std::uint32_t>(b);
+                    ++cnt[b];
+                }
+            });
+
+        // Turn the counts into the position of each chunk's elements
+        // inside its bucket and the position of each bucket inside the
+        // storage of its NUMA domain and inside the sorted sequence.
+        std::vector<std::size_t> bucket_size(buckets);
+        std::vector<std::size_t> bucket_start(buckets);
+        std::vector<std::size_t> bucket_offset(buckets);
+        std::vector<std::size_t> domain_size(num_domains, 0);
+
+        std::size_t start = 0;
+        for (std::size_t b = 0; b != buckets; ++b)
+        {
+            std::size_t sum = 0;
+            for (std::size_t c = 0; c != chunks; ++c)
+            {
+                std::size_t& cnt = counts[c * buckets + b];
+                std::size_t n = cnt;
+                cnt = sum;
+                sum += n;
+            }
+
+            std::size_t& size = domain_size[b * num_domains / buckets];
+            bucket_size[b] = sum;
+            bucket_start[b] = start;
+            bucket_offset[b] = size;
+
+            start += sum;
+            size += sum;
+        }
+        HPX_ASSERT(start == count);
+
+        // allocate the bucket storage on each of the NUMA domains, the
+        // pages are touched by a thread running on the domain
+        std::vector<storage_type> storage;
+        std::vector<compute::host::block_executor<> > executors;
+        storage.reserve(num_domains);
+        executors.reserve(num_domains);
+        for (std::size_t d = 0; d != num_domains; ++d)
+        {
+            std::vector<compute::host::target> domain(1, domains[d]);
+            storage.emplace_back(allocator_type(domain), domain_size[d]);
+            executors.emplace_back(std::move(domain));
+        }
+
+        {
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(num_domains);
+            for (std::size_t d = 0; d != num_domains; ++d)
+            {
+                if (storage[d].size() == 0)
+                    continue;
+
+                char* p = reinterpret_cast<char*>(storage[d].data());
+                std::size_t const bytes =
+                    storage[d].size() * sizeof(value_type);
+                workitems.push_back(execution::async_execute(executors[d],
+                    [p, bytes]()
+                    {
+                        for (std::size_t i = 0; i < bytes;
+                             i += sample_sort_page_size)
+                        {
+                            p[i] = 0;
+                        }
+                    }));
+            }
+
+            hpx::wait_all(workitems);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+        }
+
+        auto bucket_data = [&](std::size_t b) -> value_type*
+            {
+                return storage[b * num_domains / buckets].data() +
+                    bucket_offset[b];
+            };
+
+        // Move the elements to their buckets. The elements of chunk c
+        // constructed in bucket b so far end at filled[c * buckets + b].
+        std::vector<std::size_t> filled(counts);
+
+        try {
+            sort_for_each_chunk(policy, chunks,
+                [&](std::size_t c)
+                {
+                    std::size_t* pos = filled.data() + c * buckets;
+                    std::size_t const begin = c * chunk_size;
+                    std::size_t const end =
+                        (std::min)(count, begin + chunk_size);
+
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        std::size_t const b = bucket_ids[i];
+                        ::new (static_cast<void*>(bucket_data(b) + pos[b]))
+                            value_type(std::move(first[i]));
+                        ++pos[b];
+                    }
+                });
+        }
+        catch (...) {
+            // move the constructed elements back to where they came from
+            std::vector<std::size_t> pos(buckets);
+            for (std::size_t c = 0; c != chunks; ++c)
+            {
+                std::copy(counts.begin() + c * buckets,
+                    counts.begin() + (c + 1) * buckets, pos.begin());
+
+                std::size_t const begin = c * chunk_size;
+                std::size_t const end = (std::min)(count, begin + chunk_size);
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    std::size_t const b = bucket_ids[i];
+                    std::size_t const slot = pos[b]++;
+                    if (slot < filled[c * buckets + b])
+                    {
+                        try {
+                            sample_sort_move_back(bucket_data(b) + slot,
+                                bucket_data(b) + slot + 1, first + i);
+                        }
+                        catch (...) {
+                            // the original error is reported
+                        }
+                    }
+                }
+            }
+            throw;
+        }
+
+        // sort the buckets and move them back into the sequence
+        auto sort_bucket = [&](std::size_t b)
+            {
+                value_type* p = bucket_data(b);
+                value_type* end = p + bucket_size[b];
+
+                try {
+                    // Buckets may end up being large if the sequence
+                    // contains many equivalent elements.
+                    if (bucket_size[b] > 2 * (count / buckets))
+                    {
+                        sort_thread(policy, p, end, comp).get();
+                    }
+                    else
+                    {
+                        std::sort(p, end, comp);
+                    }
+                }
+                catch (...) {
+                    // the elements are moved back in their current order
+                    try {
+                        sample_sort_move_back(p, end, first + bucket_start[b]);
+                    }
+                    catch (...) {
+                        // the original error is reported
+                    }
+                    throw;
+                }
+
+                sample_sort_move_back(p, end, first + bucket_start[b]);
+            };
+
+        std::vector<hpx::future<void> > workitems;
+        workitems.reserve(buckets);
+
+        std::size_t b = 0;
+        try {
+            for (/**/; b != buckets; ++b)
+            {
+                workitems.push_back(sample_sort_bucket_execute(
+                    policy, executors[b * num_domains / buckets],
+                    [&sort_bucket, b]() { sort_bucket(b); },
+                    use_domain_executors()));
+            }
+        }
+        catch (...) {
+            // the buckets which have not been scheduled are moved back
+            // unsorted
+            hpx::wait_all(workitems);
+            for (/**/; b != buckets; ++b)
+            {
+                try {
+                    sample_sort_move_back(bucket_data(b),
+                        bucket_data(b) + bucket_size[b],
+                        first + bucket_start[b]);
+                }
+                catch (...) {
+                    // the original error is reported
+                }
+            }
+            throw;
+        }
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+
+        return last;
+    }
+
+    // The sample sort moves the elements into uninitialized bucket storage
+    // and back, it does not need to copy or to default construct them.
+    template <typename RandomIt>
+    struct is_sample_sortable
+      : std::is_move_constructible<
+            typename std::iterator_traits<RandomIt>::value_type>
+    {};
+
+    /// \endcond
+}}}}
+
+#endif
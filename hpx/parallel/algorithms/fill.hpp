@@ -223,6 +223,31 @@ namespace hpx { namespace parallel { inline namespace v1
                         util::projection_identity());
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        fill_n_(ExPolicy && policy, FwdIter first, std::size_t count,
+            T const& value, std::false_type)
+        {
+#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
+            typedef std::integral_constant<bool,
+                    execution::is_sequenced_execution_policy<ExPolicy>::value ||
+                   !hpx::traits::is_forward_iterator<FwdIter>::value
+                > is_seq;
+#else
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+#endif
+
+            return detail::fill_n<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, count, value);
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        fill_n_(ExPolicy && policy, SegIter first, std::size_t count,
+            T const& value, std::true_type);
         /// \endcond
     }
 
@@ -280,17 +305,10 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_output_iterator<FwdIter>::value ||
                 hpx::traits::is_forward_iterator<FwdIter>::value),
             "Requires at least output iterator.");
-
-        typedef std::integral_constant<bool,
-                execution::is_sequenced_execution_policy<ExPolicy>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter>::value
-            > is_seq;
 #else
         static_assert(
             (hpx::traits::is_forward_iterator<FwdIter>::value),
             "Requires at least forward iterator.");
-
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
 #endif
 
         // if count is representing a negative value, we do nothing
@@ -300,9 +318,11 @@ namespace hpx { namespace parallel { inline namespace v1
                 std::move(first));
         }
 
-        return detail::fill_n<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, std::size_t(count), value);
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
+
+        return detail::fill_n_(
+            std::forward<ExPolicy>(policy), first, std::size_t(count), value,
+            is_segmented());
     }
 }}}
 
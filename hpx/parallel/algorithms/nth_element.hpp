@@ -0,0 +1,322 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_HPP)
+#define HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Predicates used to partition a sequence around a pivot value. The
+        // pivot is held by value as the partitioning moves the elements.
+        template <typename Compare, typename T>
+        struct less_than_pivot
+        {
+            template <typename U>
+            bool operator()(U const& value) const
+            {
+                return comp_(value, pivot_);
+            }
+
+            Compare comp_;
+            T pivot_;
+        };
+
+        template <typename Compare, typename T>
+        struct not_greater_than_pivot
+        {
+            template <typename U>
+            bool operator()(U const& value) const
+            {
+                return !comp_(pivot_, value);
+            }
+
+            Compare comp_;
+            T pivot_;
+        };
+
+        template <typename RandIter, typename Compare>
+        RandIter median_of_three(RandIter a, RandIter b, RandIter c,
+            Compare const& comp)
+        {
+            if (comp(*a, *b))
+            {
+                if (comp(*b, *c))
+                    return b;
+                return comp(*a, *c) ? c : a;
+            }
+            if (comp(*a, *c))
+                return a;
+            return comp(*b, *c) ? c : b;
+        }
+
+        // Parallel selection: the sequence is partitioned (in parallel)
+        // into the elements less than, equivalent to, and greater than a
+        // pivot, narrowing the range containing 'nth' until it is small
+        // enough to be handled by std::nth_element. The comparison 'comp'
+        // is applied to whole elements (it has the projection applied
+        // already).
+        template <typename ExPolicy, typename RandIter, typename Compare>
+        void parallel_nth_element_helper(ExPolicy& policy,
+            RandIter first, RandIter nth, RandIter last, Compare const& comp)
+        {
+            typedef typename std::iterator_traits<RandIter>::value_type
+                value_type;
+
+            while (std::size_t(last - first) > sort_limit_per_task)
+            {
+                value_type pivot = *median_of_three(
+                    first, first + (last - first) / 2, last - 1, comp);
+
+                RandIter middle1 = partition_helper::call(policy, first, last,
+                    less_than_pivot<Compare, value_type>{comp, pivot},
+                    util::projection_identity());
+
+                if (nth < middle1)
+                {
+                    last = middle1;
+                    continue;
+                }
+
+                RandIter middle2 = partition_helper::call(policy, middle1,
+                    last,
+                    not_greater_than_pivot<Compare, value_type>{comp, pivot},
+                    util::projection_identity());
+
+                // 'nth' refers to an element equivalent to the pivot, which
+                // is at its final position already.
+                if (nth < middle2)
+                    return;
+
+                first = middle2;
+            }
+
+            std::nth_element(first, nth, last, comp);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Comp,
+            typename Proj>
+        hpx::future<RandIter>
+        parallel_nth_element(ExPolicy && policy, RandIter first,
+            RandIter nth, RandIter last, Comp && comp, Proj && proj)
+        {
+            typedef util::compare_projected<
+                    typename hpx::util::decay<Comp>::type,
+                    typename hpx::util::decay<Proj>::type
+                > compare_type;
+
+            compare_type cmp(std::forward<Comp>(comp), std::forward<Proj>(proj));
+
+            if (std::size_t(last - first) <= sort_limit_per_task)
+            {
+                if (nth != last)
+                    std::nth_element(first, nth, last, cmp);
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(
+                policy.executor(),
+                [=, HPX_CAPTURE_MOVE(cmp)]() mutable -> RandIter
+                {
+                    try {
+                        if (nth != last)
+                        {
+                            parallel_nth_element_helper(
+                                policy, first, nth, last, cmp);
+                        }
+                        return last;
+                    }
+                    catch (...) {
+                        util::detail::handle_local_exceptions<ExPolicy>::call(
+                            std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                });
+        }
+
+        template <typename RandIter>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandIter>, RandIter>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {}
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandIter
+            sequential(ExPolicy, RandIter first, RandIter nth, RandIter last,
+                Comp && comp, Proj && proj)
+            {
+                if (nth != last)
+                {
+                    std::nth_element(first, nth, last,
+                        util::compare_projected<Comp, Proj>(
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                return last;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandIter
+            >::type
+            parallel(ExPolicy && policy, RandIter first, RandIter nth,
+                RandIter last, Comp && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandIter
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        parallel_nth_element(std::forward<ExPolicy>(policy),
+                            first, nth, last, std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would
+    /// occur in that position if [first, last) was sorted, and all of the
+    /// elements before this new \a nth element are less than or equal to the
+    /// elements after the new \a nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// The parallel overloads repeatedly partition the sequence in parallel
+    /// around a pivot element, narrowing down the range containing \a nth.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Unlike its sequential form,
+    ///                     the parallel overload of \a nth_element requires
+    ///                     the value type of \a RandIter to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a nth_element requires \a Comp to meet
+    ///                     the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element the sequence is partitioned
+    ///                     around.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = detail::less,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandIter>::value &&
+        traits::is_projected<Proj, RandIter>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Comp,
+                traits::projected<Proj, RandIter>,
+                traits::projected<Proj, RandIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    nth_element(ExPolicy && policy, RandIter first, RandIter nth,
+        RandIter last, Comp && comp = Comp(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandIter>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -0,0 +1,472 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Select the smallest elements using the parallel selection of
+        // nth_element and sort them using the parallel quicksort.
+        template <typename ExPolicy, typename RandIter, typename Compare>
+        void parallel_partial_sort_helper(ExPolicy& policy,
+            RandIter first, RandIter middle, RandIter last,
+            Compare const& comp)
+        {
+            if (first == middle)
+                return;
+
+            if (middle != last)
+                parallel_nth_element_helper(policy, first, middle, last, comp);
+
+            sort_thread(policy, first, middle, comp).get();
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Comp,
+            typename Proj>
+        hpx::future<RandIter>
+        parallel_partial_sort(ExPolicy && policy, RandIter first,
+            RandIter middle, RandIter last, Comp && comp, Proj && proj)
+        {
+            typedef util::compare_projected<
+                    typename hpx::util::decay<Comp>::type,
+                    typename hpx::util::decay<Proj>::type
+                > compare_type;
+
+            compare_type cmp(std::forward<Comp>(comp), std::forward<Proj>(proj));
+
+            if (std::size_t(last - first) <= sort_limit_per_task)
+            {
+                std::partial_sort(first, middle, last, cmp);
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(
+                policy.executor(),
+                [=, HPX_CAPTURE_MOVE(cmp)]() mutable -> RandIter
+                {
+                    try {
+                        parallel_partial_sort_helper(
+                            policy, first, middle, last, cmp);
+                        return last;
+                    }
+                    catch (...) {
+                        util::detail::handle_local_exceptions<ExPolicy>::call(
+                            std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                });
+        }
+
+        template <typename RandIter>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandIter>, RandIter>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {}
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandIter
+            sequential(ExPolicy, RandIter first, RandIter middle,
+                RandIter last, Comp && comp, Proj && proj)
+            {
+                std::partial_sort(first, middle, last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp),
+                        std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandIter
+            >::type
+            parallel(ExPolicy && policy, RandIter first, RandIter middle,
+                RandIter last, Comp && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandIter
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        parallel_partial_sort(std::forward<ExPolicy>(policy),
+                            first, middle, last, std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    /// Rearranges elements such that the range [first, middle) contains the
+    /// sorted middle - first smallest elements in the range [first, last).
+    /// The order of equal elements is not guaranteed to be preserved. The
+    /// order of the remaining elements in the range [middle, last) is
+    /// unspecified. The function uses the given comparison function object
+    /// comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(middle - first)
+    ///                     comparisons.
+    ///
+    /// The parallel overloads select the smallest elements using the
+    /// parallel selection algorithm of \a nth_element and sort them using
+    /// the parallel algorithm of \a sort.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Unlike its sequential form,
+    ///                     the parallel overload of \a partial_sort requires
+    ///                     the value type of \a RandIter to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a partial_sort requires \a Comp to
+    ///                     meet the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the range which will hold the
+    ///                     sorted elements.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = detail::less,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandIter>::value &&
+        traits::is_projected<Proj, RandIter>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Comp,
+                traits::projected<Proj, RandIter>,
+                traits::projected<Proj, RandIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    partial_sort(ExPolicy && policy, RandIter first, RandIter middle,
+        RandIter last, Comp && comp = Comp(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandIter>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort<RandIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Comp, typename Proj>
+        hpx::future<RandIter>
+        parallel_partial_sort_copy(ExPolicy && policy,
+            FwdIter first, FwdIter last, RandIter d_first, RandIter d_last,
+            Comp && comp, Proj && proj)
+        {
+            typedef util::compare_projected<
+                    typename hpx::util::decay<Comp>::type,
+                    typename hpx::util::decay<Proj>::type
+                > compare_type;
+            typedef typename std::iterator_traits<FwdIter>::value_type
+                value_type;
+
+            compare_type cmp(std::forward<Comp>(comp), std::forward<Proj>(proj));
+
+            std::size_t count = std::distance(first, last);
+            std::size_t d_count = d_last - d_first;
+
+            if (d_count == 0)
+                return hpx::make_ready_future(d_first);
+
+            if (count <= sort_limit_per_task)
+            {
+                return hpx::make_ready_future(std::partial_sort_copy(
+                    first, last, d_first, d_last, cmp));
+            }
+
+            return execution::async_execute(
+                policy.executor(),
+                [=, HPX_CAPTURE_MOVE(cmp)]() mutable -> RandIter
+                {
+                    try {
+                        // The input sequence is left untouched, the
+                        // selection is performed on a copy of it if the
+                        // destination range is too small to hold all of
+                        // the elements.
+                        if (count <= d_count)
+                        {
+                            RandIter d_end = std::copy(first, last, d_first);
+                            sort_thread(policy, d_first, d_end, cmp).get();
+                            return d_end;
+                        }
+
+                        std::vector<value_type> buffer(first, last);
+                        parallel_nth_element_helper(policy, buffer.begin(),
+                            buffer.begin() + d_count, buffer.end(), cmp);
+
+                        std::copy(buffer.begin(), buffer.begin() + d_count,
+                            d_first);
+                        sort_thread(policy, d_first, d_last, cmp).get();
+                        return d_last;
+                    }
+                    catch (...) {
+                        util::detail::handle_local_exceptions<ExPolicy>::call(
+                            std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                });
+        }
+
+        template <typename RandIter>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<RandIter>, RandIter>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename Comp,
+                typename Proj>
+            static RandIter
+            sequential(ExPolicy, InIter first, InIter last,
+                RandIter d_first, RandIter d_last, Comp && comp, Proj && proj)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp),
+                        std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandIter
+            >::type
+            parallel(ExPolicy && policy, FwdIter first, FwdIter last,
+                RandIter d_first, RandIter d_last, Comp && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandIter
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        parallel_partial_sort_copy(
+                            std::forward<ExPolicy>(policy),
+                            first, last, d_first, d_last,
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (the smaller of last - first and d_last - d_first). The order of
+    /// equal elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: O(N log(min(D, N))), where
+    ///                     N = std::distance(first, last) and
+    ///                     D = std::distance(d_first, d_last) comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the iterators used for the destination
+    ///                     range (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a partial_sort_copy requires \a Comp
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///                     This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter
+    ///           otherwise.
+    ///           The algorithm returns an iterator to the element defining
+    ///           the upper boundary of the sorted range, i.e.
+    ///           d_first + min(last - first, d_last - d_first).
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename Comp = detail::less,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<FwdIter>::value &&
+        hpx::traits::is_iterator<RandIter>::value &&
+        traits::is_projected<Proj, FwdIter>::value &&
+        traits::is_projected<Proj, RandIter>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Comp,
+                traits::projected<Proj, FwdIter>,
+                traits::projected<Proj, RandIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    partial_sort_copy(ExPolicy && policy, FwdIter first, FwdIter last,
+        RandIter d_first, RandIter d_last, Comp && comp = Comp(),
+        Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_forward_iterator<FwdIter>::value),
+            "Requires at least forward iterator.");
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandIter>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort_copy<RandIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, d_first, d_last,
+            std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -320,17 +320,21 @@ namespace hpx { namespace parallel { inline namespace v1
         sequential_partition(BidirIter first, BidirIter last,
             Pred && pred, Proj && proj)
         {
-            using hpx::util::invoke;
-
             while (true)
             {
-                while (first != last && invoke(pred, invoke(proj, *first)))
+                while (first != last &&
+                    hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+                {
                     ++first;
+                }
                 if (first == last)
                     break;
 
-                while (first != --last && !invoke(pred, invoke(proj, *last)))
-                    ;
+                while (first != --last &&
+                    !hpx::util::invoke(pred, hpx::util::invoke(proj, *last)))
+                {
+                    /**/
+                }
                 if (first == last)
                     break;
 
@@ -349,17 +353,18 @@ namespace hpx { namespace parallel { inline namespace v1
         sequential_partition(FwdIter first, FwdIter last,
             Pred && pred, Proj && proj)
         {
-            using hpx::util::invoke;
-
-            while (first != last && invoke(pred, invoke(proj, *first)))
+            while (first != last &&
+                hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+            {
                 ++first;
+            }
 
             if (first == last)
                 return first;
 
             for (FwdIter it = std::next(first); it != last; ++it)
             {
-                if (invoke(pred, invoke(proj, *it)))
+                if (hpx::util::invoke(pred, hpx::util::invoke(proj, *it)))
                     std::iter_swap(first++, it);
             }
 
@@ -572,8 +577,6 @@ namespace hpx { namespace parallel { inline namespace v1
             partition_thread(block_manager<FwdIter>& block_manager,
                 Pred pred, Proj proj)
             {
-                using hpx::util::invoke;
-
                 block<FwdIter> left_block, right_block;
 
                 left_block = block_manager.get_left_block();
@@ -583,14 +586,16 @@ namespace hpx { namespace parallel { inline namespace v1
                 {
                     while ( (!left_block.empty() ||
                             !(left_block = block_manager.get_left_block()).empty()) &&
-                        invoke(pred, invoke(proj, *left_block.first)))
+                        hpx::util::invoke(pred,
+                            hpx::util::invoke(proj, *left_block.first)))
                     {
                         ++left_block.first;
                     }
 
                     while ( (!right_block.empty() ||
                             !(right_block = block_manager.get_right_block()).empty()) &&
-                        !invoke(pred, invoke(proj, *right_block.first)))
+                        !hpx::util::invoke(pred,
+                            hpx::util::invoke(proj, *right_block.first)))
                     {
                         ++right_block.first;
                     }
@@ -623,8 +628,6 @@ namespace hpx { namespace parallel { inline namespace v1
 
                 while (true)
                 {
-                    using hpx::util::invoke;
-
                     while (true)
                     {
                         if (left_iter->empty())
@@ -634,7 +637,8 @@ namespace hpx { namespace parallel { inline namespace v1
                                 left_iter->block_no > 0)
                                 break;
                         }
-                        if (!invoke(pred, invoke(proj, *left_iter->first)))
+                        if (!hpx::util::invoke(pred,
+                                hpx::util::invoke(proj, *left_iter->first)))
                             break;
                         ++left_iter->first;
                     }
@@ -647,7 +651,8 @@ namespace hpx { namespace parallel { inline namespace v1
                                 (--right_iter)->block_no < 0)
                                 break;
                         }
-                        if (invoke(pred, invoke(proj, *right_iter->first)))
+                        if (hpx::util::invoke(pred,
+                                hpx::util::invoke(proj, *right_iter->first)))
                             break;
                         ++right_iter->first;
                     }
@@ -1167,8 +1172,8 @@ namespace hpx { namespace parallel { inline namespace v1
                             part_begin, part_size,
                             [pred, proj, &true_count](zip_iterator it) mutable
                             {
-                                using hpx::util::invoke;
-                                bool f = invoke(pred, invoke(proj, get<0>(*it)));
+                                bool f = hpx::util::invoke(pred,
+                                    hpx::util::invoke(proj, get<0>(*it)));
 
                                 if ((get<1>(*it) = f))
                                     ++true_count;
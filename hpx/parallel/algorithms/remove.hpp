@@ -297,6 +297,11 @@ namespace hpx { namespace parallel { inline namespace v1
 
         typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
 
+        // TODO: Add a segmented overload. Segmented iterators currently
+        //       access remote elements one at a time here. A segmented
+        //       version has to compact the remaining elements across
+        //       partitions, which segmented_algorithms/detail/transfer.hpp
+        //       does not support as it expects aligned partitions.
         return detail::remove_if<FwdIter>().call(
                 std::forward<ExPolicy>(policy), is_seq(),
                 first, last, std::forward<Pred>(pred),
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/tagged_pair.hpp>
 #include <hpx/util/unused.hpp>
@@ -95,6 +96,30 @@ namespace hpx { namespace parallel { inline namespace v1
                     util::projection_identity());
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename T1,
+            typename T2, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        replace_(ExPolicy && policy, FwdIter first, FwdIter last,
+            T1 const& old_value, T2 const& new_value, Proj && proj,
+            std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::replace<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, old_value, new_value, std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename T1,
+            typename T2, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        replace_(ExPolicy && policy, SegIter first, SegIter last,
+            T1 const& old_value, T2 const& new_value, Proj && proj,
+            std::true_type);
         /// \endcond
     }
 
@@ -168,11 +193,11 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_forward_iterator<FwdIter>::value),
             "Required at least forward iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
 
-        return detail::replace<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, old_value, new_value, std::forward<Proj>(proj));
+        return detail::replace_(
+            std::forward<ExPolicy>(policy), first, last, old_value, new_value,
+            std::forward<Proj>(proj), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -240,6 +265,29 @@ namespace hpx { namespace parallel { inline namespace v1
                     util::projection_identity());
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename F, typename T,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        replace_if_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            T const& new_value, Proj && proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::replace_if<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f), new_value,
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename F, typename T,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        replace_if_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            T const& new_value, Proj && proj, std::true_type);
         /// \endcond
     }
 
@@ -330,12 +378,11 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_forward_iterator<FwdIter>::value),
             "Required at least forward iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
 
-        return detail::replace_if<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f), new_value,
-            std::forward<Proj>(proj));
+        return detail::replace_if_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            new_value, std::forward<Proj>(proj), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -12,12 +12,15 @@
 #include <hpx/dataflow.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
 #include <hpx/parallel/exception_list.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
@@ -170,6 +173,32 @@ namespace hpx { namespace parallel { inline namespace v1
                 std::move(left), std::move(right));
         }
 
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> sort_async(ExPolicy& policy, RandomIt first,
+            RandomIt last, Compare const& comp, std::false_type)
+        {
+            return execution::async_execute(policy.executor(),
+                    &sort_thread<ExPolicy, RandomIt, Compare>,
+                    std::ref(policy), first, last, comp);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> sort_async(ExPolicy& policy, RandomIt first,
+            RandomIt last, Compare const& comp, std::true_type)
+        {
+            // very large sequences are sorted using a sample sort, which
+            // avoids the sequential top level partitioning steps
+            if (std::size_t(last - first) >=
+                get_sample_sort_threshold(policy.parameters()))
+            {
+                return execution::async_execute(policy.executor(),
+                        &sample_sort<ExPolicy, RandomIt, Compare>,
+                        std::ref(policy), first, last, comp);
+            }
+
+            return sort_async(policy, first, last, comp, std::false_type());
+        }
+
         //------------------------------------------------------------------------
         //  function : parallel_sort_async
         //------------------------------------------------------------------------
@@ -199,9 +228,8 @@ namespace hpx { namespace parallel { inline namespace v1
                 if (detail::is_sorted_sequential(first, last, comp))
                     return hpx::make_ready_future(last);
 
-                result = execution::async_execute(policy.executor(),
-                        &sort_thread<ExPolicy, RandomIt, Compare>,
-                        std::ref(policy), first, last, comp);
+                result = sort_async(policy, first, last, comp,
+                    is_sample_sortable<RandomIt>());
             }
             catch (...) {
                 return detail::handle_exception<ExPolicy, RandomIt>::call(
@@ -228,8 +256,30 @@ namespace hpx { namespace parallel { inline namespace v1
 
             template <typename ExPolicy, typename Compare, typename Proj>
             static RandomIt
-            sequential(ExPolicy, RandomIt first, RandomIt last,
+            sequential(ExPolicy && policy, RandomIt first, RandomIt last,
                 Compare && comp, Proj && proj)
+            {
+                return sequential(std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj),
+                    is_radix_sortable<RandomIt, Compare, Proj>());
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                return parallel(std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj),
+                    is_radix_sortable<RandomIt, Compare, Proj>());
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy &&, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj, std::false_type)
             {
                 std::sort(first, last,
                     util::compare_projected<Compare, Proj>(
@@ -239,12 +289,23 @@ namespace hpx { namespace parallel { inline namespace v1
                 return last;
             }
 
+            // arithmetic keys compared using std::less or std::greater are
+            // sorted using a radix sort
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj, std::true_type)
+            {
+                return sequential_radix_sort(policy, first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+
             template <typename ExPolicy, typename Compare, typename Proj>
             static typename util::detail::algorithm_result<
                 ExPolicy, RandomIt
             >::type
             parallel(ExPolicy && policy, RandomIt first, RandomIt last,
-                Compare && comp, Proj && proj)
+                Compare && comp, Proj && proj, std::false_type)
             {
                 // call the sort routine and return the right type,
                 // depending on execution policy
@@ -256,7 +317,40 @@ namespace hpx { namespace parallel { inline namespace v1
                             std::forward<Proj>(proj)
                         )));
             }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj, std::true_type)
+            {
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    parallel_radix_sort_async(std::forward<ExPolicy>(policy),
+                        first, last, std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
+            }
         };
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::sort<RandomIt>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy && policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, std::true_type);
         /// \endcond
     }
 
@@ -269,6 +363,23 @@ namespace hpx { namespace parallel { inline namespace v1
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// If the (projected) elements are of arithmetic type and \a comp is
+    /// std::less or std::greater the elements are sorted using a radix sort
+    /// instead, which requires a temporary buffer of the size of the input
+    /// sequence.
+    ///
+    /// Otherwise the parallel overloads use a recursive quicksort, or for
+    /// sequences of at least \a execution::sample_sort_threshold elements (by
+    /// default 2^22) a sample sort, which sorts buckets of elements held on
+    /// the NUMA domain of the cores sorting them.
+    ///
+    /// Sequences referred to by segmented iterators (for instance those of a
+    /// \a hpx::partitioned_vector) are sorted in place using a distributed
+    /// sample sort: each segment is sorted on the locality it resides on,
+    /// the elements are then exchanged between the segments based on global
+    /// splitters chosen from a sample of the sorted segments and finally
+    /// merged on the locality of their target segment.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -347,11 +458,12 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_random_access_iterator<RandomIt>::value),
             "Requires a random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<RandomIt> is_segmented;
 
-        return detail::sort<RandomIt>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first, last,
-            std::forward<Compare>(comp), std::forward<Proj>(proj));
+        return detail::sort_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}
 
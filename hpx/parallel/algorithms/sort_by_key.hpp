@@ -36,6 +36,12 @@ namespace hpx { namespace parallel { inline namespace v1
                 return hpx::util::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        // sorting by arithmetic keys may use the radix sort
+        template <>
+        struct is_radix_projection<extract_key>
+          : std::true_type
+        {};
         /// \endcond
     }
 
@@ -52,6 +58,9 @@ namespace hpx { namespace parallel { inline namespace v1
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Arithmetic keys compared using std::less or std::greater are sorted
+    /// using a radix sort.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
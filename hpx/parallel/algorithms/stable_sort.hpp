@@ -0,0 +1,320 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Sorts [first, last) stably, leaving the result either in place or
+        // in the equally sized buffer starting at 'buffer'. Both halves are
+        // sorted into the opposite storage concurrently and then merged into
+        // the requested one using the (stable) parallel merge, which avoids
+        // copying the data back and forth on every level of the recursion.
+        template <typename ExPolicy, typename RandIter, typename BufIter,
+            typename Comp, typename Proj>
+        void parallel_stable_sort_helper(ExPolicy policy,
+            RandIter first, RandIter last, BufIter buffer,
+            Comp comp, Proj proj, bool into_buffer)
+        {
+            std::size_t size = last - first;
+
+            if (size <= sort_limit_per_task)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Comp, Proj>(comp, proj));
+                if (into_buffer)
+                    std::copy(first, last, buffer);
+                return;
+            }
+
+            RandIter middle = first + size / 2;
+            BufIter buffer_middle = buffer + size / 2;
+
+            hpx::future<void> fut = execution::async_execute(policy.executor(),
+                [&]() -> void
+                {
+                    // Process the left half.
+                    parallel_stable_sort_helper(policy, first, middle,
+                        buffer, comp, proj, !into_buffer);
+                });
+
+            try {
+                // Process the right half.
+                parallel_stable_sort_helper(policy, middle, last,
+                    buffer_middle, comp, proj, !into_buffer);
+            }
+            catch (...) {
+                fut.wait();
+
+                std::vector<hpx::future<void>> futures(2);
+                futures[0] = std::move(fut);
+                futures[1] = hpx::make_exceptional_future<void>(
+                    std::current_exception());
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
+
+                // Not reachable.
+                HPX_ASSERT(false);
+                return;
+            }
+
+            fut.get();
+
+            // Both halves now live in the storage we are not asked to fill,
+            // merge them into the requested one.
+            if (into_buffer)
+            {
+                parallel_merge_helper(policy, first, middle, middle, last,
+                    buffer, comp, proj, proj, false, lower_bound_helper());
+            }
+            else
+            {
+                parallel_merge_helper(policy, buffer, buffer_middle,
+                    buffer_middle, buffer + size, first, comp, proj, proj,
+                    false, lower_bound_helper());
+            }
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Comp,
+            typename Proj>
+        hpx::future<RandIter>
+        parallel_stable_sort(ExPolicy && policy, RandIter first,
+            RandIter last, Comp && comp, Proj && proj)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+            typedef typename hpx::util::decay<Comp>::type compare_type;
+            typedef typename hpx::util::decay<Proj>::type projection_type;
+            typedef typename std::iterator_traits<RandIter>::value_type
+                value_type;
+
+            std::size_t size = last - first;
+            if (size <= sort_limit_per_task)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<compare_type, projection_type>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(
+                policy.executor(),
+                [=, HPX_CAPTURE_FORWARD(comp),
+                    HPX_CAPTURE_FORWARD(proj)
+                ]() mutable -> RandIter
+                {
+                    try {
+                        // check if already sorted
+                        if (detail::is_sorted_sequential(first, last,
+                                util::compare_projected<
+                                    compare_type&, projection_type&
+                                >(comp, proj)))
+                        {
+                            return last;
+                        }
+
+                        // The merge steps need scratch space of the size of
+                        // the input sequence.
+                        std::vector<value_type> buffer(first, last);
+
+                        parallel_stable_sort_helper<policy_type>(
+                            policy, first, last, buffer.begin(),
+                            std::move(comp), std::move(proj), false);
+                        return last;
+                    }
+                    catch (...) {
+                        util::detail::handle_local_exceptions<ExPolicy>::call(
+                            std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                });
+        }
+
+        template <typename RandIter>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandIter>, RandIter>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {}
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandIter
+            sequential(ExPolicy, RandIter first, RandIter last,
+                Comp && comp, Proj && proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp),
+                        std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandIter
+            >::type
+            parallel(ExPolicy && policy, RandIter first, RandIter last,
+                Comp && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandIter
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        parallel_stable_sort(std::forward<ExPolicy>(policy),
+                            first, last, std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// order of equal elements is guaranteed to be preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// The parallel overloads implement a merge sort: the two halves of the
+    /// sequence are sorted concurrently and combined using the parallel
+    /// merge also used by \a merge. This requires a temporary buffer of the
+    /// size of the input sequence.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Unlike its sequential form,
+    ///                     the parallel overload of \a stable_sort requires
+    ///                     the value type of \a RandIter to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a stable_sort requires \a Comp to meet
+    ///                     the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = detail::less,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandIter>::value &&
+        traits::is_projected<Proj, RandIter>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Comp,
+                traits::projected<Proj, RandIter>,
+                traits::projected<Proj, RandIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    stable_sort(ExPolicy && policy, RandIter first, RandIter last,
+        Comp && comp = Comp(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandIter>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
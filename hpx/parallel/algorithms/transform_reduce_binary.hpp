@@ -13,6 +13,8 @@
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_callable.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/result_of.hpp>
 #include <hpx/util/zip_iterator.hpp>
@@ -238,6 +240,53 @@ namespace hpx { namespace parallel { inline namespace v1
                     });
             }
         };
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename T, typename Reduce, typename Convert>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        transform_reduce_binary_(ExPolicy && policy, FwdIter1 first1,
+            FwdIter1 last1, FwdIter2 first2, T && init, Reduce && red_op,
+            Convert && conv_op, std::false_type)
+        {
+#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
+            static_assert(
+                (hpx::traits::is_input_iterator<FwdIter1>::value),
+                "Requires at least input iterator.");
+            static_assert(
+                (hpx::traits::is_input_iterator<FwdIter2>::value),
+                "Requires at least input iterator.");
+
+            typedef std::integral_constant<bool,
+                    execution::is_sequenced_execution_policy<ExPolicy>::value ||
+                   !hpx::traits::is_forward_iterator<FwdIter1>::value ||
+                   !hpx::traits::is_forward_iterator<FwdIter2>::value
+                > is_seq;
+#else
+            static_assert(
+                (hpx::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert(
+                (hpx::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+#endif
+
+            typedef typename hpx::util::decay<T>::type init_type;
+
+            return transform_reduce_binary<init_type>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first1, last1,
+                first2, std::forward<T>(init), std::forward<Reduce>(red_op),
+                std::forward<Convert>(conv_op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename T, typename Reduce, typename Convert>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        transform_reduce_binary_(ExPolicy && policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, T && init, Reduce && red_op,
+            Convert && conv_op, std::true_type);
         /// \endcond
     }
 
@@ -295,33 +344,15 @@ namespace hpx { namespace parallel { inline namespace v1
     transform_reduce(ExPolicy && policy, FwdIter1 first1, FwdIter1 last1,
         FwdIter2 first2, T init)
     {
-#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter1>::value),
-            "Requires at least input iterator.");
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter2>::value),
-            "Requires at least input iterator.");
-
         typedef std::integral_constant<bool,
-                execution::is_sequenced_execution_policy<ExPolicy>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter1>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter2>::value
-            > is_seq;
-#else
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter1>::value),
-            "Requires at least forward iterator.");
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least forward iterator.");
-
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
-#endif
-
-        return detail::transform_reduce_binary<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first1, last1, first2,
-            std::move(init), detail::plus(), detail::multiplies());
+                hpx::traits::is_segmented_iterator<FwdIter1>::value &&
+                hpx::traits::is_segmented_iterator<FwdIter2>::value
+            > is_segmented;
+
+        return detail::transform_reduce_binary_(
+            std::forward<ExPolicy>(policy), first1, last1, first2,
+            std::move(init), detail::plus(), detail::multiplies(),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -427,34 +458,16 @@ namespace hpx { namespace parallel { inline namespace v1
     transform_reduce(ExPolicy && policy, FwdIter1 first1, FwdIter1 last1,
         FwdIter2 first2, T init, Reduce && red_op, Convert && conv_op)
     {
-#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter1>::value),
-            "Requires at least input iterator.");
-        static_assert(
-            (hpx::traits::is_input_iterator<FwdIter2>::value),
-            "Requires at least input iterator.");
-
         typedef std::integral_constant<bool,
-                execution::is_sequenced_execution_policy<ExPolicy>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter1>::value ||
-               !hpx::traits::is_forward_iterator<FwdIter2>::value
-            > is_seq;
-#else
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter1>::value),
-            "Requires at least forward iterator.");
-        static_assert(
-            (hpx::traits::is_forward_iterator<FwdIter2>::value),
-            "Requires at least forward iterator.");
-
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
-#endif
+                hpx::traits::is_segmented_iterator<FwdIter1>::value &&
+                hpx::traits::is_segmented_iterator<FwdIter2>::value
+            > is_segmented;
 
-        return detail::transform_reduce_binary<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first1, last1, first2,
+        return detail::transform_reduce_binary_(
+            std::forward<ExPolicy>(policy), first1, last1, first2,
             std::move(init),
-            std::forward<Reduce>(red_op), std::forward<Convert>(conv_op));
+            std::forward<Reduce>(red_op), std::forward<Convert>(conv_op),
+            is_segmented());
     }
 }}}
 
@@ -325,6 +325,11 @@ namespace hpx { namespace parallel { inline namespace v1
         typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
 #endif
 
+        // TODO: Add a segmented overload. Segmented iterators currently
+        //       access remote elements one at a time here. A segmented
+        //       version has to compact the remaining elements across
+        //       partitions, which segmented_algorithms/detail/transfer.hpp
+        //       does not support as it expects aligned partitions.
         return detail::unique<FwdIter>().call(
                 std::forward<ExPolicy>(policy), is_seq(),
                 first, last, std::forward<Pred>(pred),
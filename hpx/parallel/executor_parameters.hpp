@@ -12,6 +12,7 @@
 #include <hpx/parallel/executors/dynamic_chunk_size.hpp>
 #include <hpx/parallel/executors/guided_chunk_size.hpp>
 #include <hpx/parallel/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/parallel/executors/sample_sort_threshold.hpp>
 #include <hpx/parallel/executors/static_chunk_size.hpp>
 #if defined(HPX_HAVE_EXECUTOR_COMPATIBILITY)
 #include <hpx/parallel/executors/v1/executor_parameter_traits.hpp>
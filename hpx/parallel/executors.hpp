@@ -19,8 +19,11 @@
 #include <hpx/parallel/executors/v1/thread_timed_executor_traits.hpp>
 #endif
 
+#include <hpx/parallel/executors/cancellable_executor.hpp>
+#include <hpx/parallel/executors/deadline_executor.hpp>
 #include <hpx/parallel/executors/default_executor.hpp>
 #include <hpx/parallel/executors/distribution_policy_executor.hpp>
+#include <hpx/parallel/executors/fork_join_executor.hpp>
 #include <hpx/parallel/executors/parallel_executor.hpp>
 #include <hpx/parallel/executors/sequenced_executor.hpp>
 #include <hpx/parallel/executors/service_executors.hpp>
@@ -0,0 +1,258 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/cancellable_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_CANCELLABLE_EXECUTOR_HPP)
+#define HPX_PARALLEL_EXECUTORS_CANCELLABLE_EXECUTOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/cancellation_token.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/parallel_executor.hpp>
+#include <hpx/traits/executor_traits.hpp>
+#include <hpx/traits/is_cancellable_executor.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        // Invokes the wrapped function only if the token has not been
+        // cancelled, otherwise an hpx::exception (future_cancelled) is
+        // thrown, which makes the future associated with the task
+        // exceptional.
+        template <typename F>
+        struct cancellable_function
+        {
+            template <typename ... Ts>
+            auto operator()(Ts &&... ts)
+            ->  decltype(hpx::util::invoke(std::declval<F&>(),
+                    std::forward<Ts>(ts)...))
+            {
+                token_.throw_if_cancelled(
+                    "hpx::parallel::execution::cancellable_executor");
+                return hpx::util::invoke(f_, std::forward<Ts>(ts)...);
+            }
+
+            lcos::local::cancellation_token token_;
+            F f_;
+        };
+
+        // Drops fire-and-forget tasks whose token has been cancelled.
+        template <typename F>
+        struct cancellable_oneway_function
+        {
+            template <typename ... Ts>
+            void operator()(Ts &&... ts)
+            {
+                if (!token_.is_cancelled())
+                    hpx::util::invoke(f_, std::forward<Ts>(ts)...);
+            }
+
+            lcos::local::cancellation_token token_;
+            F f_;
+        };
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a cancellable_executor wraps another executor and associates all
+    /// tasks scheduled through it with a cancellation token. A task whose
+    /// token has been cancelled before it started running is dropped
+    /// without invoking its function. The future associated with the
+    /// dropped task (if any) becomes exceptional, holding an hpx::exception
+    /// with the error code hpx::future_cancelled.
+    ///
+    /// The executor can be passed to hpx::async, hpx::dataflow and
+    /// future::then, which makes it possible to cancel speculatively
+    /// launched work:
+    ///
+    /// \code
+    ///     hpx::lcos::local::cancellation_source source;
+    ///     cancellable_executor<> exec(source.get_token());
+    ///
+    ///     hpx::future<int> f = hpx::async(exec, &speculative_work);
+    ///     hpx::future<int> g = f.then(exec, &more_work);
+    ///
+    ///     source.cancel();    // f and g become exceptional unless their
+    ///                         // tasks have already started running
+    /// \endcode
+    ///
+    /// Tasks which have already started running are not interrupted, they
+    /// may check the token themselves.
+    template <typename BaseExecutor = parallel_executor>
+    class cancellable_executor
+    {
+    public:
+        /// Associate the execution category of the wrapped executor with
+        /// this executor.
+        typedef typename executor_execution_category<
+                BaseExecutor
+            >::type execution_category;
+
+        /// Create a new cancellable executor wrapping a default constructed
+        /// instance of \a BaseExecutor.
+        explicit cancellable_executor(lcos::local::cancellation_token token)
+          : exec_(), token_(std::move(token))
+        {}
+
+        /// Create a new cancellable executor wrapping the given executor.
+        cancellable_executor(BaseExecutor exec,
+                lcos::local::cancellation_token token)
+          : exec_(std::move(exec)), token_(std::move(token))
+        {}
+
+        /// \cond NOINTERNAL
+        bool operator==(cancellable_executor const& rhs) const noexcept
+        {
+            return exec_ == rhs.exec_ && token_ == rhs.token_;
+        }
+
+        bool operator!=(cancellable_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        cancellable_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// Return the token the tasks scheduled through this executor are
+        /// associated with.
+        lcos::local::cancellation_token const& get_cancellation_token() const
+        {
+            return token_;
+        }
+
+        /// Return the wrapped executor.
+        BaseExecutor const& base_executor() const
+        {
+            return exec_;
+        }
+
+        /// \cond NOINTERNAL
+
+        // OneWayExecutor interface
+        template <typename F, typename ... Ts>
+        auto sync_execute(F && f, Ts &&... ts) const
+        ->  decltype(execution::sync_execute(std::declval<BaseExecutor const&>(),
+                std::declval<detail::cancellable_function<
+                    typename hpx::util::decay<F>::type> >(),
+                std::forward<Ts>(ts)...))
+        {
+            return execution::sync_execute(exec_, wrap(std::forward<F>(f)),
+                std::forward<Ts>(ts)...);
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename ... Ts>
+        auto async_execute(F && f, Ts &&... ts) const
+        ->  decltype(execution::async_execute(
+                std::declval<BaseExecutor const&>(),
+                std::declval<detail::cancellable_function<
+                    typename hpx::util::decay<F>::type> >(),
+                std::forward<Ts>(ts)...))
+        {
+            return execution::async_execute(exec_, wrap(std::forward<F>(f)),
+                std::forward<Ts>(ts)...);
+        }
+
+        template <typename F, typename Future, typename ... Ts>
+        auto then_execute(F && f, Future&& predecessor, Ts &&... ts) const
+        ->  decltype(execution::then_execute(
+                std::declval<BaseExecutor const&>(),
+                std::declval<detail::cancellable_function<
+                    typename hpx::util::decay<F>::type> >(),
+                std::forward<Future>(predecessor), std::forward<Ts>(ts)...))
+        {
+            return execution::then_execute(exec_, wrap(std::forward<F>(f)),
+                std::forward<Future>(predecessor), std::forward<Ts>(ts)...);
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts) const
+        {
+            typedef detail::cancellable_oneway_function<
+                    typename hpx::util::decay<F>::type
+                > function_type;
+
+            execution::post(exec_, function_type{token_, std::forward<F>(f)},
+                std::forward<Ts>(ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        template <typename F, typename S, typename ... Ts>
+        auto bulk_async_execute(F && f, S const& shape, Ts &&... ts) const
+        ->  decltype(execution::bulk_async_execute(
+                std::declval<BaseExecutor const&>(),
+                std::declval<detail::cancellable_function<
+                    typename hpx::util::decay<F>::type> >(),
+                shape, std::forward<Ts>(ts)...))
+        {
+            return execution::bulk_async_execute(exec_,
+                wrap(std::forward<F>(f)), shape, std::forward<Ts>(ts)...);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename F>
+        detail::cancellable_function<typename hpx::util::decay<F>::type>
+        wrap(F && f) const
+        {
+            return detail::cancellable_function<
+                    typename hpx::util::decay<F>::type
+                >{token_, std::forward<F>(f)};
+        }
+
+        BaseExecutor exec_;
+        lcos::local::cancellation_token token_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <typename BaseExecutor>
+    struct is_one_way_executor<
+            parallel::execution::cancellable_executor<BaseExecutor> >
+      : is_one_way_executor<BaseExecutor>
+    {};
+
+    template <typename BaseExecutor>
+    struct is_two_way_executor<
+            parallel::execution::cancellable_executor<BaseExecutor> >
+      : is_two_way_executor<BaseExecutor>
+    {};
+
+    template <typename BaseExecutor>
+    struct is_bulk_two_way_executor<
+            parallel::execution::cancellable_executor<BaseExecutor> >
+      : is_bulk_two_way_executor<BaseExecutor>
+    {};
+
+    namespace detail
+    {
+        template <typename BaseExecutor>
+        struct is_cancellable_executor<
+                parallel::execution::cancellable_executor<BaseExecutor> >
+          : std::true_type
+        {};
+    }
+    /// \endcond
+}}}
+
+#endif
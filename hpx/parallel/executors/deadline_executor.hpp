@@ -0,0 +1,242 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/deadline_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_DEADLINE_EXECUTOR_OCT_17_2017_1215PM)
+#define HPX_PARALLEL_EXECUTORS_DEADLINE_EXECUTOR_OCT_17_2017_1215PM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/packaged_task.hpp>
+#include <hpx/runtime/threads/thread_data_fwd.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/deferred_call.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/range.hpp>
+#include <hpx/util/register_locks.hpp>
+#include <hpx/util/steady_clock.hpp>
+#include <hpx/util/thread_description.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a deadline_executor creates groups of parallel execution agents
+    /// which execute in threads implicitly created by the executor. All
+    /// threads created by this executor carry a deadline, which is taken into
+    /// account by the deadline scheduler (see
+    /// \a hpx::threads::policies::deadline_queue_scheduler) to execute the
+    /// threads in earliest deadline first order. All other schedulers ignore
+    /// the deadline.
+    ///
+    /// The deadline is either given as an absolute point in time (which is
+    /// used for all threads created by the executor) or as a duration
+    /// relative to the point in time a thread is created.
+    ///
+    /// This executor conforms to the concepts of a NeverBlockingOneWayExecutor,
+    /// a TwoWayExecutor, and a BulkTwoWayExecutor
+    struct deadline_executor
+    {
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        typedef parallel_execution_tag execution_category;
+
+        /// Create a new deadline executor using the given absolute deadline
+        /// for all threads it creates
+        explicit deadline_executor(hpx::util::steady_time_point const& abs_time,
+                threads::thread_priority priority =
+                    threads::thread_priority_normal,
+                threads::thread_stacksize stacksize =
+                    threads::thread_stacksize_default)
+          : deadline_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                abs_time.value().time_since_epoch()).count())
+          , relative_(false)
+          , priority_(priority)
+          , stacksize_(stacksize)
+        {}
+
+        /// Create a new deadline executor which assigns a deadline relative
+        /// to their creation to all threads it creates
+        explicit deadline_executor(hpx::util::steady_duration const& rel_time,
+                threads::thread_priority priority =
+                    threads::thread_priority_normal,
+                threads::thread_stacksize stacksize =
+                    threads::thread_stacksize_default)
+          : deadline_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                rel_time.value()).count())
+          , relative_(true)
+          , priority_(priority)
+          , stacksize_(stacksize)
+        {}
+
+        /// \cond NOINTERNAL
+        bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return deadline_ == rhs.deadline_ &&
+                relative_ == rhs.relative_ &&
+                priority_ == rhs.priority_ &&
+                stacksize_ == rhs.stacksize_;
+        }
+
+        bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        deadline_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+
+        // TwoWayExecutor interface
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        >
+        async_execute(F && f, Ts &&... ts) const
+        {
+            typedef typename
+                    hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+                result_type;
+
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::deadline_executor::async_execute");
+
+            lcos::local::packaged_task<result_type()> task(
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+
+            hpx::future<result_type> result = task.get_future();
+            create_thread(std::move(task), desc);
+            return result;
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts) const
+        {
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::deadline_executor::post");
+
+            create_thread(
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...),
+                desc);
+        }
+
+        // BulkTwoWayExecutor interface
+        template <typename F, typename S, typename ... Ts>
+        std::vector<hpx::future<
+            typename detail::bulk_function_result<F, S, Ts...>::type
+        > >
+        bulk_async_execute(F && f, S const& shape, Ts &&... ts) const
+        {
+            typedef std::vector<hpx::future<
+                    typename detail::bulk_function_result<
+                        F, S, Ts...
+                    >::type
+                > > result_type;
+
+            result_type results;
+            results.reserve(hpx::util::size(shape));
+
+            for (auto const& elem : shape)
+            {
+                results.push_back(async_execute(f, elem, ts...));
+            }
+
+            return results;
+        }
+
+        // Return the absolute deadline (as reported by
+        // util::high_resolution_clock) of a thread created now
+        std::uint64_t get_deadline() const
+        {
+            if (relative_)
+                return hpx::util::high_resolution_clock::now() + deadline_;
+            return deadline_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        static threads::thread_result_type thread_function_nullary(
+            hpx::util::unique_function_nonser<void()> func)
+        {
+            // execute the actual thread function
+            func();
+
+            // Verify that there are no more registered locks for this
+            // OS-thread. This will throw if there are still any locks
+            // held.
+            hpx::util::force_error_on_lock();
+
+            return threads::thread_result_type(threads::terminated, nullptr);
+        }
+
+        void create_thread(hpx::util::unique_function_nonser<void()> && func,
+            hpx::util::thread_description const& desc) const
+        {
+            threads::thread_init_data data(
+                hpx::util::bind(hpx::util::one_shot(
+                    &deadline_executor::thread_function_nullary),
+                    std::move(func)),
+                desc, 0, priority_, std::size_t(-1),
+                threads::get_stack_size(stacksize_));
+            data.deadline = get_deadline();
+
+            // the new thread is put into the pending queue right away to
+            // allow for it to be ordered by its deadline
+            threads::register_thread_plain(data, threads::pending, true);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::uint64_t deadline_;
+        bool relative_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_never_blocking_one_way_executor<
+            parallel::execution::deadline_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_two_way_executor<parallel::execution::deadline_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_bulk_two_way_executor<parallel::execution::deadline_executor>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
@@ -0,0 +1,184 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/fork_join_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_FORK_JOIN_EXECUTOR_OCT_17_2017_0932AM)
+#define HPX_PARALLEL_EXECUTORS_FORK_JOIN_EXECUTOR_OCT_17_2017_0932AM
+
+#include <hpx/config.hpp>
+#include <hpx/async_launch_policy_dispatch.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/parallel/executors/post_policy_dispatch.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/deferred_call.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/range.hpp>
+#include <hpx/util/thread_description.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a fork_join_executor creates groups of parallel execution agents
+    /// using a work-first strategy, which makes it well suited for deeply
+    /// recursive fork-join parallelism.
+    ///
+    /// As long as none of the other worker threads of the current thread
+    /// pool is looking for work, new tasks are executed inline by the
+    /// creating thread, avoiding to create a new thread and any context
+    /// switches. Otherwise the new task is run on a new thread and the
+    /// creating thread is made available to be stolen by the idle worker
+    /// threads (same as for \a hpx::launch::fork).
+    ///
+    /// This executor conforms to the concepts of a TwoWayExecutor,
+    /// and a BulkTwoWayExecutor
+    struct fork_join_executor
+    {
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        typedef parallel_execution_tag execution_category;
+
+        /// Create a new fork_join executor
+        HPX_CONSTEXPR explicit fork_join_executor(
+                threads::thread_priority priority =
+                    threads::thread_priority_boost)
+          : policy_(priority)
+        {}
+
+        /// \cond NOINTERNAL
+        bool operator==(fork_join_executor const& rhs) const noexcept
+        {
+            return policy_ == rhs.policy_;
+        }
+
+        bool operator!=(fork_join_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        fork_join_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+
+        // TwoWayExecutor interface
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        >
+        async_execute(F && f, Ts &&... ts) const
+        {
+            typedef typename
+                    hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+                result_type;
+
+            if (this_thread::can_fork_inline())
+            {
+                return hpx::detail::call_sync(
+                    hpx::util::deferred_call(
+                        std::forward<F>(f), std::forward<Ts>(ts)...),
+                    typename std::is_void<result_type>::type());
+            }
+
+            return hpx::detail::async_launch_policy_dispatch<
+                    launch::fork_policy
+                >::call(policy_, std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts) const
+        {
+            if (this_thread::can_fork_inline())
+            {
+                hpx::util::invoke(std::forward<F>(f), std::forward<Ts>(ts)...);
+                return;
+            }
+
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::fork_join_executor::post");
+
+            detail::post_policy_dispatch<launch::fork_policy>::call(
+                desc, policy_, std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        template <typename F, typename S, typename ... Ts>
+        std::vector<hpx::future<
+            typename detail::bulk_function_result<F, S, Ts...>::type
+        > >
+        bulk_async_execute(F && f, S const& shape, Ts &&... ts) const
+        {
+            typedef std::vector<hpx::future<
+                    typename detail::bulk_function_result<
+                        F, S, Ts...
+                    >::type
+                > > result_type;
+
+            result_type results;
+            results.reserve(hpx::util::size(shape));
+
+            // every element is forked separately, this exposes the remaining
+            // elements to idle worker threads as soon as there are any
+            for (auto const& elem : shape)
+            {
+                results.push_back(async_execute(f, elem, ts...));
+            }
+
+            return results;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & policy_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        launch::fork_policy policy_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_two_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_bulk_two_way_executor<parallel::execution::fork_join_executor>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
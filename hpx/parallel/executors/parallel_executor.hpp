@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/async_launch_policy_dispatch.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/futures_factory.hpp>
 #include <hpx/lcos/when_all.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/executors/post_policy_dispatch.hpp>
@@ -23,7 +24,10 @@
 #include <hpx/traits/is_executor.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/deferred_call.hpp>
 #include <hpx/util/range.hpp>
+#include <hpx/util/thread_description.hpp>
+#include <hpx/util/unique_function.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -203,6 +207,13 @@ namespace hpx { namespace parallel { namespace execution
             // spawn all tasks sequentially
             HPX_ASSERT(base + size <= results.size());
 
+            if (l_ == launch::async)
+            {
+                // hand all tasks to the scheduler at once
+                bulk_spawn(results, base, size, func, it, ts...);
+                return hpx::make_ready_future();
+            }
+
             for (std::size_t i = 0; i != size; ++i, ++it)
             {
                 results[base + i] = async_execute(func, *it, ts...);
@@ -210,6 +221,30 @@ namespace hpx { namespace parallel { namespace execution
 
             return hpx::make_ready_future();
         }
+
+        template <typename Result, typename F, typename Iter, typename ... Ts>
+        void bulk_spawn(std::vector<hpx::future<Result> >& results,
+            std::size_t base, std::size_t size, F const& func, Iter it,
+            Ts const&... ts) const
+        {
+            std::vector<hpx::util::unique_function_nonser<void()> > tasks;
+            tasks.reserve(size);
+
+            for (std::size_t i = 0; i != size; ++i, ++it)
+            {
+                lcos::local::futures_factory<Result()> p(
+                    hpx::util::deferred_call(func, *it, ts...));
+                results[base + i] = p.get_future();
+                tasks.push_back(std::move(p));
+            }
+
+            hpx::util::thread_description desc(func,
+                "hpx::parallel::execution::parallel_executor::"
+                "bulk_async_execute");
+
+            threads::register_work_nullary(tasks, desc, threads::pending,
+                l_.priority());
+        }
         /// \endcond
 
     private:
@@ -14,6 +14,7 @@
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/util/deferred_call.hpp>
 
+#include <cstddef>
 #include <utility>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail
@@ -40,15 +41,21 @@ namespace hpx { namespace parallel { namespace execution { namespace detail
         static void call(hpx::util::thread_description const& desc,
             launch::fork_policy const& policy, F && f, Ts &&... ts)
         {
+            // a stackless thread can't suspend, schedule the new thread
+            // instead of yielding to it
+            bool is_stackless = threads::get_self_stacksize() ==
+                std::size_t(HPX_NOSTACK_STACK_SIZE);
+
             threads::thread_id_type tid = threads::register_thread_nullary(
                 hpx::util::deferred_call(
                     std::forward<F>(f), std::forward<Ts>(ts)...),
-                desc, threads::pending_do_not_schedule, true,
-                policy.priority(), get_worker_thread_num(),
+                desc, is_stackless ?
+                    threads::pending : threads::pending_do_not_schedule,
+                true, policy.priority(), get_worker_thread_num(),
                 threads::thread_stacksize_current);
 
             // make sure this thread is executed last
-            if (tid)
+            if (tid && !is_stackless)
             {
                 // yield_to(tid)
                 hpx::this_thread::suspend(threads::pending, tid,
@@ -0,0 +1,86 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/sample_sort_threshold.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_SAMPLE_SORT_THRESHOLD_HPP)
+#define HPX_PARALLEL_EXECUTORS_SAMPLE_SORT_THRESHOLD_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sequences of at least \a threshold elements are sorted by the
+    /// parallel overloads of \a sort using a sample sort instead of the
+    /// recursive quicksort. The sample sort distributes the elements onto
+    /// buckets which are sorted independently, the memory for each bucket is
+    /// allocated on the NUMA domain of the threads sorting it.
+    ///
+    /// \note Sequences which are sorted using a radix sort (see \a sort) are
+    ///       not affected by this parameter.
+    ///
+    struct sample_sort_threshold
+    {
+        /// Construct a \a sample_sort_threshold executor parameters object
+        ///
+        /// \note By default the sample sort is used for sequences of at
+        ///       least 2^22 elements.
+        ///
+        HPX_CONSTEXPR sample_sort_threshold()
+          : threshold_(std::size_t(1) << 22)
+        {}
+
+        /// Construct a \a sample_sort_threshold executor parameters object
+        ///
+        /// \param threshold    [in] The minimal number of elements to sort
+        ///                     using the sample sort. Passing
+        ///                     std::size_t(-1) disables the sample sort.
+        ///
+        HPX_CONSTEXPR explicit sample_sort_threshold(std::size_t threshold)
+          : threshold_(threshold)
+        {}
+
+        /// \cond NOINTERNAL
+        std::size_t get_sample_sort_threshold() const
+        {
+            return threshold_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & threshold_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t threshold_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<parallel::execution::sample_sort_threshold>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
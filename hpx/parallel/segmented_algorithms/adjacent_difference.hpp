@@ -0,0 +1,228 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_ADJACENT_DIFFERENCE_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_ADJACENT_DIFFERENCE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/adjacent_difference.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/aligned_segments.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <exception>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_adjacent_difference
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Computes the differences of a segment locally. The first element
+        // of all but the first segment is combined with the last element of
+        // the preceding segment (passed in as prev).
+        template <typename Iter, typename T>
+        struct adjacent_difference_segment
+          : public detail::algorithm<adjacent_difference_segment<Iter, T>, Iter>
+        {
+            adjacent_difference_segment()
+              : adjacent_difference_segment::algorithm("adjacent_difference")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename OutIter,
+                typename Op>
+            static OutIter
+            sequential(ExPolicy, InIter first, InIter last, OutIter dest,
+                Op && op, T const& prev, bool has_prev)
+            {
+                OutIter it = std::adjacent_difference(first, last, dest, op);
+                if (has_prev)
+                    *dest = hpx::util::invoke(op, *first, prev);
+                return it;
+            }
+
+            template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+                typename Op>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter2
+            >::type
+            parallel(ExPolicy && policy, FwdIter1 first, FwdIter1 last,
+                FwdIter2 dest, Op && op, T const& prev, bool has_prev)
+            {
+                if (!has_prev)
+                {
+                    return adjacent_difference<FwdIter2>::parallel(
+                        std::forward<ExPolicy>(policy), first, last, dest,
+                        std::forward<Op>(op));
+                }
+
+                // the first element is overwritten once the local
+                // differences are done
+                auto front = hpx::util::invoke(op, *first, prev);
+                return util::detail::convert_to_result(
+                    adjacent_difference<FwdIter2>::parallel(
+                        std::forward<ExPolicy>(policy), first, last, dest,
+                        std::forward<Op>(op)),
+                    [dest, front](FwdIter2 it) -> FwdIter2
+                    {
+                        *dest = front;
+                        return it;
+                    });
+            }
+        };
+
+        // Both sequences have to be partitioned in the same way (see
+        // segments_are_aligned). Only the last element of each segment is
+        // sent to the locality of the following segment, all other
+        // differences are computed locally.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Op, typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter2>::type
+        segmented_adjacent_difference(ExPolicy const& policy, SegIter1 first,
+            SegIter1 last, SegIter2 dest, Op && op, IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+            typedef typename std::iterator_traits<SegIter1>::value_type
+                value_type;
+            typedef adjacent_difference_segment<
+                    local_iterator_type2, value_type
+                > algo_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter2> result;
+
+            SegIter2 dest_last = std::next(dest, std::distance(first, last));
+
+            segment_iterator1 sit1 = traits1::segment(first);
+            segment_iterator1 send1 = traits1::segment(last);
+            segment_iterator2 sit2 = traits2::segment(dest);
+
+            std::vector<future<local_iterator_type2> > segments;
+            segments.reserve(std::distance(sit1, send1) + 1);
+
+            auto add_segment =
+                [&](segment_iterator1 const& it,
+                    local_iterator_type1 const& beg,
+                    local_iterator_type1 const& end,
+                    local_iterator_type2 const& ldest)
+                {
+                    if (beg != end)
+                    {
+                        // fetch the boundary element from the preceding
+                        // segment, if any
+                        SegIter1 pos = traits1::compose(it, beg);
+                        bool has_prev = pos != first;
+                        value_type prev = has_prev ?
+                            value_type(*std::prev(pos)) : value_type();
+
+                        segments.push_back(dispatch_async(traits1::get_id(it),
+                            algo_type(), policy, is_seq, beg, end, ldest, op,
+                            std::move(prev), has_prev));
+                    }
+                };
+
+            if (sit1 == send1)
+            {
+                // all elements are on the same partition
+                add_segment(sit1, traits1::local(first), traits1::local(last),
+                    traits2::local(dest));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit1, traits1::local(first), traits1::end(sit1),
+                    traits2::local(dest));
+
+                // handle all of the full partitions
+                for (++sit1, ++sit2; sit1 != send1; ++sit1, ++sit2)
+                {
+                    add_segment(sit1, traits1::begin(sit1),
+                        traits1::end(sit1), traits2::begin(sit2));
+                }
+
+                // handle the beginning of the last partition
+                add_segment(sit1, traits1::begin(sit1),
+                    traits1::local(last), traits2::begin(sit2));
+            }
+
+            return result::get(
+                dataflow(
+                    [=](std::vector<future<local_iterator_type2> > && r)
+                        -> SegIter2
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+                        return dest_last;
+                    },
+                    std::move(segments)));
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter2>::type
+        adjacent_difference_(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 dest, Op && op, std::false_type);
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter2>::type
+        adjacent_difference_(ExPolicy&& policy, SegIter1 first, SegIter1 last,
+            SegIter2 dest, Op && op, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, SegIter2
+                    >::get(std::move(dest));
+            }
+
+            // the differences are computed element by element if the
+            // destination is partitioned differently
+            if (!segments_are_aligned(first, last, dest))
+            {
+                return adjacent_difference_(std::forward<ExPolicy>(policy),
+                    first, last, dest, std::forward<Op>(op),
+                    std::false_type());
+            }
+
+            return segmented_adjacent_difference(
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::forward<Op>(op), is_seq());
+        }
+
+        /// \endcond
+    }
+}}}
+
+#endif
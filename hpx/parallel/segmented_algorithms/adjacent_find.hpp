@@ -0,0 +1,230 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_ADJACENT_FIND_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_ADJACENT_FIND_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/adjacent_find.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_adjacent_find
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The position of the first pair of adjacent elements found in a
+        // segment (or its size) together with the elements at both ends of
+        // the segment, which are needed to check the pairs straddling the
+        // segment boundaries.
+        template <typename T>
+        struct adjacent_find_result
+        {
+            std::size_t offset_;
+            std::size_t size_;
+            T front_;
+            T back_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & offset_ & size_ & front_ & back_;
+            }
+        };
+
+        template <typename T>
+        struct adjacent_find_segment
+          : public detail::algorithm<
+                adjacent_find_segment<T>, adjacent_find_result<T>
+            >
+        {
+            adjacent_find_segment()
+              : adjacent_find_segment::algorithm("adjacent_find")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename Pred>
+            static adjacent_find_result<T>
+            sequential(ExPolicy, InIter first, InIter last, Pred && op)
+            {
+                std::size_t const size = std::distance(first, last);
+                InIter it = std::adjacent_find(first, last,
+                    std::forward<Pred>(op));
+
+                return adjacent_find_result<T>{
+                    std::size_t(std::distance(first, it)), size,
+                    *first, *std::next(first, size - 1)
+                };
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, adjacent_find_result<T>
+            >::type
+            parallel(ExPolicy && policy, FwdIter first, FwdIter last,
+                Pred && op)
+            {
+                return util::detail::convert_to_result(
+                    adjacent_find<FwdIter>::parallel(
+                        std::forward<ExPolicy>(policy), first, last,
+                        std::forward<Pred>(op)),
+                    [first, last](FwdIter it) -> adjacent_find_result<T>
+                    {
+                        std::size_t const size = std::distance(first, last);
+                        return adjacent_find_result<T>{
+                            std::size_t(std::distance(first, it)), size,
+                            *first, *std::next(first, size - 1)
+                        };
+                    });
+            }
+        };
+
+        // The segments are searched independently, the pairs of elements
+        // straddling two segments are checked once all segments are done.
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_adjacent_find(ExPolicy const& policy, SegIter first,
+            SegIter last, Pred && op, IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef adjacent_find_result<value_type> segment_result;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<future<segment_result> > segments;
+            segments.reserve(std::distance(sit, send) + 1);
+
+            auto add_segment =
+                [&](segment_iterator const& it,
+                    local_iterator_type const& beg,
+                    local_iterator_type const& end)
+                {
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(it),
+                            adjacent_find_segment<value_type>(), policy,
+                            is_seq, beg, end, op));
+                    }
+                };
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_segment(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit, traits::local(first), traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    add_segment(sit, traits::begin(sit), traits::end(sit));
+                }
+
+                // handle the beginning of the last partition
+                add_segment(sit, traits::begin(sit), traits::local(last));
+            }
+
+            typename hpx::util::decay<Pred>::type pred = op;
+            return result::get(
+                dataflow(
+                    [=](std::vector<future<segment_result> > && r) mutable
+                        -> SegIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        std::vector<segment_result> res;
+                        res.reserve(r.size());
+                        for (future<segment_result>& f : r)
+                            res.push_back(f.get());
+
+                        std::size_t pos = 0;
+                        for (std::size_t i = 0; i != res.size(); ++i)
+                        {
+                            if (res[i].offset_ != res[i].size_)
+                                return std::next(first, pos + res[i].offset_);
+
+                            // the last element of this segment may be equal
+                            // to the first element of the next one
+                            if (i + 1 != res.size() &&
+                                pred(res[i].back_, res[i + 1].front_))
+                            {
+                                return std::next(first,
+                                    pos + res[i].size_ - 1);
+                            }
+
+                            pos += res[i].size_;
+                        }
+                        return last;
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        adjacent_find_(ExPolicy && policy, SegIter first, SegIter last,
+            Pred && op, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, SegIter
+                    >::get(std::move(last));
+            }
+
+            return segmented_adjacent_find(std::forward<ExPolicy>(policy),
+                first, last, std::forward<Pred>(op), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        adjacent_find_(ExPolicy && policy, FwdIter first, FwdIter last,
+            Pred && op, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
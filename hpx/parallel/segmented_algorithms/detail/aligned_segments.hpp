@@ -0,0 +1,91 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_ALIGNED_SEGMENTS_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_ALIGNED_SEGMENTS_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <iterator>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // Returns whether the sequence starting at first2 is partitioned in the
+    // same way as [first1, last1), i.e. whether every non-empty piece of the
+    // first sequence is matched by a piece of the second sequence of the same
+    // size which lives on the same locality. Only in this case the segments
+    // of both sequences can be processed pairwise on the locality of the
+    // segment of the first sequence.
+    template <typename SegIter1, typename SegIter2>
+    bool segments_are_aligned(SegIter1 first1, SegIter1 last1,
+        SegIter2 first2)
+    {
+        typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+        typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+        typedef typename traits1::segment_iterator segment_iterator1;
+        typedef typename traits1::local_iterator local_iterator_type1;
+        typedef typename traits2::segment_iterator segment_iterator2;
+        typedef typename traits2::local_iterator local_iterator_type2;
+
+        auto same_locality =
+            [](segment_iterator1 const& it1, segment_iterator2 const& it2)
+            {
+                return naming::get_locality_id_from_id(traits1::get_id(it1)) ==
+                    naming::get_locality_id_from_id(traits2::get_id(it2));
+            };
+
+        segment_iterator1 const sbeg1 = traits1::segment(first1);
+        segment_iterator1 sit1 = sbeg1;
+        segment_iterator1 send1 = traits1::segment(last1);
+        segment_iterator2 sit2 = traits2::segment(first2);
+
+        local_iterator_type1 beg1 = traits1::local(first1);
+        local_iterator_type2 beg2 = traits2::local(first2);
+
+        // all but the last piece have to end on a segment boundary in both
+        // sequences, stop as soon as all elements are accounted for to never
+        // touch segments beyond the end of the second sequence
+        auto count = std::distance(first1, last1);
+        for (/**/; sit1 != send1; ++sit1, ++sit2)
+        {
+            if (sit1 != sbeg1)
+            {
+                beg1 = traits1::begin(sit1);
+                beg2 = traits2::begin(sit2);
+            }
+
+            auto size = std::distance(beg1, traits1::end(sit1));
+            if (size != std::distance(beg2, traits2::end(sit2)))
+                return false;
+
+            if (size != 0 && !same_locality(sit1, sit2))
+                return false;
+
+            count -= size;
+            if (count == 0)
+                return true;
+        }
+
+        // the last piece has to fit into the corresponding segment of the
+        // second sequence
+        if (sbeg1 != send1)
+        {
+            beg1 = traits1::begin(sit1);
+            beg2 = traits2::begin(sit2);
+        }
+
+        return count <= std::distance(beg2, traits2::end(sit2)) &&
+            same_locality(sit1, sit2);
+    }
+
+    /// \endcond
+}}}}
+
+#endif
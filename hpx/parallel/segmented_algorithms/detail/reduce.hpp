@@ -10,6 +10,7 @@
 #include <hpx/util/invoke.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/transform_reduce_binary.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -121,5 +122,43 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail
                 }));
         }
     };
+
+    // The partial result of a segment starts with the transformed first
+    // pair of elements, the initial value is applied only once while
+    // combining the results of all segments.
+    template <typename T>
+    struct seg_transform_reduce_binary
+      : public detail::algorithm<seg_transform_reduce_binary<T>, T>
+    {
+        seg_transform_reduce_binary()
+          : seg_transform_reduce_binary::algorithm("transform_reduce_binary")
+        {}
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename Reduce, typename Convert>
+        static T
+        sequential(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, Reduce && r, Convert && conv)
+        {
+            T init = hpx::util::invoke(conv, *first1, *first2);
+            return transform_reduce_binary<T>::sequential(
+                std::forward<ExPolicy>(policy), ++first1, last1, ++first2,
+                std::move(init), std::forward<Reduce>(r),
+                std::forward<Convert>(conv));
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Reduce, typename Convert>
+        static typename util::detail::algorithm_result<ExPolicy, T>::type
+        parallel(ExPolicy && policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, Reduce && r, Convert && conv)
+        {
+            T init = hpx::util::invoke(conv, *first1, *first2);
+            return transform_reduce_binary<T>::parallel(
+                std::forward<ExPolicy>(policy), ++first1, last1, ++first2,
+                std::move(init), std::forward<Reduce>(r),
+                std::forward<Convert>(conv));
+        }
+    };
 }}}}
 #endif
@@ -81,7 +81,7 @@ namespace hpx { namespace parallel { inline namespace v1
             segment_iterator sit = traits::segment(first);
             segment_iterator send = traits::segment(last);
 
-            segment_output_iterator sdest = traits::segment(dest);
+            segment_output_iterator sdest = output_traits::segment(dest);
 
             if (sit == send)
             {
@@ -94,7 +94,7 @@ namespace hpx { namespace parallel { inline namespace v1
                     local_iterator_pair p = dispatch(
                         traits::get_id(sit),
                         algo, policy, std::true_type(),
-                        beg, end, traits::local(dest));
+                        beg, end, output_traits::local(dest));
 
                     dest = output_traits::compose(sdest, p.second);
                 }
@@ -103,7 +103,7 @@ namespace hpx { namespace parallel { inline namespace v1
                 // handle the remaining part of the first partition
                 local_iterator_type beg = traits::local(first);
                 local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
+                local_output_iterator_type out = output_traits::local(dest);
 
                 if (beg != end)
                 {
@@ -118,7 +118,7 @@ namespace hpx { namespace parallel { inline namespace v1
                 {
                     beg = traits::begin(sit);
                     end = traits::end(sit);
-                    out = traits::begin(sdest);
+                    out = output_traits::begin(sdest);
 
                     if (beg != end)
                     {
@@ -137,7 +137,7 @@ namespace hpx { namespace parallel { inline namespace v1
                     local_iterator_pair p = dispatch(
                         traits::get_id(sit),
                         algo, policy, std::true_type(), beg, end,
-                        traits::begin(sdest));
+                        output_traits::begin(sdest));
                     out = p.second;
                 }
 
@@ -180,7 +180,7 @@ namespace hpx { namespace parallel { inline namespace v1
             segment_iterator sit = traits::segment(first);
             segment_iterator send = traits::segment(last);
 
-            segment_output_iterator sdest = traits::segment(dest);
+            segment_output_iterator sdest = output_traits::segment(dest);
 
             std::vector<shared_future<local_iterator_pair> > segments;
             segments.reserve(std::distance(sit, send));
@@ -195,14 +195,14 @@ namespace hpx { namespace parallel { inline namespace v1
                 {
                     segments.push_back(dispatch_async(traits::get_id(sit),
                         algo, policy, forced_seq(),
-                        beg, end, traits::local(dest)));
+                        beg, end, output_traits::local(dest)));
                 }
             }
             else {
                 // handle the remaining part of the first partition
                 local_iterator_type beg = traits::local(first);
                 local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
+                local_output_iterator_type out = output_traits::local(dest);
 
                 if (beg != end)
                 {
@@ -215,7 +215,7 @@ namespace hpx { namespace parallel { inline namespace v1
                 {
                     beg = traits::begin(sit);
                     end = traits::end(sit);
-                    out = traits::begin(sdest);
+                    out = output_traits::begin(sdest);
 
                     if (beg != end)
                     {
@@ -232,7 +232,7 @@ namespace hpx { namespace parallel { inline namespace v1
                 {
                     segments.push_back(dispatch_async(traits::get_id(sit),
                         algo, policy, forced_seq(),
-                        beg, end, traits::begin(sdest)));
+                        beg, end, output_traits::begin(sdest)));
                 }
             }
             HPX_ASSERT(!segments.empty());
@@ -250,8 +250,7 @@ namespace hpx { namespace parallel { inline namespace v1
                         >::call(r, errors);
 
                         local_iterator_pair p = r.back().get();
-                        return std::make_pair(
-                                output_traits::compose(sdest, p.first),
+                        return std::make_pair(last,
                                 output_traits::compose(sdest, p.second)
                             );
                     },
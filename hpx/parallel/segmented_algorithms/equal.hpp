@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_EQUAL_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_EQUAL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/aligned_segments.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_equal
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Both sequences have to be partitioned in the same way (see
+        // segments_are_aligned), the elements are compared on the localities
+        // of the segments of the first sequence.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred, typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        segmented_equal(ExPolicy const& policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, Pred && op, IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            segment_iterator1 sit1 = traits1::segment(first1);
+            segment_iterator1 send1 = traits1::segment(last1);
+            segment_iterator2 sit2 = traits2::segment(first2);
+
+            std::vector<future<bool> > segments;
+            segments.reserve(std::distance(sit1, send1) + 1);
+
+            auto add_segment =
+                [&](segment_iterator1 const& it,
+                    local_iterator_type1 const& beg1,
+                    local_iterator_type1 const& end1,
+                    local_iterator_type2 const& beg2)
+                {
+                    if (beg1 != end1)
+                    {
+                        segments.push_back(dispatch_async(traits1::get_id(it),
+                            detail::equal(), policy, is_seq, beg1, end1, beg2,
+                            op));
+                    }
+                };
+
+            if (sit1 == send1)
+            {
+                // all elements are on the same partition
+                add_segment(sit1, traits1::local(first1),
+                    traits1::local(last1), traits2::local(first2));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit1, traits1::local(first1), traits1::end(sit1),
+                    traits2::local(first2));
+
+                // handle all of the full partitions
+                for (++sit1, ++sit2; sit1 != send1; ++sit1, ++sit2)
+                {
+                    add_segment(sit1, traits1::begin(sit1),
+                        traits1::end(sit1), traits2::begin(sit2));
+                }
+
+                // handle the beginning of the last partition
+                add_segment(sit1, traits1::begin(sit1),
+                    traits1::local(last1), traits2::begin(sit2));
+            }
+
+            return result::get(
+                dataflow(
+                    [=](std::vector<future<bool> > && r) -> bool
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        for (future<bool>& f : r)
+                        {
+                            if (!f.get())
+                                return false;
+                        }
+                        return true;
+                    },
+                    std::move(segments)));
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, Pred && op, std::false_type);
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_binary_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, FwdIter2 last2, Pred && op, std::false_type);
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy&& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, Pred && op, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+
+            if (first1 == last1)
+            {
+                return util::detail::algorithm_result<ExPolicy, bool>::get(
+                    true);
+            }
+
+            // sequences which are partitioned differently are compared
+            // element by element
+            if (!segments_are_aligned(first1, last1, first2))
+            {
+                return equal_(std::forward<ExPolicy>(policy), first1, last1,
+                    first2, std::forward<Pred>(op), std::false_type());
+            }
+
+            return segmented_equal(std::forward<ExPolicy>(policy), first1,
+                last1, first2, std::forward<Pred>(op), is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_binary_(ExPolicy&& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, Pred && op, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+
+            // sequences of different length are never equal, the predicate
+            // is not applied in this case
+            if (std::distance(first1, last1) != std::distance(first2, last2))
+            {
+                return util::detail::algorithm_result<ExPolicy, bool>::get(
+                    false);
+            }
+
+            if (first1 == last1)
+            {
+                return util::detail::algorithm_result<ExPolicy, bool>::get(
+                    true);
+            }
+
+            if (!segments_are_aligned(first1, last1, first2))
+            {
+                return equal_binary_(std::forward<ExPolicy>(policy), first1,
+                    last1, first2, last2, std::forward<Pred>(op),
+                    std::false_type());
+            }
+
+            return segmented_equal(std::forward<ExPolicy>(policy), first1,
+                last1, first2, std::forward<Pred>(op), is_seq());
+        }
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -14,6 +14,7 @@
 #include <hpx/parallel/segmented_algorithms/for_each.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <iterator>
 #include <list>
@@ -74,6 +75,27 @@ namespace hpx { namespace parallel { inline namespace v1
             ExPolicy, void>::type
         fill_(ExPolicy && policy, InIter first, InIter last, T const& value,
             std::false_type);
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        fill_n_(ExPolicy && policy, SegIter first, std::size_t count,
+            T const& value, std::true_type)
+        {
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            return hpx::parallel::for_each(std::forward<ExPolicy>(policy),
+                first, std::next(first, count),
+                fill_function<value_type>(value));
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        fill_n_(ExPolicy && policy, FwdIter first, std::size_t count,
+            T const& value, std::false_type);
     }
         /// \endcond
 }}}
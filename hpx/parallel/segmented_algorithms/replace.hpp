@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_REPLACE_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_REPLACE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/replace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/for_each.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_replace
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The replacement is applied in place on the locality of each
+        // segment, only the function object below is sent over the wire.
+        template <typename T1, typename T2, typename Proj>
+        struct replace_function
+        {
+            replace_function(T1 old_value = T1(), T2 new_value = T2(),
+                    Proj proj = Proj())
+              : old_value_(std::move(old_value))
+              , new_value_(std::move(new_value))
+              , proj_(std::move(proj))
+            {}
+
+            T1 old_value_;
+            T2 new_value_;
+            Proj proj_;
+
+            template <typename T>
+            void operator()(T& val) const
+            {
+                if (hpx::util::invoke(proj_, val) == old_value_)
+                    val = new_value_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned version)
+            {
+                ar & old_value_ & new_value_ & proj_;
+            }
+        };
+
+        template <typename F, typename T, typename Proj>
+        struct replace_if_function
+        {
+            replace_if_function(F f = F(), T new_value = T(),
+                    Proj proj = Proj())
+              : f_(std::move(f))
+              , new_value_(std::move(new_value))
+              , proj_(std::move(proj))
+            {}
+
+            F f_;
+            T new_value_;
+            Proj proj_;
+
+            template <typename U>
+            void operator()(U& val) const
+            {
+                using hpx::util::invoke;
+                if (invoke(f_, invoke(proj_, val)))
+                    val = new_value_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned version)
+            {
+                ar & f_ & new_value_ & proj_;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T1,
+            typename T2, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        replace_(ExPolicy && policy, SegIter first, SegIter last,
+            T1 const& old_value, T2 const& new_value, Proj && proj,
+            std::true_type)
+        {
+            typedef replace_function<
+                    T1, T2, typename hpx::util::decay<Proj>::type
+                > function_type;
+
+            return hpx::parallel::for_each(std::forward<ExPolicy>(policy),
+                first, last, function_type(old_value, new_value,
+                    std::forward<Proj>(proj)));
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F, typename T,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        replace_if_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            T const& new_value, Proj && proj, std::true_type)
+        {
+            typedef replace_if_function<
+                    typename hpx::util::decay<F>::type, T,
+                    typename hpx::util::decay<Proj>::type
+                > function_type;
+
+            return hpx::parallel::for_each(std::forward<ExPolicy>(policy),
+                first, last, function_type(std::forward<F>(f), new_value,
+                    std::forward<Proj>(proj)));
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename FwdIter, typename T1,
+            typename T2, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        replace_(ExPolicy && policy, FwdIter first, FwdIter last,
+            T1 const& old_value, T2 const& new_value, Proj && proj,
+            std::false_type);
+
+        template <typename ExPolicy, typename FwdIter, typename F, typename T,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        replace_if_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            T const& new_value, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
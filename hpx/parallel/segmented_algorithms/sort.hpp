@@ -0,0 +1,631 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_HPP)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/latch.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Number of elements taken from each sorted segment to select the
+        // global splitters from.
+        static const std::size_t segmented_sort_samples = 128;
+
+        // Number of buckets per segment. The elements of a bucket which
+        // straddles the boundary of two segments are sent to both of them.
+        static const std::size_t segmented_sort_buckets = 8;
+
+        // Position of the k-th out of count samples taken from a sorted
+        // segment holding size elements.
+        inline std::size_t segmented_sort_sample_index(std::size_t size,
+            std::size_t count, std::size_t k)
+        {
+            return ((2 * k + 1) * size) / (2 * count);
+        }
+
+        // Splitters are ordered by their value first and by their position in
+        // the sequence second. This way equivalent elements are distributed
+        // over several buckets as well.
+        template <typename T>
+        struct sort_splitter
+        {
+            T value_;
+            std::size_t segment_;
+            std::size_t index_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & value_ & segment_ & index_;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // sorts a segment on the locality it resides on
+        template <typename Iter>
+        struct sort_segment
+          : public detail::algorithm<sort_segment<Iter>, Iter>
+        {
+            sort_segment()
+              : sort_segment::algorithm("sort")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static RandomIt
+            sequential(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                return detail::sort<RandomIt>::sequential(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                return detail::sort<RandomIt>::parallel(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+        };
+
+        // returns evenly spaced samples of a sorted segment
+        template <typename T>
+        struct sort_segment_samples
+          : public detail::algorithm<sort_segment_samples<T>, std::vector<T> >
+        {
+            sort_segment_samples()
+              : sort_segment_samples::algorithm("sort")
+            {}
+
+            template <typename ExPolicy, typename RandomIt>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::size_t count)
+            {
+                std::size_t const size = std::distance(first, last);
+
+                std::vector<T> samples;
+                samples.reserve(count);
+                for (std::size_t k = 0; k != count; ++k)
+                {
+                    samples.push_back(
+                        first[segmented_sort_sample_index(size, count, k)]);
+                }
+                return samples;
+            }
+        };
+
+        // returns the positions of the given splitters in a sorted segment
+        template <typename T>
+        struct sort_segment_bounds
+          : public detail::algorithm<
+                sort_segment_bounds<T>, std::vector<std::size_t>
+            >
+        {
+            sort_segment_bounds()
+              : sort_segment_bounds::algorithm("sort")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<std::size_t>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<sort_splitter<T> > const& splitters,
+                std::size_t segment, Compare && comp, Proj && proj)
+            {
+                util::compare_projected<Compare, Proj> c(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                std::vector<std::size_t> bounds;
+                bounds.reserve(splitters.size() + 2);
+                bounds.push_back(0);
+
+                // the splitters are sorted, each search starts at the
+                // position of the previous splitter
+                for (sort_splitter<T> const& s : splitters)
+                {
+                    RandomIt it = first + bounds.back();
+                    if (s.segment_ == segment)
+                    {
+                        bounds.push_back(s.index_);
+                    }
+                    else if (s.segment_ > segment)
+                    {
+                        // equivalent elements of this segment precede the
+                        // splitter
+                        bounds.push_back(std::distance(first,
+                            std::upper_bound(it, last, s.value_, c)));
+                    }
+                    else
+                    {
+                        bounds.push_back(std::distance(first,
+                            std::lower_bound(it, last, s.value_, c)));
+                    }
+                }
+
+                bounds.push_back(std::distance(first, last));
+                return bounds;
+            }
+        };
+
+        // returns a copy of the elements of a segment
+        template <typename T>
+        struct sort_segment_copy
+          : public detail::algorithm<sort_segment_copy<T>, std::vector<T> >
+        {
+            sort_segment_copy()
+              : sort_segment_copy::algorithm("sort")
+            {}
+
+            template <typename ExPolicy, typename RandomIt>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last)
+            {
+                return std::vector<T>(first, last);
+            }
+        };
+
+        // Fetches the sorted runs of all segments holding elements which end
+        // up in the given segment and merges them. The segment is overwritten
+        // only after all segments have fetched their runs.
+        template <typename Iter>
+        struct sort_segment_merge
+          : public detail::algorithm<sort_segment_merge<Iter>, Iter>
+        {
+            sort_segment_merge()
+              : sort_segment_merge::algorithm("sort")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename LocalIter,
+                typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy && policy, RandomIt first, RandomIt last,
+                std::vector<id_type> const& ids,
+                std::vector<LocalIter> const& begins,
+                std::vector<LocalIter> const& ends, std::size_t skip,
+                hpx::lcos::latch l, Compare && comp, Proj && proj)
+            {
+                typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+                typedef typename std::iterator_traits<RandomIt>::value_type
+                    value_type;
+
+                std::vector<value_type> buffer;
+                std::exception_ptr error;
+
+                try {
+                    std::vector<hpx::future<std::vector<value_type> > > runs;
+                    runs.reserve(ids.size());
+
+                    for (std::size_t i = 0; i != ids.size(); ++i)
+                    {
+                        runs.push_back(dispatch_async(ids[i],
+                            sort_segment_copy<value_type>(), execution::seq,
+                            std::true_type(), begins[i], ends[i]));
+                    }
+
+                    hpx::wait_all(runs);
+
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                            policy_type
+                        >::call(runs, errors);
+
+                    std::vector<std::vector<value_type> > data =
+                        hpx::util::unwrap(std::move(runs));
+
+                    std::size_t size = 0;
+                    for (std::vector<value_type> const& run : data)
+                        size += run.size();
+
+                    std::vector<std::size_t> bounds;
+                    bounds.reserve(data.size() + 1);
+                    bounds.push_back(0);
+
+                    buffer.reserve(size);
+                    for (std::vector<value_type>& run : data)
+                    {
+                        std::move(run.begin(), run.end(),
+                            std::back_inserter(buffer));
+                        bounds.push_back(buffer.size());
+                    }
+
+                    // merge neighboring runs until a single run is left, the
+                    // merges keep equivalent elements in the order of the
+                    // segments they originate from
+                    util::compare_projected<Compare, Proj> c(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                    while (bounds.size() > 2)
+                    {
+                        sort_for_each_chunk(policy, (bounds.size() - 1) / 2,
+                            [&](std::size_t p)
+                            {
+                                std::inplace_merge(
+                                    buffer.begin() + bounds[2 * p],
+                                    buffer.begin() + bounds[2 * p + 1],
+                                    buffer.begin() + bounds[2 * p + 2], c);
+                            });
+
+                        std::vector<std::size_t> merged;
+                        merged.reserve(bounds.size() / 2 + 1);
+                        for (std::size_t i = 0; i < bounds.size(); i += 2)
+                            merged.push_back(bounds[i]);
+                        if (bounds.size() % 2 == 0)
+                            merged.push_back(bounds.back());
+
+                        bounds.swap(merged);
+                    }
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+
+                // None of the segments may be overwritten before all of them
+                // have fetched their runs. The latch is counted down on error
+                // as well, a merge which has started returns only after all
+                // merges have counted down (see sort_exchange).
+                l.count_down_and_wait();
+
+                if (error)
+                    std::rethrow_exception(error);
+
+                return std::move(buffer.begin() + skip,
+                    buffer.begin() + skip + std::distance(first, last), first);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Moves the elements of the sorted segments to their final position:
+        // the splitters are selected from samples of all segments, each
+        // segment merges the runs of elements of all buckets overlapping
+        // with it.
+        template <typename ExPolicy, typename LocalIter, typename Compare,
+            typename Proj>
+        void sort_exchange(ExPolicy const& policy,
+            std::vector<id_type> const& ids,
+            std::vector<LocalIter> const& begins,
+            std::vector<LocalIter> const& ends,
+            Compare const& comp, Proj const& proj)
+        {
+            typedef typename std::iterator_traits<LocalIter>::value_type
+                value_type;
+            typedef sort_splitter<value_type> splitter_type;
+
+            std::size_t const segments = ids.size();
+
+            std::vector<std::size_t> sizes;
+            sizes.reserve(segments);
+
+            std::vector<hpx::future<std::vector<value_type> > > samples;
+            samples.reserve(segments);
+
+            for (std::size_t i = 0; i != segments; ++i)
+            {
+                sizes.push_back(std::distance(begins[i], ends[i]));
+                samples.push_back(dispatch_async(ids[i],
+                    sort_segment_samples<value_type>(), execution::seq,
+                    std::true_type(), begins[i], ends[i],
+                    (std::min)(sizes.back(), segmented_sort_samples)));
+            }
+
+            hpx::wait_all(samples);
+
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy
+                >::call(samples, errors);
+
+            // each sample stands for the elements between its own position
+            // and the position of the next sample of the same segment
+            std::vector<std::pair<splitter_type, std::size_t> > candidates;
+            candidates.reserve(segments * segmented_sort_samples);
+
+            std::size_t total = 0;
+            for (std::size_t i = 0; i != segments; ++i)
+            {
+                std::vector<value_type> values = samples[i].get();
+
+                std::size_t const size = sizes[i];
+                std::size_t const count = values.size();
+                for (std::size_t k = 0; k != count; ++k)
+                {
+                    splitter_type s = { std::move(values[k]), i,
+                        segmented_sort_sample_index(size, count, k) };
+                    candidates.push_back(std::make_pair(std::move(s),
+                        ((k + 1) * size) / count - (k * size) / count));
+                }
+
+                total += size;
+            }
+
+            util::compare_projected<Compare const&, Proj const&> c(comp, proj);
+
+            std::sort(candidates.begin(), candidates.end(),
+                [&c](std::pair<splitter_type, std::size_t> const& lhs,
+                    std::pair<splitter_type, std::size_t> const& rhs)
+                {
+                    if (c(lhs.first.value_, rhs.first.value_))
+                        return true;
+                    if (c(rhs.first.value_, lhs.first.value_))
+                        return false;
+                    return lhs.first.segment_ < rhs.first.segment_ ||
+                        (lhs.first.segment_ == rhs.first.segment_ &&
+                            lhs.first.index_ < rhs.first.index_);
+                });
+
+            // select the splitters such that the buckets are expected to
+            // hold the same number of elements
+            std::size_t const buckets = segments * segmented_sort_buckets;
+
+            std::vector<splitter_type> splitters;
+            splitters.reserve(buckets - 1);
+
+            std::size_t seen = 0;
+            std::size_t b = 1;
+            for (auto& candidate : candidates)
+            {
+                seen += candidate.second;
+                if (b != buckets && seen * buckets >= b * total)
+                {
+                    splitters.push_back(std::move(candidate.first));
+                    while (b != buckets && seen * buckets >= b * total)
+                        ++b;
+                }
+            }
+
+            // determine the positions of the splitters in all segments
+            std::vector<hpx::future<std::vector<std::size_t> > > bounds;
+            bounds.reserve(segments);
+
+            for (std::size_t i = 0; i != segments; ++i)
+            {
+                bounds.push_back(dispatch_async(ids[i],
+                    sort_segment_bounds<value_type>(), execution::seq,
+                    std::true_type(), begins[i], ends[i], splitters, i,
+                    comp, proj));
+            }
+
+            hpx::wait_all(bounds);
+            parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy
+                >::call(bounds, errors);
+
+            std::vector<std::vector<std::size_t> > positions =
+                hpx::util::unwrap(std::move(bounds));
+
+            // offsets[j] is the global position of the first element of
+            // bucket j
+            std::size_t const nb = splitters.size() + 1;
+
+            std::vector<std::size_t> offsets(nb + 1, 0);
+            for (std::size_t j = 0; j != nb; ++j)
+            {
+                offsets[j + 1] = offsets[j];
+                for (std::size_t i = 0; i != segments; ++i)
+                    offsets[j + 1] += positions[i][j + 1] - positions[i][j];
+            }
+
+            // every segment merges the runs of all buckets it overlaps with
+            hpx::lcos::latch l(static_cast<std::ptrdiff_t>(segments));
+
+            std::vector<hpx::future<LocalIter> > merged;
+            merged.reserve(segments);
+
+            std::size_t start = 0;
+            for (std::size_t d = 0; d != segments; ++d)
+            {
+                std::size_t const end = start + sizes[d];
+
+                std::size_t const lo = std::distance(offsets.begin(),
+                    std::upper_bound(offsets.begin(), offsets.end(), start)) - 1;
+                std::size_t const hi = std::distance(offsets.begin(),
+                    std::lower_bound(offsets.begin(), offsets.end(), end));
+
+                std::vector<id_type> run_ids;
+                std::vector<LocalIter> run_begins;
+                std::vector<LocalIter> run_ends;
+
+                for (std::size_t i = 0; i != segments; ++i)
+                {
+                    std::size_t const from = positions[i][lo];
+                    std::size_t const to = positions[i][hi];
+                    if (from != to)
+                    {
+                        run_ids.push_back(ids[i]);
+                        run_begins.push_back(std::next(begins[i], from));
+                        run_ends.push_back(std::next(begins[i], to));
+                    }
+                }
+
+                hpx::future<LocalIter> f;
+                try {
+                    f = dispatch_async(ids[d],
+                        sort_segment_merge<LocalIter>(), policy,
+                        std::true_type(), begins[d], ends[d],
+                        std::move(run_ids), std::move(run_begins),
+                        std::move(run_ends), start - offsets[lo], l, comp,
+                        proj);
+                }
+                catch (...) {
+                    f = hpx::make_exceptional_future<LocalIter>(
+                        std::current_exception());
+                }
+
+                // A merge which failed before it has started never counts
+                // down the latch, which would block all other merges forever.
+                // Merges which have started finish only after the latch was
+                // released, so a merge failing while the latch is not ready
+                // yet is known to have never started.
+                merged.push_back(f.then(
+                    [l](hpx::future<LocalIter> && r) mutable -> LocalIter
+                    {
+                        if (r.has_exception() && !l.is_ready())
+                            l.count_down(1);
+                        return r.get();
+                    }));
+
+                start = end;
+            }
+
+            hpx::wait_all(merged);
+            parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy
+                >::call(merged, errors);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj, typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_sort(ExPolicy const& policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<id_type> ids;
+            std::vector<local_iterator_type> begins;
+            std::vector<local_iterator_type> ends;
+
+            auto add_segment =
+                [&](segment_iterator const& it, local_iterator_type const& beg,
+                    local_iterator_type const& end)
+                {
+                    if (beg != end)
+                    {
+                        ids.push_back(traits::get_id(it));
+                        begins.push_back(beg);
+                        ends.push_back(end);
+                    }
+                };
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_segment(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit, traits::local(first), traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                    add_segment(sit, traits::begin(sit), traits::end(sit));
+
+                // handle the beginning of the last partition
+                add_segment(sit, traits::begin(sit), traits::local(last));
+            }
+
+            if (ids.empty())
+                return result::get(std::move(last));
+
+            // sort all segments on their localities
+            std::vector<hpx::future<local_iterator_type> > segments;
+            segments.reserve(ids.size());
+
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                segments.push_back(dispatch_async(ids[i],
+                    sort_segment<local_iterator_type>(), policy, is_seq,
+                    begins[i], ends[i], comp, proj));
+            }
+
+            return result::get(
+                dataflow(
+                    [=](std::vector<hpx::future<local_iterator_type> > && r)
+                        -> SegIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        if (ids.size() != 1)
+                        {
+                            sort_exchange(
+                                policy, ids, begins, ends, comp, proj);
+                        }
+                        return last;
+                    },
+                    std::move(segments)));
+        }
+
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy && policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+
+            return segmented_sort(std::forward<ExPolicy>(policy), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj),
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -7,11 +7,14 @@
 #define HPX_PARALLEL_SEGMENTED_ALGORITHM_TRANSFORM_REDUCE_DEC_17_2014_1157AM
 
 #include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
 #include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/algorithms/transform_reduce_binary.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/reduce.hpp>
@@ -244,6 +247,126 @@ namespace hpx { namespace parallel { inline namespace v1
         transform_reduce_(ExPolicy&& policy, InIter first, InIter last, T && init,
             Reduce && red_op, Convert && conv_op, std::false_type);
 
+        ///////////////////////////////////////////////////////////////////////
+        // Both input sequences are expected to be partitioned in the same way,
+        // the partial results are computed on the localities of the segments
+        // of the first sequence.
+        template <typename Algo, typename ExPolicy, typename SegIter1,
+            typename SegIter2, typename T, typename Reduce, typename Convert,
+            typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        segmented_transform_reduce_binary(Algo && algo,
+            ExPolicy const& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, T && init, Reduce && red_op, Convert && conv_op,
+            IsSeq is_seq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef hpx::traits::segmented_iterator_traits<SegIter2> traits2;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+            typedef typename hpx::util::decay<T>::type init_type;
+            typedef util::detail::algorithm_result<ExPolicy, init_type> result;
+
+            segment_iterator1 sit1 = traits1::segment(first1);
+            segment_iterator1 send1 = traits1::segment(last1);
+            segment_iterator2 sit2 = traits2::segment(first2);
+
+            std::vector<future<init_type> > segments;
+            segments.reserve(std::distance(sit1, send1) + 1);
+
+            auto add_segment =
+                [&](segment_iterator1 const& it,
+                    local_iterator_type1 const& beg1,
+                    local_iterator_type1 const& end1,
+                    local_iterator_type2 const& beg2)
+                {
+                    if (beg1 != end1)
+                    {
+                        segments.push_back(dispatch_async(traits1::get_id(it),
+                            algo, policy, is_seq, beg1, end1, beg2, red_op,
+                            conv_op));
+                    }
+                };
+
+            if (sit1 == send1)
+            {
+                // all elements are on the same partition
+                add_segment(sit1, traits1::local(first1),
+                    traits1::local(last1), traits2::local(first2));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_segment(sit1, traits1::local(first1), traits1::end(sit1),
+                    traits2::local(first2));
+
+                // handle all of the full partitions
+                for (++sit1, ++sit2; sit1 != send1; ++sit1, ++sit2)
+                {
+                    add_segment(sit1, traits1::begin(sit1),
+                        traits1::end(sit1), traits2::begin(sit2));
+                }
+
+                // handle the beginning of the last partition
+                add_segment(sit1, traits1::begin(sit1),
+                    traits1::local(last1), traits2::begin(sit2));
+            }
+
+            return result::get(
+                dataflow(
+                    [=](std::vector<future<init_type> > && r) -> init_type
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        // the partial results are combined in order
+                        init_type val = init;
+                        for (future<init_type>& curr : r)
+                            val = hpx::util::invoke(red_op, val, curr.get());
+                        return val;
+                    },
+                    std::move(segments)));
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename T, typename Reduce, typename Convert>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        transform_reduce_binary_(ExPolicy && policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, T && init, Reduce && red_op,
+            Convert && conv_op, std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<
+                    ExPolicy
+                > is_seq;
+            typedef typename hpx::util::decay<T>::type init_type;
+
+            if (first1 == last1)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, init_type
+                    >::get(std::forward<T>(init));
+            }
+
+            return segmented_transform_reduce_binary(
+                seg_transform_reduce_binary<init_type>(),
+                std::forward<ExPolicy>(policy), first1, last1, first2,
+                std::forward<T>(init), std::forward<Reduce>(red_op),
+                std::forward<Convert>(conv_op), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename T, typename Reduce, typename Convert>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        transform_reduce_binary_(ExPolicy && policy, FwdIter1 first1,
+            FwdIter1 last1, FwdIter2 first2, T && init, Reduce && red_op,
+            Convert && conv_op, std::false_type);
+
         /// \endcond
     }
 }}}
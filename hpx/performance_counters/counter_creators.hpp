@@ -143,6 +143,19 @@ namespace hpx { namespace performance_counters
         counter_info const&, discover_counter_func const&,
         discover_counters_mode, error_code&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation functions for pipeline stage counters
+    HPX_API_EXPORT naming::gid_type pipeline_processed_counter_creator(
+        counter_info const&, error_code&);
+
+    HPX_API_EXPORT naming::gid_type pipeline_queue_length_counter_creator(
+        counter_info const&, error_code&);
+
+    // Discoverer function for pipeline stage counters
+    HPX_API_EXPORT bool pipeline_stage_counter_discoverer(
+        counter_info const&, discover_counter_func const&,
+        discover_counters_mode, error_code&);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     ///////////////////////////////////////////////////////////////////////////
     // Creation function for per-action parcel data counters
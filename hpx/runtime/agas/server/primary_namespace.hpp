@@ -13,6 +13,7 @@
 #include <hpx/config.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/lcos/local/condition_variable.hpp>
+#include <hpx/lcos/local/runtime_spinlock.hpp>
 #include <hpx/runtime/agas_fwd.hpp>
 #include <hpx/runtime/agas/gva.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
@@ -118,7 +119,7 @@ struct HPX_EXPORT primary_namespace
   : components::fixed_component_base<primary_namespace>
 {
     // {{{ nested types
-    typedef lcos::local::spinlock mutex_type;
+    typedef lcos::local::runtime_spinlock mutex_type;
     typedef components::fixed_component_base<primary_namespace> base_type;
 
     typedef std::int32_t component_type;
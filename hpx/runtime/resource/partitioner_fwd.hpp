@@ -64,7 +64,9 @@ namespace hpx
             abp_priority = 5,
             hierarchy = 6,
             periodic_priority = 7,
-            throttle = 8
+            throttle = 8,
+            numa_stealing = 9,
+            deadline = 10
         };
     }
 }
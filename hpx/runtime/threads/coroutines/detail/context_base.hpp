@@ -88,10 +88,15 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     /////////////////////////////////////////////////////////////////////////////
     std::ptrdiff_t const default_stack_size = -1;
 
+    // Stackless coroutines do not own a stack, they are executed directly on
+    // the stack of the thread invoking them and run to completion.
+    std::ptrdiff_t const nostack_stack_size = HPX_NOSTACK_STACK_SIZE;
+
     class context_base : public default_context_impl
     {
     public:
         typedef void deleter_type(context_base const*);
+        typedef void invoker_type(context_base*);
         typedef void* thread_id_repr_type;
 
         template <typename Derived>
@@ -102,6 +107,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             m_counter(0),
 #endif
             m_deleter(&deleter<Derived>),
+            m_stackless_invoker(&stackless_invoker<Derived>),
             m_state(ctx_ready),
             m_exit_state(ctx_exit_not_requested),
             m_exit_status(ctx_not_exited),
@@ -311,6 +317,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             return m_state == ctx_exited;
         }
 
+        // Returns true if this context does not own a stack, i.e. if it is
+        // executed on the stack of the invoking thread and can't be suspended.
+        bool is_stackless() const
+        {
+            return this->get_stacksize() == nostack_stack_size;
+        }
+
         // Resume coroutine.
         // Pre:  The coroutine must be ready.
         // Post: The coroutine relinquished control. It might be ready, waiting
@@ -361,6 +374,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         //         resumed.
         void yield()
         {
+            HPX_ASSERT(!is_stackless());
             HPX_ASSERT(m_exit_state < ctx_exit_signaled); //prevent infinite loops
             HPX_ASSERT(running());
             HPX_ASSERT(!pending());
@@ -620,7 +634,23 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             ++m_phase;
 #endif
             m_state = ctx_running;
-            swap_context(m_caller, *this, detail::invoke_hint());
+
+            // stackless contexts run to completion on the current stack
+            if (is_stackless())
+                m_stackless_invoker(this);
+            else
+                swap_context(m_caller, *this, detail::invoke_hint());
+        }
+
+        // Nothrow.
+        void do_return_stackless(context_exit_status status,
+            std::exception_ptr && info) noexcept
+        {
+            HPX_ASSERT(status != ctx_not_exited);
+            HPX_ASSERT(m_state == ctx_running);
+            m_type_info = std::move(info);
+            m_state = ctx_exited;
+            m_exit_status = status;
         }
 
         template <typename ActualCtx>
@@ -629,6 +659,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             ActualCtx::destroy(static_cast<ActualCtx*>(const_cast<context_base*>(ctx)));
         }
 
+        template <typename ActualCtx>
+        static void stackless_invoker(context_base* ctx)
+        {
+            static_cast<ActualCtx*>(ctx)->invoke_stackless();
+        }
+
         typedef default_context_impl::context_impl_base ctx_type;
         ctx_type m_caller;
 
@@ -637,6 +673,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 #endif
         static HPX_EXPORT allocation_counters m_allocation_counters;
         deleter_type* m_deleter;
+        invoker_type* m_stackless_invoker;
         context_state m_state;
         context_exit_state m_exit_state;
         context_exit_status m_exit_status;
@@ -230,8 +230,13 @@ namespace hpx { namespace threads { namespace coroutines
                     (stack_size == -1) ?
                     alloc_.minimum_stacksize() : std::size_t(stack_size)
                 )
-              , stack_pointer_(alloc_.allocate(stack_size_))
+              , stack_pointer_(stack_size == HPX_NOSTACK_STACK_SIZE ?
+                    nullptr : alloc_.allocate(stack_size_))
             {
+                // stackless contexts are run directly on the caller's stack
+                if (stack_size == HPX_NOSTACK_STACK_SIZE)
+                    return;
+
 #if BOOST_VERSION < 105600
                 boost::context::fcontext_t* ctx =
                     boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
@@ -189,6 +189,10 @@ namespace hpx { namespace threads { namespace coroutines
                   : stack_size),
                 m_stack(nullptr)
             {
+                // stackless contexts are run directly on the caller's stack
+                if (m_stack_size == HPX_NOSTACK_STACK_SIZE)
+                    return;
+
                 if (0 != (m_stack_size % EXEC_PAGESIZE))
                 {
                     throw std::runtime_error(
@@ -199,6 +199,7 @@ namespace hpx { namespace threads { namespace coroutines
             template<typename Functor>
             explicit fibers_context_impl(Functor& cb, std::ptrdiff_t stack_size)
               : fibers_context_impl_base(
+                    stack_size == HPX_NOSTACK_STACK_SIZE ? nullptr :
                     CreateFiberEx(stack_size == -1 ? default_stack_size : stack_size,
                         stack_size == -1 ? default_stack_size : stack_size, 0,
                         static_cast<LPFIBER_START_ROUTINE>(&trampoline<Functor>),
@@ -206,7 +207,8 @@ namespace hpx { namespace threads { namespace coroutines
                     ),
                 stacksize_(stack_size == -1 ? default_stack_size : stack_size)
             {
-                if (0 == m_ctx)
+                // stackless contexts are run directly on the caller's stack
+                if (0 == m_ctx && stacksize_ != HPX_NOSTACK_STACK_SIZE)
                 {
                     throw boost::system::system_error(
                         boost::system::error_code(
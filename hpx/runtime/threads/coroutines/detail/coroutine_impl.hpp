@@ -46,6 +46,7 @@
 #include <boost/intrusive_ptr.hpp>
 
 #include <cstddef>
+#include <exception>
 #include <utility>
 
 namespace hpx { namespace threads { namespace coroutines { namespace detail
@@ -123,6 +124,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()();
 
+        // Run the bound function on the stack of the calling thread (used
+        // for stackless coroutines only).
+        HPX_EXPORT void invoke_stackless() noexcept;
+
     public:
         result_type * result()
         {
@@ -175,6 +180,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         }
 
     private:
+        context_exit_status execute(std::exception_ptr& tinfo);
+
         static HPX_EXPORT coroutine_impl* allocate(
             thread_id_repr_type id, std::ptrdiff_t stacksize);
 
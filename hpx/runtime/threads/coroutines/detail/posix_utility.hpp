@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -80,6 +81,24 @@ namespace posix
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
  && _POSIX_MAPPED_FILES > 0
 
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+    // Stacks are carved out of large MAP_NORESERVE slabs and recycled by the
+    // OS thread releasing them (see stack_pool.cpp), which significantly
+    // reduces the number of calls to mmap() and the number of memory
+    // mappings (as long as no guard pages are used).
+    HPX_EXPORT void* alloc_pooled_stack(std::size_t size);
+    HPX_EXPORT void free_pooled_stack(void* stack, std::size_t size);
+
+    // The number of stacks carved out of slabs so far and the number of
+    // allocations which were served by a recycled stack.
+    HPX_EXPORT std::int64_t get_stack_pool_size(bool reset);
+    HPX_EXPORT std::int64_t get_stack_pool_hits(bool reset);
+
+    inline void* alloc_stack(std::size_t size)
+    {
+        return alloc_pooled_stack(size);
+    }
+#else
     inline void* alloc_stack(std::size_t size)
     {
         void* real_stack = ::mmap(nullptr,
@@ -122,6 +141,7 @@ namespace posix
         return real_stack;
 #endif
     }
+#endif
 
     inline void watermark_stack(void* stack, std::size_t size)
     {
@@ -151,6 +171,12 @@ namespace posix
         return false;
     }
 
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+    inline void free_stack(void* stack, std::size_t size)
+    {
+        free_pooled_stack(stack, size);
+    }
+#else
     inline void free_stack(void* stack, std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
@@ -165,6 +191,7 @@ namespace posix
         ::munmap(stack, size);
 #endif
     }
+#endif
 
 #else  // non-mmap()
 
@@ -83,6 +83,18 @@ namespace hpx { namespace threads { namespace coroutines
     };
 
     class null_thread_id_exception : public exception_base {};
+
+    // This exception is thrown if a stackless coroutine attempts to yield.
+    // Stackless coroutines run to completion on the stack of the thread
+    // invoking them, there is no stack to preserve while suspended.
+    class stackless_yield : public exception_base
+    {
+    public:
+        char const* what() const throw()
+        {
+            return "a stackless coroutine can't be suspended";
+        }
+    };
 }}}
 
 #endif /*HPX_RUNTIME_THREADS_COROUTINES_EXCEPTION_HPP*/
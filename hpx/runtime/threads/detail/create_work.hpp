@@ -13,22 +13,56 @@
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/logging.hpp>
 
+#include <cstddef>
 #include <sstream>
 
 namespace hpx { namespace threads { namespace detail
 {
-    inline void create_work(policies::scheduler_base* scheduler,
-        thread_init_data& data,
-        thread_state_enum initial_state = threads::pending,
-        error_code& ec = throws)
+    // fill in the parts of the thread data which are derived from the
+    // creating thread
+    inline void init_work_data(policies::scheduler_base* scheduler,
+        thread_init_data& data, thread_self* self)
+    {
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+        if (nullptr == data.parent_id) {
+
+            if (self)
+            {
+                data.parent_id = threads::get_self_id().get();
+                data.parent_phase = self->get_thread_phase();
+            }
+        }
+        if (0 == data.parent_locality_id)
+            data.parent_locality_id = get_locality_id();
+#endif
+
+        if (nullptr == data.scheduler_base)
+            data.scheduler_base = scheduler;
+
+        // Pass critical priority from parent to child.
+        if (self)
+        {
+            if (data.priority == thread_priority_default &&
+                thread_priority_high_recursive ==
+                    threads::get_self_id()->get_priority())
+            {
+                data.priority = thread_priority_high_recursive;
+            }
+        }
+
+        if (data.priority == thread_priority_default)
+            data.priority = thread_priority_normal;
+    }
+
+    inline bool verify_work_state(thread_state_enum initial_state,
+        error_code& ec)
     {
-        // verify parameters
         switch (initial_state) {
         case pending:
         case pending_do_not_schedule:
         case pending_boost:
         case suspended:
-            break;
+            return true;
 
         default:
             {
@@ -38,9 +72,26 @@ namespace hpx { namespace threads { namespace detail
                 HPX_THROWS_IF(ec, bad_parameter,
                     "thread::detail::create_work",
                     strm.str());
-                return;
+                return false;
             }
         }
+    }
+
+    inline bool is_critical_priority(thread_priority priority)
+    {
+        return thread_priority_high == priority ||
+            thread_priority_high_recursive == priority ||
+            thread_priority_boost == priority;
+    }
+
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data& data,
+        thread_state_enum initial_state = threads::pending,
+        error_code& ec = throws)
+    {
+        // verify parameters
+        if (!verify_work_state(initial_state, ec))
+            return;
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
         if (!data.description)
@@ -60,52 +111,83 @@ namespace hpx { namespace threads { namespace detail
 #endif
             << ")";
 
-        thread_self* self = get_self_ptr();
+        init_work_data(scheduler, data, get_self_ptr());
 
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id) {
+        // create the new thread
+        if (is_critical_priority(data.priority))
+        {
+            // For critical priority threads, create the thread immediately.
+            scheduler->create_thread(data, nullptr, initial_state, true, ec,
+                data.num_os_thread);
+        }
+        else {
+            // Create a task description for the new thread.
+            scheduler->create_thread(data, nullptr, initial_state, false, ec,
+                data.num_os_thread);
+        }
+        if (ec) return;
 
-            if (self)
+        // potentially wake up waiting (or parked) thread
+        scheduler->do_some_work(data.num_os_thread);
+    }
+
+    // create the given number of work items at once
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data* data, std::size_t count,
+        thread_state_enum initial_state = threads::pending,
+        error_code& ec = throws)
+    {
+        // verify parameters
+        if (!verify_work_state(initial_state, ec))
+            return;
+
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!data[i].description)
             {
-                data.parent_id = threads::get_self_id().get();
-                data.parent_phase = self->get_thread_phase();
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "thread::detail::create_work", "description is nullptr");
+                return;
             }
         }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = get_locality_id();
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+        LTM_(info)
+            << "create_work: initial_state("
+            << get_thread_state_name(initial_state) << "), count("
+            << count << ")";
 
-        // Pass critical priority from parent to child.
-        if (self)
+        thread_self* self = get_self_ptr();
+
+        // Critical priority threads are created immediately, all other
+        // threads are handed to the scheduler in bulk as task descriptions.
+        std::size_t first = 0;
+        for (std::size_t i = 0; i != count; ++i)
         {
-            if (data.priority == thread_priority_default &&
-                thread_priority_high_recursive ==
-                    threads::get_self_id()->get_priority())
+            init_work_data(scheduler, data[i], self);
+            if (is_critical_priority(data[i].priority))
             {
-                data.priority = thread_priority_high_recursive;
+                scheduler->create_threads(data + first, i - first,
+                    initial_state, false, ec);
+                if (ec) return;
+
+                scheduler->create_thread(data[i], nullptr, initial_state,
+                    true, ec, data[i].num_os_thread);
+                if (ec) return;
+
+                first = i + 1;
             }
         }
 
-        if (data.priority == thread_priority_default)
-            data.priority = thread_priority_normal;
+        scheduler->create_threads(data + first, count - first, initial_state,
+            false, ec);
+        if (ec) return;
 
-        // create the new thread
-        if (thread_priority_high == data.priority ||
-            thread_priority_high_recursive == data.priority ||
-            thread_priority_boost == data.priority)
-        {
-            // For critical priority threads, create the thread immediately.
-            scheduler->create_thread(data, nullptr, initial_state, true, ec,
-                data.num_os_thread);
-        }
-        else {
-            // Create a task description for the new thread.
-            scheduler->create_thread(data, nullptr, initial_state, false, ec,
-                data.num_os_thread);
-        }
+        // potentially wake up waiting (or parked) threads, one for each of
+        // the new work items
+        for (std::size_t i = 0; i != count; ++i)
+            scheduler->do_some_work(data[i].num_os_thread);
     }
 }}}
 
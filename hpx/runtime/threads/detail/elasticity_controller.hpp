@@ -0,0 +1,101 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_DETAIL_ELASTICITY_CONTROLLER_HPP)
+#define HPX_RUNTIME_THREADS_DETAIL_ELASTICITY_CONTROLLER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/compat/condition_variable.hpp>
+#include <hpx/compat/mutex.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/runtime/threads/detail/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parameters controlling the elasticity_controller, these are read from
+    /// the [hpx.elasticity] configuration section.
+    struct elasticity_parameters
+    {
+        elasticity_parameters();
+
+        std::int64_t interval_;             ///< sampling interval [ms]
+        std::size_t min_threads_;           ///< never suspend below this
+        std::int64_t grow_queue_length_;    ///< pending work per active PU
+        std::int64_t shrink_idle_rate_;     ///< idle rate [0.01%]
+        std::size_t grow_intervals_;        ///< hysteresis for resuming PUs
+        std::size_t shrink_intervals_;      ///< hysteresis for suspending PUs
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The elasticity_controller periodically samples the queue lengths and
+    /// idle rates of all thread pools which were created with
+    /// policies::enable_elasticity. It suspends processing units of pools
+    /// which stay idle and resumes them again once work is piling up.
+    ///
+    /// The controller runs on its own OS thread so that its decisions are not
+    /// delayed by the load it is measuring. It only ever resumes processing
+    /// units which it has suspended itself, processing units suspended by
+    /// the application are left alone.
+    class HPX_EXPORT elasticity_controller
+    {
+    public:
+        HPX_NON_COPYABLE(elasticity_controller);
+
+    public:
+        elasticity_controller(std::vector<thread_pool_base*> const& pools,
+            elasticity_parameters const& params);
+        ~elasticity_controller();
+
+        void start();
+
+        // Stop sampling and resume all processing units suspended by this
+        // controller.
+        void stop();
+
+    private:
+        struct pool_data
+        {
+            explicit pool_data(thread_pool_base* pool);
+
+            thread_pool_base* pool_;
+            std::size_t grow_count_;
+            std::size_t shrink_count_;
+
+            // processing units suspended by this controller
+            std::vector<bool> suspended_;
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            // execution and scheduling loop times as of the last sample
+            std::vector<std::uint64_t> exec_times_;
+            std::vector<std::uint64_t> tfunc_times_;
+#endif
+        };
+
+        void run();
+        void sample(pool_data& data);
+
+        std::int64_t get_idle_rate(pool_data& data,
+            std::vector<std::size_t> const& active);
+
+        elasticity_parameters params_;
+        std::vector<pool_data> pools_;
+
+        compat::mutex mtx_;
+        compat::condition_variable cond_;
+        bool stopped_;
+        compat::thread thread_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -74,6 +74,8 @@ namespace hpx { namespace threads { namespace detail
 
         void create_work(thread_init_data& data,
             thread_state_enum initial_state, error_code& ec);
+        void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec);
 
         thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -168,6 +170,18 @@ namespace hpx { namespace threads { namespace detail
             return active_os_thread_count;
         }
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_thread_heap_hits(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_num_thread_heap_hits(num, reset);
+        }
+
+        std::int64_t get_num_thread_heap_misses(std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_num_thread_heap_misses(num, reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(std::size_t num, bool reset)
         {
@@ -198,12 +212,43 @@ namespace hpx { namespace threads { namespace detail
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_at_distance(
+            policies::steal_distance distance, std::size_t num, bool reset)
+        {
+            return sched_->Scheduler::get_num_stolen_at_distance(
+                distance, num, reset);
+        }
 #endif
         std::int64_t get_queue_length(std::size_t num_thread, bool reset)
         {
             return sched_->Scheduler::get_queue_length(num_thread);
         }
 
+        std::int64_t get_num_parks(std::size_t num_thread, bool reset)
+        {
+            return sched_->Scheduler::get_num_parks(num_thread, reset);
+        }
+
+        std::int64_t get_num_unparks(std::size_t num_thread, bool reset)
+        {
+            return sched_->Scheduler::get_num_unparks(num_thread, reset);
+        }
+
+        std::int64_t get_average_wakeup_latency(
+            std::size_t num_thread, bool reset)
+        {
+            return sched_->Scheduler::get_average_wakeup_latency(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_missed_deadlines(
+            std::size_t num_thread, bool reset)
+        {
+            return sched_->Scheduler::get_num_missed_deadlines(
+                num_thread, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(
             std::size_t num_thread, bool reset)
@@ -239,6 +284,13 @@ namespace hpx { namespace threads { namespace detail
         std::int64_t avg_idle_rate_all(bool reset);
         std::int64_t avg_idle_rate(std::size_t, bool);
 
+        void get_idle_rate_times(std::size_t num_thread,
+            std::uint64_t& exec_time, std::uint64_t& tfunc_time) const
+        {
+            exec_time = exec_times_[num_thread];
+            tfunc_time = tfunc_times_[num_thread];
+        }
+
 #if defined(HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES)
         std::int64_t avg_creation_idle_rate(std::size_t, bool);
         std::int64_t avg_cleanup_idle_rate(std::size_t, bool);
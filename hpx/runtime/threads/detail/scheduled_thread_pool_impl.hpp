@@ -535,6 +535,28 @@ namespace hpx { namespace threads { namespace detail
         ++tasks_scheduled_;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_threads(
+        std::vector<thread_init_data>& data, thread_state_enum initial_state,
+        error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_->Scheduler::is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_threads",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work(sched_.get(), data.data(), data.size(),
+            initial_state, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(data.size());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -1493,9 +1515,16 @@ namespace hpx { namespace threads { namespace detail
         std::atomic<hpx::state>& state =
             sched_->Scheduler::get_state(virt_core);
 
-        hpx::state oldstate = state.exchange(state_pre_sleep);
-
-        HPX_ASSERT(oldstate == state_running);
+        // The state is checked again while holding the lock, the processing
+        // unit may have been suspended or stopped concurrently.
+        hpx::state oldstate = state_running;
+        if (!state.compare_exchange_strong(oldstate, state_pre_sleep))
+        {
+            HPX_THROWS_IF(ec, invalid_status,
+                "scheduled_thread_pool<Scheduler>::suspend_processing_unit",
+                "the given virtual core is not running");
+            return;
+        }
 
         if (threads::get_self_ptr())
         {
@@ -446,6 +446,14 @@ namespace hpx { namespace threads { namespace detail
 
         // spin for some time after queues have become empty
         bool may_exit = false;
+
+        // number of times in a row this thread has been idle for
+        // max_idle_loop_count iterations
+        std::int64_t idle_rounds = 0;
+
+        // whether this thread is currently looking for work
+        bool is_idle = false;
+
         thread_data* thrd = nullptr;
         thread_data* next_thrd = nullptr;
 
@@ -473,8 +481,15 @@ namespace hpx { namespace threads { namespace detail
                 tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
                 idle_loop_count = 0;
+                idle_rounds = 0;
                 ++busy_loop_count;
 
+                if (HPX_UNLIKELY(is_idle))
+                {
+                    is_idle = false;
+                    scheduler.SchedulingPolicy::on_idle_stop(num_thread);
+                }
+
                 may_exit = false;
 
                 // Only pending HPX threads will be executed.
@@ -667,6 +682,12 @@ namespace hpx { namespace threads { namespace detail
             {
                 ++idle_loop_count;
 
+                if (!is_idle)
+                {
+                    is_idle = true;
+                    scheduler.SchedulingPolicy::on_idle_start(num_thread);
+                }
+
                 if (scheduler.SchedulingPolicy::wait_or_add_new(
                         num_thread, running, idle_loop_count))
                 {
@@ -777,8 +798,20 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count > params.max_idle_loop_count_ || may_exit)
             {
                 if (idle_loop_count > params.max_idle_loop_count_)
+                {
                     idle_loop_count = 0;
 
+                    // park this thread if it has been idle for long enough
+                    // (if enabled), embedded schedulers are never parked
+                    if (running && !may_exit &&
+                        !(scheduler.get_scheduler_mode() &
+                            policies::fast_idle_mode))
+                    {
+                        scheduler.SchedulingPolicy::park(
+                            num_thread, ++idle_rounds);
+                    }
+                }
+
                 // call back into invoking context
                 if (!params.outer_.empty())
                     params.outer_();
@@ -824,6 +857,9 @@ namespace hpx { namespace threads { namespace detail
                 }
             }
         }
+
+        if (is_idle)
+            scheduler.SchedulingPolicy::on_idle_stop(num_thread);
     }
 }}}
 
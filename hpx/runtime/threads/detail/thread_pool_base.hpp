@@ -96,6 +96,17 @@ namespace hpx { namespace threads { namespace detail
         virtual void create_work(thread_init_data& data,
             thread_state_enum initial_state, error_code& ec) = 0;
 
+        // Create work items for all of the given thread data at once
+        virtual void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec)
+        {
+            for (thread_init_data& d : data)
+            {
+                create_work(d, initial_state, ec);
+                if (ec) return;
+            }
+        }
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
             thread_priority priority, error_code& ec) = 0;
@@ -155,6 +166,16 @@ namespace hpx { namespace threads { namespace detail
         virtual std::int64_t avg_idle_rate_all(bool reset) { return 0; }
         virtual std::int64_t avg_idle_rate(std::size_t, bool) { return 0; }
 
+        // Return the accumulated (unscaled) time the given worker thread spent
+        // executing HPX threads and running its scheduling loop, this is not
+        // affected by resetting the idle-rate counters.
+        virtual void get_idle_rate_times(std::size_t num_thread,
+            std::uint64_t& exec_time, std::uint64_t& tfunc_time) const
+        {
+            exec_time = 0;
+            tfunc_time = 0;
+        }
+
 #if defined(HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES)
         virtual std::int64_t avg_creation_idle_rate(
             std::size_t thread_num, bool reset) { return 0; }
@@ -165,6 +186,16 @@ namespace hpx { namespace threads { namespace detail
 
         virtual std::int64_t get_queue_length(std::size_t, bool) { return 0; }
 
+        virtual std::int64_t get_num_parks(
+            std::size_t thread_num, bool reset) { return 0; }
+        virtual std::int64_t get_num_unparks(
+            std::size_t thread_num, bool reset) { return 0; }
+        virtual std::int64_t get_average_wakeup_latency(
+            std::size_t thread_num, bool reset) { return 0; }
+
+        virtual std::int64_t get_num_missed_deadlines(
+            std::size_t thread_num, bool reset) { return 0; }
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t thread_num, bool reset) { return 0; }
@@ -172,6 +203,13 @@ namespace hpx { namespace threads { namespace detail
             std::size_t thread_num, bool reset) { return 0; }
 #endif
 
+#if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
+        virtual std::int64_t get_num_thread_heap_hits(
+            std::size_t thread_num, bool reset) { return 0; }
+        virtual std::int64_t get_num_thread_heap_misses(
+            std::size_t thread_num, bool reset) { return 0; }
+#endif
+
 #if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
         virtual std::int64_t get_num_pending_misses(
             std::size_t thread_num, bool reset) { return 0; }
@@ -186,6 +224,35 @@ namespace hpx { namespace threads { namespace detail
             std::size_t thread_num, bool reset) { return 0; }
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t thread_num, bool reset) { return 0; }
+
+        virtual std::int64_t get_num_stolen_at_distance(
+            policies::steal_distance distance, std::size_t thread_num,
+            bool reset) { return 0; }
+
+        std::int64_t get_num_stolen_from_l2(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_at_distance(
+                policies::steal_distance_l2, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_from_l3(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_at_distance(
+                policies::steal_distance_l3, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_from_numa_node(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_at_distance(
+                policies::steal_distance_numa_node, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_from_remote(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_at_distance(
+                policies::steal_distance_remote, thread_num, reset);
+        }
 #endif
 
         virtual std::int64_t get_thread_count(thread_state_enum state,
@@ -248,6 +315,11 @@ namespace hpx { namespace threads { namespace detail
 
         virtual void set_scheduler_mode(threads::policies::scheduler_mode) {}
 
+        policies::scheduler_mode get_scheduler_mode() const
+        {
+            return mode_;
+        }
+
         //
         virtual void abort_all_suspended_threads() {}
         virtual bool cleanup_terminated(bool delete_all) { return false; }
@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_DEADLINE_QUEUE_BACKEND_OCT_17_2017_1140AM)
+#define HPX_THREADMANAGER_DEADLINE_QUEUE_BACKEND_OCT_17_2017_1140AM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace policies
+{
+    struct deadline_fifo;
+
+    namespace detail
+    {
+        // threads without a deadline are ordered after all threads with a
+        // deadline
+        inline std::uint64_t get_queue_deadline(thread_data* thrd)
+        {
+            std::uint64_t deadline = thrd->get_deadline();
+            return deadline == 0 ? std::uint64_t(-1) : deadline;
+        }
+
+        inline std::uint64_t get_queue_deadline(
+            util::tuple<thread_data*, std::uint64_t>* desc)
+        {
+            return get_queue_deadline(util::get<0>(*desc));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Binary heap of work items ordered by their deadline (earliest deadline
+    // first), work items with the same deadline are returned in FIFO order.
+    // The heap is protected by a spinlock, the earliest deadline is
+    // additionally exposed through an atomic to allow for thieves to select
+    // their victim without acquiring the lock.
+    template <typename T>
+    struct deadline_queue_backend
+    {
+        typedef T value_type;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::uint64_t size_type;
+
+    private:
+        typedef hpx::util::spinlock mutex_type;
+
+        struct entry
+        {
+            std::uint64_t deadline_;
+            std::uint64_t sequence_;
+            T value_;
+        };
+
+        // std::push_heap and friends create a max-heap
+        struct entry_less
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const
+            {
+                if (lhs.deadline_ != rhs.deadline_)
+                    return lhs.deadline_ > rhs.deadline_;
+                return lhs.sequence_ > rhs.sequence_;
+            }
+        };
+
+    public:
+        deadline_queue_backend(
+            size_type initial_size = 0
+          , size_type num_thread = size_type(-1)
+            )
+          : sequence_(0)
+          , earliest_deadline_(std::uint64_t(-1))
+        {
+            heap_.reserve(std::size_t(initial_size));
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)
+        {
+            std::uint64_t deadline = detail::get_queue_deadline(val);
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            heap_.push_back(entry{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), entry_less());
+
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool pop(reference val, bool /*steal*/ = true)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end(), entry_less());
+            val = heap_.back().value_;
+            heap_.pop_back();
+
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool empty()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+        // Return the deadline of the most urgent work item, this does not
+        // acquire the lock and is a snapshot only
+        std::uint64_t get_earliest_deadline() const
+        {
+            return earliest_deadline_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void update_earliest_deadline()
+        {
+            earliest_deadline_.store(
+                heap_.empty() ? std::uint64_t(-1) : heap_.front().deadline_,
+                std::memory_order_relaxed);
+        }
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t sequence_;
+        std::atomic<std::uint64_t> earliest_deadline_;
+    };
+
+    struct deadline_fifo
+    {
+        template <typename T>
+        struct apply
+        {
+            typedef deadline_queue_backend<T> type;
+        };
+    };
+}}}
+
+#endif
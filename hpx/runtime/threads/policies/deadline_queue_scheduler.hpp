@@ -0,0 +1,248 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_OCT_17_2017_1152AM)
+#define HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_OCT_17_2017_1152AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/compat/mutex.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/threads/policies/deadline_queue_backend.hpp>
+#include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
+#include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler maintains exactly one queue of work
+    /// items (threads) per OS thread, where this OS thread pulls its next work
+    /// from. Additionally it maintains separate queues: several for high
+    /// priority threads and one for low priority threads (see
+    /// local_priority_queue_scheduler).
+    ///
+    /// All queues of pending threads are ordered by the deadline of the
+    /// threads (earliest deadline first, see thread_init_data::deadline),
+    /// threads without a deadline are executed only after all threads with a
+    /// deadline. Idle OS threads steal from the victim holding the most
+    /// urgent pending thread. The number of threads which were completed
+    /// after their deadline had expired is exposed as a performance counter.
+    template <typename Mutex = compat::mutex,
+        typename PendingQueuing = deadline_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing = lockfree_lifo>
+    class HPX_EXPORT deadline_queue_scheduler
+        : public local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+          >
+    {
+    public:
+        typedef local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        > base_type;
+
+        typedef typename base_type::thread_queue_type thread_queue_type;
+        typedef typename base_type::init_parameter_type init_parameter_type;
+
+        deadline_queue_scheduler(init_parameter_type const& init,
+                bool deferred_initialization = true)
+          : base_type(init, deferred_initialization),
+            missed_deadlines_(init.num_queues_)
+        {}
+
+        static std::string get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        std::int64_t get_num_missed_deadlines(std::size_t num_thread,
+            bool reset)
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t missed_deadlines = 0;
+                for (missed_deadlines_data& d : missed_deadlines_)
+                {
+                    missed_deadlines +=
+                        util::get_and_reset_value(d.count_, reset);
+                }
+                return missed_deadlines;
+            }
+
+            HPX_ASSERT(num_thread < missed_deadlines_.size());
+            return util::get_and_reset_value(
+                missed_deadlines_[num_thread].count_, reset);
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, threads::thread_data*& thrd)
+        {
+            std::size_t queues_size = this->queues_.size();
+            std::size_t high_priority_queues =
+                this->high_priority_queues_.size();
+
+            HPX_ASSERT(num_thread < queues_size);
+            thread_queue_type* this_high_priority_queue = nullptr;
+            thread_queue_type* this_queue = this->queues_[num_thread];
+
+            if (num_thread < high_priority_queues)
+            {
+                this_high_priority_queue =
+                    this->high_priority_queues_[num_thread];
+                bool result =
+                    this_high_priority_queue->get_next_thread(thrd);
+
+                this_high_priority_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_high_priority_queue->increment_num_pending_misses();
+            }
+
+            {
+                bool result = this_queue->get_next_thread(thrd);
+
+                this_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_queue->increment_num_pending_misses();
+
+                bool have_staged = this_queue->
+                    get_staged_queue_length(std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                    return false;
+            }
+
+            std::vector<std::size_t> const& victims =
+                this->victim_threads_[num_thread];
+
+            if (num_thread < high_priority_queues &&
+                steal_earliest(this->high_priority_queues_, victims,
+                    this_high_priority_queue, thrd, running))
+            {
+                return true;
+            }
+
+            if (steal_earliest(this->queues_, victims, this_queue, thrd,
+                    running))
+            {
+                return true;
+            }
+
+            return this->low_priority_queue_.get_next_thread(thrd);
+        }
+
+        /// Destroy the passed thread as it has been terminated
+        bool destroy_thread(threads::thread_data* thrd,
+            std::int64_t& busy_count)
+        {
+            std::uint64_t deadline = thrd->get_deadline();
+            if (deadline != 0 &&
+                util::high_resolution_clock::now() > deadline)
+            {
+                ++missed_deadlines_[get_local_thread_num()].count_;
+            }
+
+            return base_type::destroy_thread(thrd, busy_count);
+        }
+
+    protected:
+        // Steal the most urgent thread from the victim holding the pending
+        // thread with the earliest deadline
+        bool steal_earliest(std::vector<thread_queue_type*> const& queues,
+            std::vector<std::size_t> const& victims,
+            thread_queue_type* this_queue, threads::thread_data*& thrd,
+            bool running)
+        {
+            std::size_t num_queues = queues.size();
+
+            std::size_t best = std::size_t(-1);
+            std::uint64_t best_deadline = std::uint64_t(-1);
+            for (std::size_t idx : victims)
+            {
+                if (idx >= num_queues ||
+                    queues[idx]->get_pending_queue_length() == 0)
+                {
+                    continue;
+                }
+
+                // the first victim having work is used if none of the
+                // pending threads has a deadline
+                std::uint64_t deadline = queues[idx]->get_earliest_deadline();
+                if (best == std::size_t(-1) || deadline < best_deadline)
+                {
+                    best = idx;
+                    best_deadline = deadline;
+                }
+            }
+
+            if (best == std::size_t(-1))
+                return false;
+
+            // this may fail if the victim refuses to give away work (its
+            // queue is too short) or if some other thread was faster, the
+            // other victims are less urgent in any case
+            thread_queue_type* q = queues[best];
+            if (!q->get_next_thread(thrd, running, true))
+                return false;
+
+            q->increment_num_stolen_from_pending();
+            this_queue->increment_num_stolen_to_pending();
+            return true;
+        }
+
+        // The terminated threads are destroyed by the OS thread which has
+        // executed them.
+        std::size_t get_local_thread_num()
+        {
+            std::size_t num_thread =
+                this->global_to_local_thread_index(get_worker_thread_num());
+            return num_thread < missed_deadlines_.size() ? num_thread : 0;
+        }
+
+    private:
+        // number of threads completed after their deadline by each of the OS
+        // threads
+        struct missed_deadlines_data
+        {
+            missed_deadlines_data()
+              : count_(0)
+            {}
+
+            std::atomic<std::int64_t> count_;
+
+            // keep the counters of different OS threads on separate cache
+            // lines
+            char padding_[BOOST_LOCKFREE_CACHELINE_BYTES];
+        };
+
+        std::vector<missed_deadlines_data> missed_deadlines_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -143,6 +143,12 @@ namespace hpx { namespace threads
           , error_code& ec = throws
             ) const;
 
+        mask_cref_type get_cache_affinity_mask(
+            std::size_t num_thread
+          , std::size_t cache_level
+          , error_code& ec = throws
+            ) const;
+
         mask_cref_type get_thread_affinity_mask(
             std::size_t num_thread
           , error_code& ec = throws
@@ -168,6 +174,10 @@ namespace hpx { namespace threads
         mask_type init_core_affinity_mask_from_core(
             std::size_t num_core, mask_cref_type default_mask = mask_type()
             ) const;
+        mask_type init_cache_affinity_mask(
+            std::size_t num_thread
+          , std::size_t cache_level
+            ) const;
         mask_type init_thread_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(
             std::size_t num_core
@@ -333,6 +343,11 @@ namespace hpx { namespace threads
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
+
+        // cache_affinity_masks_[l-1][n] is the bitmask of the PUs sharing the
+        // level l cache with PU #n
+        enum { max_cache_level = 3 };
+        std::vector<mask_type> cache_affinity_masks_[max_cache_level];
     };
 
     ///////////////////////////////////////////////////////////////////////////
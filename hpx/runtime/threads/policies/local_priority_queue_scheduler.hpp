@@ -20,6 +20,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -202,6 +203,73 @@ namespace hpx { namespace threads { namespace policies
         }
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_thread_heap_hits(std::size_t num_thread, bool reset)
+        {
+            std::int64_t num_hits = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != high_priority_queues_.size(); ++i)
+                    num_hits += high_priority_queues_[i]->
+                        get_num_thread_heap_hits(reset);
+
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    num_hits += queues_[i]->get_num_thread_heap_hits(reset);
+
+                num_hits += low_priority_queue_.get_num_thread_heap_hits(reset);
+
+                return num_hits;
+            }
+
+            num_hits += queues_[num_thread]->get_num_thread_heap_hits(reset);
+
+            if (num_thread < high_priority_queues_.size())
+            {
+                num_hits += high_priority_queues_[num_thread]->
+                    get_num_thread_heap_hits(reset);
+            }
+            if (num_thread == 0)
+            {
+                num_hits += low_priority_queue_.get_num_thread_heap_hits(reset);
+            }
+            return num_hits;
+        }
+
+        std::int64_t get_num_thread_heap_misses(std::size_t num_thread,
+            bool reset)
+        {
+            std::int64_t num_misses = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != high_priority_queues_.size(); ++i)
+                    num_misses += high_priority_queues_[i]->
+                        get_num_thread_heap_misses(reset);
+
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    num_misses += queues_[i]->get_num_thread_heap_misses(reset);
+
+                num_misses +=
+                    low_priority_queue_.get_num_thread_heap_misses(reset);
+
+                return num_misses;
+            }
+
+            num_misses += queues_[num_thread]->get_num_thread_heap_misses(reset);
+
+            if (num_thread < high_priority_queues_.size())
+            {
+                num_misses += high_priority_queues_[num_thread]->
+                    get_num_thread_heap_misses(reset);
+            }
+            if (num_thread == 0)
+            {
+                num_misses +=
+                    low_priority_queue_.get_num_thread_heap_misses(reset);
+            }
+            return num_misses;
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(std::size_t num_thread, bool reset)
         {
@@ -527,6 +595,63 @@ namespace hpx { namespace threads { namespace policies
                 run_now, ec);
         }
 
+        // create the given number of threads at once, consecutive threads of
+        // normal priority without a requested OS thread are distributed in
+        // evenly sized chunks round robin over all queues
+        void create_threads(thread_init_data* data, std::size_t count,
+            thread_state_enum initial_state, bool run_now, error_code& ec)
+        {
+            // the queues have to be selected one by one if the scheduler
+            // might disable some of its OS threads
+            if (mode_ & threads::policies::enable_elasticity)
+            {
+                scheduler_base::create_threads(data, count, initial_state,
+                    run_now, ec);
+                return;
+            }
+
+            std::size_t queue_size = queues_.size();
+
+            std::size_t first = 0;
+            while (first != count)
+            {
+                if (!is_bulk_creatable(data[first]))
+                {
+                    create_thread(data[first], nullptr, initial_state,
+                        run_now, ec, data[first].num_os_thread);
+                    if (ec) return;
+
+                    ++first;
+                    continue;
+                }
+
+                std::size_t last = first + 1;
+                while (last != count && is_bulk_creatable(data[last]))
+                    ++last;
+
+                std::size_t size = last - first;
+                std::size_t num_chunks = (std::min)(size, queue_size);
+                std::size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+                std::size_t num_thread =
+                    curr_queue_.fetch_add(num_chunks) % queue_size;
+
+                while (first != last)
+                {
+                    std::size_t curr_chunk_size =
+                        (std::min)(chunk_size, last - first);
+
+                    HPX_ASSERT(num_thread < queue_size);
+                    queues_[num_thread]->create_threads(data + first,
+                        curr_chunk_size, initial_state, run_now, ec);
+                    if (ec) return;
+
+                    first += curr_chunk_size;
+                    num_thread = (num_thread + 1) % queue_size;
+                }
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         virtual bool get_next_thread(std::size_t num_thread, bool running,
@@ -1179,6 +1304,14 @@ namespace hpx { namespace threads { namespace policies
         }
 
     protected:
+        // threads of special priority and threads which have to run on a
+        // particular OS thread are created one by one
+        static bool is_bulk_creatable(thread_init_data const& data)
+        {
+            return data.priority == thread_priority_normal &&
+                data.num_os_thread == std::size_t(-1);
+        }
+
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
         std::vector<thread_queue_type*> high_priority_queues_;
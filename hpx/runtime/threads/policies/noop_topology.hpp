@@ -106,6 +106,18 @@ public:
         return empty_mask;
     }
 
+    mask_cref_type get_cache_affinity_mask(
+        std::size_t thread_num
+      , std::size_t cache_level
+      , error_code& ec = throws
+        ) const
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return empty_mask;
+    }
+
     mask_cref_type get_thread_affinity_mask(
         std::size_t thread_num
       , error_code& ec = throws
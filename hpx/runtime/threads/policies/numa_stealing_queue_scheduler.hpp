@@ -0,0 +1,326 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_SCHEDULING_NUMA_STEALING_QUEUE_OCT_17_2017_0512PM)
+#define HPX_THREADMANAGER_SCHEDULING_NUMA_STEALING_QUEUE_OCT_17_2017_0512PM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NUMA_STEALING_SCHEDULER)
+#include <hpx/compat/mutex.hpp>
+#include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
+#include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
+#include <hpx/runtime/threads/policies/scheduler_mode.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/runtime/threads_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The numa_stealing_queue_scheduler maintains exactly one queue of work
+    /// items (threads) per OS thread, where this OS thread pulls its next work
+    /// from. Additionally it maintains separate queues: several for high
+    /// priority threads and one for low priority threads (see
+    /// local_priority_queue_scheduler).
+    ///
+    /// Idle OS threads steal work from other queues in the order of their
+    /// topological distance: first from threads sharing the same L2 cache,
+    /// then from threads sharing the same L3 cache, then from threads in the
+    /// same NUMA domain, and only then from remote NUMA domains. Each
+    /// successful steal takes up to half of the pending work items of the
+    /// victim, which reduces the number of steal attempts needed to balance
+    /// the load.
+    template <typename Mutex = compat::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing = lockfree_lifo>
+    class HPX_EXPORT numa_stealing_queue_scheduler
+        : public local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+          >
+    {
+    public:
+        typedef local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        > base_type;
+
+        typedef typename base_type::thread_queue_type thread_queue_type;
+        typedef typename base_type::init_parameter_type init_parameter_type;
+
+        numa_stealing_queue_scheduler(init_parameter_type const& init,
+                bool deferred_initialization = true)
+          : base_type(init, deferred_initialization),
+            victim_distances_(init.num_queues_)
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+          , steal_counts_(init.num_queues_)
+#endif
+        {}
+
+        static std::string get_scheduler_name()
+        {
+            return "numa_stealing_queue_scheduler";
+        }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        std::int64_t get_num_stolen_at_distance(steal_distance distance,
+            std::size_t num_thread, bool reset)
+        {
+            HPX_ASSERT(distance < steal_distance_count);
+
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t num_stolen_threads = 0;
+                for (steal_counts& counts : steal_counts_)
+                {
+                    num_stolen_threads += util::get_and_reset_value(
+                        counts.stolen_[distance], reset);
+                }
+                return num_stolen_threads;
+            }
+
+            HPX_ASSERT(num_thread < steal_counts_.size());
+            return util::get_and_reset_value(
+                steal_counts_[num_thread].stolen_[distance], reset);
+        }
+#endif
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, threads::thread_data*& thrd)
+        {
+            std::size_t queues_size = this->queues_.size();
+            std::size_t high_priority_queues =
+                this->high_priority_queues_.size();
+
+            HPX_ASSERT(num_thread < queues_size);
+            thread_queue_type* this_high_priority_queue = nullptr;
+            thread_queue_type* this_queue = this->queues_[num_thread];
+
+            if (num_thread < high_priority_queues)
+            {
+                this_high_priority_queue =
+                    this->high_priority_queues_[num_thread];
+                bool result =
+                    this_high_priority_queue->get_next_thread(thrd);
+
+                this_high_priority_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_high_priority_queue->increment_num_pending_misses();
+            }
+
+            {
+                bool result = this_queue->get_next_thread(thrd);
+
+                this_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_queue->increment_num_pending_misses();
+
+                bool have_staged = this_queue->
+                    get_staged_queue_length(std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                    return false;
+            }
+
+            // the victims are ordered by increasing topological distance
+            std::vector<std::size_t> const& victims =
+                this->victim_threads_[num_thread];
+            std::vector<steal_distance> const& distances =
+                victim_distances_[num_thread];
+
+            HPX_ASSERT(victims.size() == distances.size());
+            for (std::size_t i = 0; i != victims.size(); ++i)
+            {
+                std::size_t idx = victims[i];
+                HPX_ASSERT(idx != num_thread);
+
+                if (idx < high_priority_queues &&
+                    num_thread < high_priority_queues)
+                {
+                    thread_queue_type* q = this->high_priority_queues_[idx];
+                    std::size_t stolen = this_high_priority_queue->
+                        steal_half_from(q, thrd, running);
+                    if (0 != stolen)
+                    {
+                        q->increment_num_stolen_from_pending(stolen);
+                        this_high_priority_queue->
+                            increment_num_stolen_to_pending(stolen);
+                        increment_num_stolen(num_thread, distances[i], stolen);
+                        return true;
+                    }
+                }
+
+                thread_queue_type* q = this->queues_[idx];
+                std::size_t stolen = this_queue->steal_half_from(
+                    q, thrd, running);
+                if (0 != stolen)
+                {
+                    q->increment_num_stolen_from_pending(stolen);
+                    this_queue->increment_num_stolen_to_pending(stolen);
+                    increment_num_stolen(num_thread, distances[i], stolen);
+                    return true;
+                }
+            }
+
+            return this->low_priority_queue_.get_next_thread(thrd);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread)
+        {
+            // this creates the queues and a first (flat) list of victims
+            base_type::on_start_thread(num_thread);
+
+            std::size_t num_threads = this->queues_.size();
+            auto const& topo = this->rp_.get_topology();
+            auto const& affinity_data = this->rp_.get_affinity_data();
+
+            std::vector<mask_type> l2_masks(num_threads);
+            std::vector<mask_type> l3_masks(num_threads);
+            std::vector<mask_type> numa_masks(num_threads);
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                std::size_t num_pu = affinity_data.get_pu_num(i);
+                l2_masks[i] = topo.get_cache_affinity_mask(num_pu, 2);
+                l3_masks[i] = topo.get_cache_affinity_mask(num_pu, 3);
+                numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+            }
+
+            mask_cref_type l2_mask = l2_masks[num_thread];
+            mask_cref_type l3_mask = l3_masks[num_thread];
+            mask_cref_type numa_mask = numa_masks[num_thread];
+
+            // only the thread on the boundary of the NUMA domain is allowed
+            // to steal remotely if we are NUMA sensitive
+            bool steal_remote = true;
+            if (this->numa_sensitive_ == 2)
+            {
+                steal_remote = false;
+            }
+            else if (this->numa_sensitive_ == 1)
+            {
+                std::size_t num_pu = affinity_data.get_pu_num(num_thread);
+                mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
+
+                std::size_t first = find_first(numa_mask);
+                steal_remote = first == std::size_t(-1) || test(pu_mask, first);
+            }
+
+            // iterate over the neighbors in a radial fashion (left and right
+            // alternating, increasing distance each iteration), the stable
+            // sort below retains this order for victims at the same
+            // topological distance
+            std::vector<std::pair<steal_distance, std::size_t> > victims;
+            victims.reserve(num_threads);
+
+            auto add_victim = [&](std::size_t other)
+            {
+                steal_distance distance = steal_distance_remote;
+                if (any(l2_mask & l2_masks[other]))
+                    distance = steal_distance_l2;
+                else if (any(l3_mask & l3_masks[other]))
+                    distance = steal_distance_l3;
+                else if (any(numa_mask & numa_masks[other]))
+                    distance = steal_distance_numa_node;
+                else if (!steal_remote)
+                    return;
+
+                victims.push_back(std::make_pair(distance, other));
+            };
+
+            for (std::size_t i = 1; 2 * i <= num_threads; ++i)
+            {
+                add_victim((num_thread + num_threads - i) % num_threads);
+                if (2 * i != num_threads)
+                    add_victim((num_thread + i) % num_threads);
+            }
+
+            std::stable_sort(victims.begin(), victims.end(),
+                [](std::pair<steal_distance, std::size_t> const& lhs,
+                   std::pair<steal_distance, std::size_t> const& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+
+            std::vector<std::size_t>& victim_threads =
+                this->victim_threads_[num_thread];
+            std::vector<steal_distance>& victim_distances =
+                victim_distances_[num_thread];
+
+            victim_threads.clear();
+            victim_distances.clear();
+            victim_threads.reserve(victims.size());
+            victim_distances.reserve(victims.size());
+
+            for (auto const& v : victims)
+            {
+                victim_threads.push_back(v.second);
+                victim_distances.push_back(v.first);
+            }
+        }
+
+    protected:
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        void increment_num_stolen(std::size_t num_thread,
+            steal_distance distance, std::size_t num)
+        {
+            steal_counts_[num_thread].stolen_[distance] += num;
+        }
+#else
+        void increment_num_stolen(std::size_t, steal_distance, std::size_t) {}
+#endif
+
+    private:
+        // victim_distances_[n][i] is the topological distance between the
+        // OS thread n and its victim victim_threads_[n][i]
+        std::vector<std::vector<steal_distance> > victim_distances_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // number of threads stolen by each of the OS threads, separated by
+        // the distance to the victims
+        struct steal_counts
+        {
+            steal_counts()
+            {
+                for (std::atomic<std::int64_t>& s : stolen_)
+                    s.store(0, std::memory_order_relaxed);
+            }
+
+            std::atomic<std::int64_t> stolen_[steal_distance_count];
+
+            // keep the counters of different OS threads on separate cache
+            // lines
+            char padding_[BOOST_LOCKFREE_CACHELINE_BYTES];
+        };
+
+        std::vector<steal_counts> steal_counts_;
+#endif
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
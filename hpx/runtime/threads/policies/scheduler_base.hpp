@@ -10,6 +10,7 @@
 #include <hpx/compat/condition_variable.hpp>
 #include <hpx/compat/mutex.hpp>
 #include <hpx/runtime/agas/interface.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
 #include <hpx/runtime/threads/detail/thread_pool_base.hpp>
@@ -17,11 +18,16 @@
 #include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util_fwd.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/runtime/threads/coroutines/detail/tss.hpp>
 #endif
 
+#include <boost/lockfree/detail/prefix.hpp>
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -60,6 +66,24 @@ namespace hpx { namespace threads { namespace policies
     }
 #endif
 
+    namespace detail
+    {
+        // Idle worker threads are parked (blocked) instead of spinning if
+        // hpx.idle_mode=park
+        inline bool get_idle_parking()
+        {
+            return hpx::get_config_entry("hpx.idle_mode", "spin") == "park";
+        }
+
+        // Maximum time (in microseconds) a worker thread stays parked before
+        // it looks for work (and drives background work) again
+        inline std::int64_t get_max_park_duration()
+        {
+            return hpx::util::safe_lexical_cast<std::int64_t>(
+                hpx::get_config_entry("hpx.max_park_duration", "1000"));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// The scheduler_base defines the interface to be implemented by all
     /// scheduler policies
@@ -83,6 +107,11 @@ namespace hpx { namespace threads { namespace policies
           , description_(description)
           , parent_pool_(nullptr)
           , background_thread_count_(0)
+          , parking_enabled_(detail::get_idle_parking())
+          , max_park_duration_(detail::get_max_park_duration())
+          , parking_data_(num_threads)
+          , num_parked_(0)
+          , num_idle_(0)
         {
             for (std::size_t i = 0; i != num_threads; ++i)
                 states_[i].store(state_initialized);
@@ -152,6 +181,168 @@ namespace hpx { namespace threads { namespace policies
             else
                 cond_.notify_one();
 #endif
+            // this has to be sequentially consistent with respect to the
+            // enqueue operation and the check in park()
+            if (parking_enabled_ && num_parked_.load() != 0)
+                unpark_for_work(num_thread);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// This function gets called by the scheduling loop whenever the
+        /// given OS thread did not find any work for max_idle_loop_count
+        /// iterations, idle_rounds is the number of times this happened in a
+        /// row. If parking is enabled and the OS thread has been idle for long
+        /// enough it is blocked until new work is added for it (or for one of
+        /// the threads it could steal from) or until max_park_duration has
+        /// expired. Returns whether the OS thread was parked.
+        bool park(std::size_t num_thread, std::int64_t idle_rounds)
+        {
+            if (!parking_enabled_)
+                return false;
+
+            HPX_ASSERT(num_thread < parking_data_.size());
+            parking_data& pd = parking_data_[num_thread];
+
+            if (idle_rounds < pd.spin_rounds_)
+                return false;
+
+            // announce that this thread is about to park, then look for work
+            // once more to avoid missing a concurrent do_some_work
+            pd.parked_.store(true);
+            ++num_parked_;
+
+            if (get_queue_length() != 0 ||
+                states_[num_thread].load() >= state_pre_sleep)
+            {
+                if (pd.parked_.exchange(false))
+                    --num_parked_;
+                return false;
+            }
+
+            ++pd.parks_;
+
+            bool notified = false;
+            {
+                std::unique_lock<compat::mutex> l(pd.mtx_);
+                notified = pd.cond_.wait_for(l,
+                    std::chrono::microseconds(max_park_duration_),
+                    [&pd]() { return !pd.parked_.load(); });
+            }
+
+            // a concurrent unpark may have raced with the timeout
+            if (!notified && !pd.parked_.exchange(false))
+                notified = true;
+
+            if (notified)
+            {
+                // work arrived while being parked, spin longer before
+                // parking the next time
+                std::uint64_t latency = util::high_resolution_clock::now() -
+                    pd.unpark_time_.load();
+                pd.wakeup_latency_ += static_cast<std::int64_t>(latency);
+                ++pd.wakeups_;
+
+                pd.spin_rounds_ = (std::min)(
+                    2 * pd.spin_rounds_, std::int64_t(max_spin_rounds));
+            }
+            else
+            {
+                // no work arrived for a long time, park earlier next time
+                --num_parked_;
+                pd.spin_rounds_ = (std::max)(
+                    pd.spin_rounds_ / 2, std::int64_t(1));
+            }
+            return true;
+        }
+
+        /// Wake up the given OS thread if it is parked, returns whether the
+        /// thread was parked.
+        bool unpark(std::size_t num_thread)
+        {
+            HPX_ASSERT(num_thread < parking_data_.size());
+            parking_data& pd = parking_data_[num_thread];
+
+            if (!pd.parked_.load(std::memory_order_relaxed))
+                return false;
+
+            {
+                // the lock makes sure the parked thread is either not waiting
+                // yet (and will see the flag) or will be notified
+                std::lock_guard<compat::mutex> l(pd.mtx_);
+                pd.unpark_time_.store(util::high_resolution_clock::now());
+                if (!pd.parked_.exchange(false))
+                    return false;
+            }
+
+            --num_parked_;
+            ++pd.unparks_;
+            pd.cond_.notify_one();
+            return true;
+        }
+
+        void unpark_all()
+        {
+            for (std::size_t i = 0; i != parking_data_.size(); ++i)
+                unpark(i);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// These functions get called by the scheduling loop whenever the
+        /// given OS thread starts or stops looking for work.
+        void on_idle_start(std::size_t /*num_thread*/)
+        {
+            ++num_idle_;
+        }
+
+        void on_idle_stop(std::size_t /*num_thread*/)
+        {
+            HPX_ASSERT(num_idle_.load(std::memory_order_relaxed) != 0);
+            --num_idle_;
+        }
+
+        /// Return whether any of the OS threads is currently looking for work
+        /// (or is parked). This is used as a hint only, e.g. to decide whether
+        /// a forked task has to be exposed to other OS threads.
+        bool has_idle_threads() const
+        {
+            return num_idle_.load(std::memory_order_relaxed) != 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_num_parks(std::size_t num_thread, bool reset)
+        {
+            return accumulate_parking_data(num_thread,
+                [reset](parking_data& pd)
+                {
+                    return util::get_and_reset_value(pd.parks_, reset);
+                });
+        }
+
+        std::int64_t get_num_unparks(std::size_t num_thread, bool reset)
+        {
+            return accumulate_parking_data(num_thread,
+                [reset](parking_data& pd)
+                {
+                    return util::get_and_reset_value(pd.unparks_, reset);
+                });
+        }
+
+        // average time (in nanoseconds) between a parked OS thread being
+        // woken up and it resuming to look for work
+        std::int64_t get_average_wakeup_latency(
+            std::size_t num_thread, bool reset)
+        {
+            std::int64_t wakeups = accumulate_parking_data(num_thread,
+                [reset](parking_data& pd)
+                {
+                    return util::get_and_reset_value(pd.wakeups_, reset);
+                });
+            std::int64_t latency = accumulate_parking_data(num_thread,
+                [reset](parking_data& pd)
+                {
+                    return util::get_and_reset_value(pd.wakeup_latency_, reset);
+                });
+            return wakeups == 0 ? 0 : latency / wakeups;
         }
 
         void suspend(std::size_t num_thread)
@@ -197,6 +388,10 @@ namespace hpx { namespace threads { namespace policies
             typedef std::atomic<hpx::state> state_type;
             for (state_type& state : states_)
                 state.store(s);
+
+            // parked threads have to react to state changes right away
+            if (parking_enabled_)
+                unpark_all();
         }
 
         // return whether all states are at least at the given one
@@ -315,6 +510,13 @@ namespace hpx { namespace threads { namespace policies
         virtual std::uint64_t get_cleanup_time(bool reset) = 0;
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        virtual std::int64_t get_num_thread_heap_hits(std::size_t num_thread,
+            bool reset) { return 0; }
+        virtual std::int64_t get_num_thread_heap_misses(std::size_t num_thread,
+            bool reset) { return 0; }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         virtual std::int64_t get_num_pending_misses(std::size_t num_thread,
             bool reset) = 0;
@@ -329,8 +531,24 @@ namespace hpx { namespace threads { namespace policies
             bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(std::size_t num_thread,
             bool reset) = 0;
+
+        // number of threads stolen by the given worker thread from workers
+        // at the given topological distance (see steal_distance)
+        virtual std::int64_t get_num_stolen_at_distance(
+            steal_distance distance, std::size_t num_thread, bool reset)
+        {
+            return 0;
+        }
 #endif
 
+        // number of threads which were completed after their deadline had
+        // expired (see deadline_queue_scheduler)
+        virtual std::int64_t get_num_missed_deadlines(
+            std::size_t num_thread, bool reset)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
@@ -369,6 +587,20 @@ namespace hpx { namespace threads { namespace policies
             thread_state_enum initial_state, bool run_now, error_code& ec,
             std::size_t num_thread) = 0;
 
+        // Create the given number of threads at once. Schedulers may
+        // override this to distribute the new threads over their queues with
+        // less overhead than creating them one by one.
+        virtual void create_threads(thread_init_data* data, std::size_t count,
+            thread_state_enum initial_state, bool run_now, error_code& ec)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                create_thread(data[i], nullptr, initial_state, run_now, ec,
+                    data[i].num_os_thread);
+                if (ec) return;
+            }
+        }
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             std::int64_t& idle_loop_count, threads::thread_data*& thrd) = 0;
 
@@ -427,6 +659,81 @@ namespace hpx { namespace threads { namespace policies
 
         std::atomic<std::int64_t> background_thread_count_;
 
+        // support for parking idle OS threads
+        enum { max_spin_rounds = 64 };
+
+        struct parking_data
+        {
+            parking_data()
+              : parked_(false), spin_rounds_(1), unpark_time_(0),
+                parks_(0), unparks_(0), wakeups_(0), wakeup_latency_(0)
+            {}
+
+            compat::mutex mtx_;
+            compat::condition_variable cond_;
+            std::atomic<bool> parked_;
+
+            // number of idle rounds before parking, adapted by the owning
+            // OS thread depending on how soon it was woken up again
+            std::int64_t spin_rounds_;
+
+            std::atomic<std::uint64_t> unpark_time_;
+
+            std::atomic<std::int64_t> parks_;
+            std::atomic<std::int64_t> unparks_;
+            std::atomic<std::int64_t> wakeups_;
+            std::atomic<std::int64_t> wakeup_latency_;
+
+            // keep the data of different OS threads on separate cache lines
+            char padding_[BOOST_LOCKFREE_CACHELINE_BYTES];
+        };
+
+        template <typename F>
+        std::int64_t accumulate_parking_data(std::size_t num_thread, F && f)
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t result = 0;
+                for (parking_data& pd : parking_data_)
+                    result += f(pd);
+                return result;
+            }
+
+            HPX_ASSERT(num_thread < parking_data_.size());
+            return f(parking_data_[num_thread]);
+        }
+
+        // wake up the OS thread new work was added for, or if that one is
+        // busy, one of the parked OS threads which could steal the new work
+        void unpark_for_work(std::size_t num_thread)
+        {
+            std::size_t num_threads = parking_data_.size();
+            if (num_thread == std::size_t(-1))
+            {
+                num_thread = 0;
+            }
+            else
+            {
+                num_thread %= num_threads;
+                if (unpark(num_thread) || get_queue_length(num_thread) <= 1)
+                    return;
+            }
+
+            for (std::size_t i = 1; i <= num_threads; ++i)
+            {
+                if (unpark((num_thread + i) % num_threads))
+                    return;
+            }
+        }
+
+        bool const parking_enabled_;
+        std::int64_t const max_park_duration_;
+        std::vector<parking_data> parking_data_;
+        std::atomic<std::size_t> num_parked_;
+
+        // number of OS threads currently looking for work
+        std::atomic<std::size_t> num_idle_;
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
         coroutines::detail::tss_data_node* find_tss_data(void const* key)
@@ -30,6 +30,18 @@ namespace hpx { namespace threads { namespace policies
             ///< scheduler to dynamically increase and reduce the number of
             ///< processing units it runs on.
     };
+
+    /// The topological distance between a worker thread and the worker
+    /// thread it stole work from, used by schedulers which keep track of
+    /// where stolen work comes from.
+    enum steal_distance
+    {
+        steal_distance_l2 = 0,          ///< victim shares the L2 cache
+        steal_distance_l3 = 1,          ///< victim shares the L3 cache
+        steal_distance_numa_node = 2,   ///< victim shares the NUMA domain
+        steal_distance_remote = 3,      ///< victim is on another NUMA domain
+        steal_distance_count = 4
+    };
 }}}
 
 #endif
@@ -0,0 +1,113 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_THREAD_HEAP_OCT_17_2017_1016AM)
+#define HPX_THREADMANAGER_THREAD_HEAP_OCT_17_2017_1016AM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/lockfree/stack.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_heap is a bounded lock-free free list of recycled thread
+    // objects (all of the same stack size). Each thread_queue owns one of
+    // those for every supported stack size.
+    //
+    // All nodes needed by the underlying stack are allocated up front, pushing
+    // and popping items never allocates memory. The top of the stack is
+    // padded to a full cache line by Boost.Lockfree, which keeps the heaps
+    // of different worker threads from sharing cache lines.
+    //
+    // The free list holds on to the reference the thread_queue had to the
+    // recycled thread object, i.e. it keeps the thread object alive until it
+    // is either reused or the heap is destroyed.
+    class thread_heap
+    {
+    private:
+        typedef boost::lockfree::stack<thread_data*> heap_type;
+
+    public:
+        HPX_NON_COPYABLE(thread_heap);
+
+    public:
+        explicit thread_heap(std::size_t max_size)
+          : heap_(max_size),
+            count_(0),
+            max_size_(static_cast<std::int64_t>(max_size))
+        {}
+
+        ~thread_heap()
+        {
+            // release all thread objects still held by this free list
+            thread_id_type thrd;
+            while (pop(thrd))
+                thrd.reset();
+        }
+
+        // Store the given thread object for later reuse. Returns false if the
+        // free list is full, in which case the caller retains ownership.
+        bool push(thread_id_type& thrd)
+        {
+            HPX_ASSERT(thrd);
+
+            if (count_.load(std::memory_order_relaxed) >= max_size_)
+                return false;
+
+            if (!heap_.bounded_push(thrd.get()))
+                return false;
+
+            // the reference is now owned by the free list
+            ++count_;
+            thrd.detach();
+            return true;
+        }
+
+        // Retrieve a thread object for reuse, returns false if none is
+        // available.
+        bool pop(thread_id_type& thrd)
+        {
+            thread_data* p = nullptr;
+            if (!heap_.pop(p))
+                return false;
+
+            --count_;
+
+            // take over the reference which was held by the free list
+            thrd = thread_id_type(p, false);
+            return true;
+        }
+
+        std::int64_t size() const
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        std::int64_t max_size() const
+        {
+            return max_size_;
+        }
+
+        bool empty() const
+        {
+            return size() <= 0;
+        }
+
+    private:
+        heap_type heap_;
+        std::atomic<std::int64_t> count_;
+        std::int64_t const max_size_;
+    };
+}}}
+
+#endif
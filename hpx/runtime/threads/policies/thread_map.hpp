@@ -0,0 +1,188 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_THREAD_MAP_OCT_17_2017_0302PM)
+#define HPX_THREADMANAGER_THREAD_MAP_OCT_17_2017_0302PM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_map holds a reference to all threads managed by a
+    // thread_queue (except depleted ones).
+    //
+    // The threads are distributed over a fixed number of shards, each of
+    // which is protected by its own spinlock. Registering or unregistering a
+    // thread locks only the shard the thread belongs to, neither operation
+    // requires to hold the lock of the owning thread_queue. The number of
+    // threads is maintained separately as an atomic counter, i.e. querying
+    // the size of the map does not acquire any lock.
+    class thread_map
+    {
+    private:
+        typedef hpx::util::spinlock mutex_type;
+
+        struct thread_id_hash
+        {
+            std::size_t operator()(thread_id_type const& id) const
+            {
+                return std::hash<thread_data const*>()(id.get());
+            }
+        };
+
+        typedef std::unordered_set<thread_id_type, thread_id_hash> set_type;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            set_type threads_;
+
+            // keep neighboring shards on separate cache lines
+            char padding_[BOOST_LOCKFREE_CACHELINE_BYTES];
+        };
+
+    public:
+        enum { num_shards = 16 };
+
+        HPX_NON_COPYABLE(thread_map);
+
+    public:
+        explicit thread_map(std::size_t initial_size = 0)
+          : count_(0)
+        {
+            // avoid rehashing as long as the expected number of threads is
+            // not exceeded
+            std::size_t const per_shard = initial_size / num_shards + 1;
+            for (shard& s : shards_)
+                s.threads_.reserve(per_shard);
+        }
+
+        // Add the given thread to the map, returns false if it was already
+        // registered.
+        bool insert(thread_id_type const& thrd)
+        {
+            HPX_ASSERT(thrd);
+
+            shard& s = get_shard(thrd.get());
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+                if (!s.threads_.insert(thrd).second)
+                    return false;
+            }
+
+            ++count_;
+            return true;
+        }
+
+        // Remove the given thread from the map. If the thread was found and
+        // removed the reference held by the map is handed over to the caller
+        // through 'removed' (if given).
+        bool erase(thread_data* thrd, thread_id_type* removed = nullptr)
+        {
+            HPX_ASSERT(thrd);
+
+            // the thread object might be destroyed when the reference held by
+            // the map is released, do this only after the lock was released
+            thread_id_type id;
+
+            shard& s = get_shard(thrd);
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+
+                set_type::iterator it = s.threads_.find(thread_id_type(thrd));
+                if (it == s.threads_.end())
+                    return false;
+
+                id = *it;
+                s.threads_.erase(it);
+            }
+
+            --count_;
+            HPX_ASSERT(count_ >= 0);
+
+            if (removed != nullptr)
+                *removed = std::move(id);
+            return true;
+        }
+
+        bool contains(thread_data* thrd) const
+        {
+            shard const& s = get_shard(thrd);
+
+            std::lock_guard<mutex_type> lk(s.mtx_);
+            return s.threads_.find(thread_id_type(thrd)) != s.threads_.end();
+        }
+
+        std::int64_t size() const
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        // Invoke the given function for all registered threads. The shards
+        // are locked one at a time while being traversed, the function must
+        // not (directly or indirectly) access this map.
+        template <typename F>
+        void for_each(F && f) const
+        {
+            for (shard const& s : shards_)
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+                for (thread_id_type const& id : s.threads_)
+                    f(id);
+            }
+        }
+
+        // Return a snapshot of all registered threads.
+        std::vector<thread_id_type> get_threads() const
+        {
+            std::vector<thread_id_type> ids;
+            ids.reserve(static_cast<std::size_t>(size()));
+
+            for_each([&ids](thread_id_type const& id) { ids.push_back(id); });
+            return ids;
+        }
+
+    private:
+        static std::size_t get_shard_index(thread_data const* thrd)
+        {
+            // the low bits of the addresses of thread objects carry little
+            // information, mix in some of the higher bits instead
+            std::size_t const addr = reinterpret_cast<std::size_t>(thrd);
+            return ((addr >> 6) ^ (addr >> 12)) % num_shards;
+        }
+
+        shard& get_shard(thread_data const* thrd)
+        {
+            return shards_[get_shard_index(thrd)];
+        }
+
+        shard const& get_shard(thread_data const* thrd) const
+        {
+            return shards_[get_shard_index(thrd)];
+        }
+
+    private:
+        shard shards_[num_shards];
+        std::atomic<std::int64_t> count_;
+    };
+}}}
+
+#endif
@@ -10,9 +10,12 @@
 #include <hpx/config.hpp>
 #include <hpx/compat/mutex.hpp>
 #include <hpx/error_code.hpp>
+#include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
+#include <hpx/runtime/threads/policies/thread_heap.hpp>
+#include <hpx/runtime/threads/policies/thread_map.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
@@ -33,12 +36,10 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -127,6 +128,14 @@ namespace hpx { namespace threads { namespace policies
                     std::to_string(HPX_SCHEDULER_MAX_TERMINATED_THREADS)));
             return max_terminated_threads;
         }
+
+        inline std::size_t get_max_thread_heap_size()
+        {
+            static std::size_t max_thread_heap_size =
+                boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                    "hpx.thread_queue.max_thread_heap_size", "1000"));
+            return max_thread_heap_size;
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -187,9 +196,6 @@ namespace hpx { namespace threads { namespace policies
         // number of terminated threads to collect before cleaning them up
         int const max_terminated_threads;
 
-        // this is the type of a map holding all threads (except depleted ones)
-        typedef std::unordered_set<thread_id_type> thread_map_type;
-
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
             util::tuple<thread_init_data, thread_state_enum, std::uint64_t>
@@ -214,73 +220,91 @@ namespace hpx { namespace threads { namespace policies
             apply<thread_data*>::type terminated_items_type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        // return the free list holding recycled thread objects for the given
+        // stack size
+        thread_heap& get_thread_heap(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-            HPX_ASSERT(data.stacksize != 0);
-
-            std::ptrdiff_t stacksize = data.stacksize;
-
-            std::list<thread_id_type>* heap = nullptr;
-
             if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                heap = &thread_heap_small_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                heap = &thread_heap_medium_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                heap = &thread_heap_large_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                heap = &thread_heap_huge_;
+                return thread_heap_small_;
+            if (stacksize == get_stack_size(thread_stacksize_medium))
+                return thread_heap_medium_;
+            if (stacksize == get_stack_size(thread_stacksize_large))
+                return thread_heap_large_;
+            if (stacksize == get_stack_size(thread_stacksize_huge))
+                return thread_heap_huge_;
+            if (stacksize == get_stack_size(thread_stacksize_nostack))
+                return thread_heap_nostack_;
+
+            switch(stacksize) {
+            case thread_stacksize_medium:
+                return thread_heap_medium_;
+
+            case thread_stacksize_large:
+                return thread_heap_large_;
+
+            case thread_stacksize_huge:
+                return thread_heap_huge_;
+
+            case thread_stacksize_nostack:
+                return thread_heap_nostack_;
+
+            case thread_stacksize_small:
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
             }
-            else {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    heap = &thread_heap_small_;
-                    break;
+            return thread_heap_small_;
+        }
 
-                case thread_stacksize_medium:
-                    heap = &thread_heap_medium_;
-                    break;
+        // Take over an unused thread object from the free list of the given
+        // queue. This rebalances the free lists whenever a worker converts
+        // tasks it has stolen from a neighbor into threads.
+        bool steal_thread_object(thread_queue* src, std::ptrdiff_t stacksize,
+            threads::thread_id_type& thrd)
+        {
+            if (!src->get_thread_heap(stacksize).pop(thrd))
+                return false;
 
-                case thread_stacksize_large:
-                    heap = &thread_heap_large_;
-                    break;
+            thrd->set_pool(&memory_pool_);
+            return true;
+        }
 
-                case thread_stacksize_huge:
-                    heap = &thread_heap_huge_;
-                    break;
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state, Lock& lk,
+            thread_queue* addfrom = nullptr)
+        {
+            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(data.stacksize != 0);
 
-                default:
-                    break;
-                }
-            }
-            HPX_ASSERT(heap);
+            std::ptrdiff_t stacksize = data.stacksize;
+            thread_heap& heap = get_thread_heap(stacksize);
 
             if (state == pending_do_not_schedule || state == pending_boost)
             {
                 state = pending;
             }
 
-            // Check for an unused thread object.
-            if (!heap->empty())
+            // Check for an unused thread object, either in our own free list
+            // or in the free list of the queue the task was stolen from.
+            if (heap.pop(thrd) ||
+                (addfrom != nullptr && addfrom != this &&
+                    steal_thread_object(addfrom, stacksize, thrd)))
             {
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+                ++thread_heap_hits_;
+#endif
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
                 thrd->rebind(data, state);
             }
 
             else
             {
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+                ++thread_heap_misses_;
+#endif
                 hpx::util::unlock_guard<Lock> ull(lk);
 
                 // Allocate a new thread object.
@@ -319,22 +343,18 @@ namespace hpx { namespace threads { namespace policies
                 thread_state_enum state = util::get<1>(*task);
                 threads::thread_id_type thrd;
 
-                create_thread_object(thrd, data, state, lk);
+                create_thread_object(thrd, data, state, lk, addfrom);
 
                 delete task;
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
+                if (HPX_UNLIKELY(!thread_map_.insert(thrd))) {
                     lk.unlock();
                     HPX_THROW_EXCEPTION(hpx::out_of_memory,
                         "threadmanager::add_new",
                         "Couldn't add new thread to the thread map");
                     return 0;
                 }
-                ++thread_map_count_;
 
                 // only insert the thread into the work-items queue if it is in
                 // pending state
@@ -346,7 +366,7 @@ namespace hpx { namespace threads { namespace policies
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
+                HPX_ASSERT(thread_map_.contains(thrd.get()));
                 HPX_ASSERT(thrd->get_pool() == &memory_pool_);
             }
 
@@ -372,7 +392,7 @@ namespace hpx { namespace threads { namespace policies
             // if we are desperate (no work in the queues), add some even if the
             // map holds more than max_count
             if (HPX_LIKELY(max_count_)) {
-                std::size_t count = thread_map_.size();
+                std::size_t count = static_cast<std::size_t>(thread_map_.size());
                 if (max_count_ >= count + min_add_new_count) { //-V104
                     HPX_ASSERT(max_count_ - count <
                         static_cast<std::size_t>(
@@ -400,48 +420,8 @@ namespace hpx { namespace threads { namespace policies
 
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize = thrd->get_stack_size();
-
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else
-            {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
-                    break;
-
-                default:
-                    HPX_ASSERT(false);
-                    break;
-                }
-            }
+            // the thread object is released if the free list is full
+            get_thread_heap(thrd->get_stack_size()).push(thrd);
         }
 
     public:
@@ -467,14 +447,9 @@ namespace hpx { namespace threads { namespace policies
                     --terminated_items_count_;
 
                     // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(todelete) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(todelete) != 0;
+                    bool deleted = thread_map_.erase(todelete);
                     HPX_ASSERT(deleted);
-                    if (deleted) {
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    HPX_UNUSED(deleted);
                 }
             }
             else {
@@ -489,16 +464,12 @@ namespace hpx { namespace threads { namespace policies
                 {
                     --terminated_items_count_;
 
-                    thread_map_type::iterator it = thread_map_.find(todelete);
-
                     // this thread has to be in this map
-                    HPX_ASSERT(it != thread_map_.end());
-
-                    recycle_thread(*it);
-
-                    thread_map_.erase(it);
-                    --thread_map_count_;
-                    HPX_ASSERT(thread_map_count_ >= 0);
+                    thread_id_type thrd;
+                    bool deleted = thread_map_.erase(todelete, &thrd);
+                    HPX_ASSERT(deleted);
+                    if (deleted)
+                        recycle_thread(thrd);
 
                     --delete_count;
                 }
@@ -544,7 +515,7 @@ namespace hpx { namespace threads { namespace policies
             max_add_new_count(detail::get_max_add_new_count()),
             max_delete_count(detail::get_max_delete_count()),
             max_terminated_threads(detail::get_max_terminated_threads()),
-            thread_map_count_(0),
+            thread_map_(max_count),
             work_items_(128, queue_num),
             work_items_count_(0),
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -563,10 +534,15 @@ namespace hpx { namespace threads { namespace policies
             new_tasks_wait_count_(0),
 #endif
             memory_pool_(64),
-            thread_heap_small_(),
-            thread_heap_medium_(),
-            thread_heap_large_(),
-            thread_heap_huge_(),
+            thread_heap_small_(detail::get_max_thread_heap_size()),
+            thread_heap_medium_(detail::get_max_thread_heap_size()),
+            thread_heap_large_(detail::get_max_thread_heap_size()),
+            thread_heap_huge_(detail::get_max_thread_heap_size()),
+            thread_heap_nostack_(detail::get_max_thread_heap_size()),
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+            thread_heap_hits_(0),
+            thread_heap_misses_(0),
+#endif
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -619,6 +595,18 @@ namespace hpx { namespace threads { namespace policies
             return new_tasks_count_.load(order);
         }
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_thread_heap_hits(bool reset)
+        {
+            return util::get_and_reset_value(thread_heap_hits_, reset);
+        }
+
+        std::int64_t get_num_thread_heap_misses(bool reset)
+        {
+            return util::get_and_reset_value(thread_heap_misses_, reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::uint64_t get_average_task_wait_time() const
         {
@@ -719,29 +707,26 @@ namespace hpx { namespace threads { namespace policies
             {
                 threads::thread_id_type thrd;
 
-                // The mutex can not be locked while a new thread is getting
-                // created, as it might have that the current HPX thread gets
-                // suspended.
+                // Neither the free lists of thread objects nor the map of
+                // threads require to hold the queue mutex, thus creating a
+                // thread directly does not contend with the scheduling loop.
                 {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                    lcos::local::no_mutex mtx;
+                    std::unique_lock<lcos::local::no_mutex> lk(mtx);
 
                     create_thread_object(thrd, data, initial_state, lk);
 
                     // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
+                    if (HPX_UNLIKELY(!thread_map_.insert(thrd))) {
                         lk.unlock();
                         HPX_THROWS_IF(ec, hpx::out_of_memory,
                             "threadmanager::register_thread",
                             "Couldn't add new thread to the map of threads");
                         return;
                     }
-                    ++thread_map_count_;
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(thrd.get()));
                     HPX_ASSERT(thrd->get_pool() == &memory_pool_);
 
                     // push the new thread in the pending queue thread
@@ -774,6 +759,91 @@ namespace hpx { namespace threads { namespace policies
                 ec = make_success_code();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // create the given number of threads at once, this is equivalent to
+        // calling create_thread for each of them, except that the counters of
+        // this queue are updated only once for all of the new threads
+        void create_threads(thread_init_data* data, std::size_t count,
+            thread_state_enum initial_state, bool run_now, error_code& ec)
+        {
+            if (HPX_UNLIKELY(0 == count))
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            if (run_now)
+            {
+                std::vector<threads::thread_id_type> thrds(count);
+
+                {
+                    lcos::local::no_mutex mtx;
+                    std::unique_lock<lcos::local::no_mutex> lk(mtx);
+
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        create_thread_object(thrds[i], data[i], initial_state,
+                            lk);
+
+                        // add a new entry in the map for this thread
+                        if (HPX_UNLIKELY(!thread_map_.insert(thrds[i]))) {
+                            lk.unlock();
+                            HPX_THROWS_IF(ec, hpx::out_of_memory,
+                                "threadmanager::register_threads",
+                                "Couldn't add new thread to the map of "
+                                "threads");
+                            return;
+                        }
+
+                        // this thread has to be in the map now
+                        HPX_ASSERT(thread_map_.contains(thrds[i].get()));
+                        HPX_ASSERT(thrds[i]->get_pool() == &memory_pool_);
+                    }
+                }
+
+                // push all new threads into the pending queue
+                if (initial_state == pending)
+                {
+                    work_items_count_ += static_cast<std::int64_t>(count);
+                    for (threads::thread_id_type const& thrd : thrds)
+                    {
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                        work_items_.push(new thread_description(
+                            thrd.get(), util::high_resolution_clock::now()));
+#else
+                        work_items_.push(thrd.get());
+#endif
+                    }
+                }
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            // do not execute the work, but register the task descriptions for
+            // later thread creation
+            new_tasks_count_ += static_cast<std::int64_t>(count);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t now = util::high_resolution_clock::now();
+#endif
+            for (std::size_t i = 0; i != count; ++i)
+            {
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new_tasks_.push(new task_description(
+                    std::move(data[i]), initial_state, now));
+#else
+                new_tasks_.push(new task_description( //-V106
+                    std::move(data[i]), initial_state));
+#endif
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue *src, std::int64_t count)
         {
             thread_description* trd;
@@ -879,6 +949,42 @@ namespace hpx { namespace threads { namespace policies
 #endif
         }
 
+        /// Return the deadline of the most urgent pending work item. This is
+        /// available only if the pending work items are ordered by their
+        /// deadline (see deadline_fifo).
+        std::uint64_t get_earliest_deadline() const
+        {
+            return work_items_.get_earliest_deadline();
+        }
+
+        /// Steal up to half of the pending work items of the given queue.
+        /// The first stolen thread is returned, all others are scheduled on
+        /// this queue. Returns the number of threads stolen.
+        std::size_t steal_half_from(thread_queue* src,
+            threads::thread_data*& thrd, bool allow_stealing = true)
+        {
+            std::int64_t work_items_count =
+                src->work_items_count_.load(std::memory_order_relaxed);
+
+            if (0 == work_items_count ||
+                !src->get_next_thread(thrd, allow_stealing, true))
+            {
+                return 0;
+            }
+
+            std::int64_t max_count = (work_items_count + 1) / 2;
+            std::int64_t count = 1;
+
+            threads::thread_data* next = nullptr;
+            while (count < max_count &&
+                src->get_next_thread(next, allow_stealing, true))
+            {
+                schedule_thread(next);
+                ++count;
+            }
+            return static_cast<std::size_t>(count);
+        }
+
         /// Destroy the passed thread as it has been terminated
         bool destroy_thread(threads::thread_data* thrd, std::int64_t& busy_count)
         {
@@ -907,34 +1013,28 @@ namespace hpx { namespace threads { namespace policies
                 return new_tasks_count_;
 
             if (unknown == state)
-                return thread_map_count_ + new_tasks_count_ - terminated_items_count_;
-
-            // acquire lock only if absolutely necessary
-            std::lock_guard<mutex_type> lk(mtx_);
+                return thread_map_.size() + new_tasks_count_ -
+                    terminated_items_count_;
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == state)
-                    ++num_threads;
-            }
+            thread_map_.for_each(
+                [state, &num_threads](thread_id_type const& id)
+                {
+                    if (id->get_state().state() == state)
+                        ++num_threads;
+                });
             return num_threads;
         }
 
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads()
         {
-            std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
-                 it != end; ++it)
+            for (thread_id_type const& id : thread_map_.get_threads())
             {
-                if ((*it)->get_state().state() == suspended)
+                if (id->get_state().state() == suspended)
                 {
-                    (*it)->set_state(pending, wait_abort);
-                    schedule_thread((*it).get());
+                    id->set_state(pending, wait_abort);
+                    schedule_thread(id.get());
                 }
             }
         }
@@ -943,7 +1043,7 @@ namespace hpx { namespace threads { namespace policies
             util::function_nonser<bool(thread_id_type)> const& f,
             thread_state_enum state = unknown) const
         {
-            std::uint64_t count = thread_map_count_;
+            std::uint64_t count = static_cast<std::uint64_t>(thread_map_.size());
             if (state == terminated)
             {
                 count = terminated_items_count_;
@@ -959,27 +1059,12 @@ namespace hpx { namespace threads { namespace policies
             std::vector<thread_id_type> ids;
             ids.reserve(static_cast<std::size_t>(count));
 
-            if (state == unknown)
-            {
-                std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
+            thread_map_.for_each(
+                [state, &ids](thread_id_type const& id)
                 {
-                    ids.push_back(*it);
-                }
-            }
-            else
-            {
-                std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    if ((*it)->get_state().state() == state)
-                        ids.push_back(*it);
-                }
-            }
+                    if (state == unknown || id->get_state().state() == state)
+                        ids.push_back(id);
+                });
 
             // now invoke callback function for all matching threads
             for (thread_id_type const& id : ids)
@@ -1076,8 +1161,8 @@ namespace hpx { namespace threads { namespace policies
             return false;
 #else
             if (minimal_deadlock_detection) {
-                std::lock_guard<mutex_type> lk(mtx_);
-                return detail::dump_suspended_threads(num_thread, thread_map_
+                std::vector<thread_id_type> ids = thread_map_.get_threads();
+                return detail::dump_suspended_threads(num_thread, ids
                   , idle_loop_count, running);
             }
             return false;
@@ -1092,10 +1177,9 @@ namespace hpx { namespace threads { namespace policies
     private:
         mutable mutex_type mtx_;                    ///< mutex protecting the members
 
-        thread_map_type thread_map_;
-        ///< mapping of thread id's to HPX-threads
-        std::atomic<std::int64_t> thread_map_count_;
-        ///< overall count of work items
+        thread_map thread_map_;
+        ///< mapping of thread id's to HPX-threads, also maintains the overall
+        ///< count of threads
 
         work_items_type work_items_;
         ///< list of active work items
@@ -1129,10 +1213,19 @@ namespace hpx { namespace threads { namespace policies
         threads::thread_pool memory_pool_;          ///< OS thread local memory pools for
                                                     ///< HPX-threads
 
-        std::list<thread_id_type> thread_heap_small_;
-        std::list<thread_id_type> thread_heap_medium_;
-        std::list<thread_id_type> thread_heap_large_;
-        std::list<thread_id_type> thread_heap_huge_;
+        thread_heap thread_heap_small_;
+        thread_heap thread_heap_medium_;
+        thread_heap thread_heap_large_;
+        thread_heap thread_heap_huge_;
+        thread_heap thread_heap_nostack_;
+        ///< free lists of recycled thread objects, one for each stack size
+
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::atomic<std::int64_t> thread_heap_hits_;
+        ///< count of thread objects reused from the free lists
+        std::atomic<std::int64_t> thread_heap_misses_;
+        ///< count of newly allocated thread objects
+#endif
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
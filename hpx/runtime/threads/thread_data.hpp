@@ -454,6 +454,13 @@ namespace hpx { namespace threads
             priority_ = priority;
         }
 
+        // Return the absolute deadline of this thread (in nanoseconds, as
+        // reported by util::high_resolution_clock), zero if none was given
+        std::uint64_t get_deadline() const
+        {
+            return deadline_;
+        }
+
         // handle thread interruption
         bool interruption_requested() const
         {
@@ -508,6 +515,14 @@ namespace hpx { namespace threads
             return pool_;
         }
 
+        // Hand the ownership of this (recycled) thread object over to a
+        // different memory pool. This is used by the thread queues when
+        // moving unused thread objects between the per-worker free lists.
+        void set_pool(pool_type* pool)
+        {
+            pool_ = pool;
+        }
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -598,6 +613,7 @@ namespace hpx { namespace threads
             backtrace_(nullptr),
 #endif
             priority_(init_data.priority),
+            deadline_(init_data.deadline),
             requested_interrupt_(false),
             enabled_interrupt_(true),
             ran_exit_funcs_(false),
@@ -655,6 +671,7 @@ namespace hpx { namespace threads
             backtrace_ = nullptr;
 #endif
             priority_ = init_data.priority;
+            deadline_ = init_data.deadline;
             requested_interrupt_ = false;
             enabled_interrupt_ = true;
             ran_exit_funcs_ = false;
@@ -715,6 +732,7 @@ namespace hpx { namespace threads
 
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -24,6 +24,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads
@@ -678,6 +679,12 @@ namespace hpx { namespace this_thread
     // requested
     HPX_EXPORT bool has_sufficient_stack_space(
         std::size_t space_needed = 8 * HPX_THREADS_STACK_OVERHEAD);
+
+    // returns whether a task forked by the current thread should be executed
+    // inline (work-first) instead of being run on a new thread, this is the
+    // case if none of the other worker threads of the current thread pool is
+    // looking for work and if the remaining stack-space is sufficient
+    HPX_EXPORT bool can_fork_inline();
     /// \endcond
 }}
 
@@ -929,6 +936,41 @@ namespace hpx { namespace applier
         threads::thread_init_data& data,
         threads::thread_state_enum initial_state = threads::pending,
         error_code& ec = throws);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create new work items for all of the given thread data at once.
+    ///
+    /// \note This function is equivalent to calling threads#register_work_plain
+    ///       for each of the given threads#thread_init_data objects, except
+    ///       that the new work items are distributed over the queues of the
+    ///       scheduler in bulk, which significantly reduces the overheads of
+    ///       creating large numbers of threads.
+    ///
+    HPX_API_EXPORT void register_work_plain(
+        std::vector<threads::thread_init_data>& data,
+        threads::thread_state_enum initial_state = threads::pending,
+        error_code& ec = throws);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create new work items using each of the given functions as the
+    ///        work to be executed.
+    ///
+    /// \param funcs      [in] The functions to be executed as the
+    ///                   thread-functions of the new work items. All of them
+    ///                   take no arguments. The threads will be terminated
+    ///                   after the functions return.
+    ///
+    /// \note All other arguments are equivalent to those of the function
+    ///       \a threads#register_work_plain and apply to all of the new work
+    ///       items.
+    ///
+    HPX_API_EXPORT void register_work_nullary(
+        std::vector<util::unique_function_nonser<void()> >& funcs,
+        util::thread_description const& description = util::thread_description(),
+        threads::thread_state_enum initial_state = threads::pending,
+        threads::thread_priority priority = threads::thread_priority_normal,
+        threads::thread_stacksize stacksize = threads::thread_stacksize_default,
+        error_code& ec = throws);
 }}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,7 @@ namespace hpx { namespace threads
             parent_locality_id(0), parent_id(nullptr), parent_phase(0),
 #endif
             priority(thread_priority_normal),
+            deadline(0),
             num_os_thread(std::size_t(-1)),
             stacksize(get_default_stack_size()),
             scheduler_base(nullptr)
@@ -57,6 +58,7 @@ namespace hpx { namespace threads
             parent_phase(rhs.parent_phase),
 #endif
             priority(rhs.priority),
+            deadline(rhs.deadline),
             num_os_thread(rhs.num_os_thread),
             stacksize(rhs.stacksize),
             scheduler_base(rhs.scheduler_base)
@@ -82,7 +84,7 @@ namespace hpx { namespace threads
 #if defined(HPX_HAVE_THREAD_PARENT_REFERENCE)
             parent_locality_id(0), parent_id(nullptr), parent_phase(0),
 #endif
-            priority(priority_), num_os_thread(os_thread),
+            priority(priority_), deadline(0), num_os_thread(os_thread),
             stacksize(stacksize_ == std::ptrdiff_t(-1) ?
                 get_default_stack_size() : stacksize_),
             scheduler_base(scheduler_base_)
@@ -106,6 +108,12 @@ namespace hpx { namespace threads
 #endif
 
         thread_priority priority;
+
+        // absolute deadline of the new thread (in nanoseconds, as reported
+        // by util::high_resolution_clock), zero if none, this is taken into
+        // account by the deadline scheduler only
+        std::uint64_t deadline;
+
         std::size_t num_os_thread;
         std::ptrdiff_t stacksize;
 
@@ -16,6 +16,7 @@
 #include <hpx/performance_counters/counters_fwd.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
+#include <hpx/runtime/threads/detail/elasticity_controller.hpp>
 #include <hpx/runtime/threads/detail/thread_num_tss.hpp>
 #include <hpx/runtime/threads/detail/thread_pool_base.hpp>
 #include <hpx/runtime/threads/policies/scheduler_mode.hpp>
@@ -107,6 +108,15 @@ namespace hpx { namespace threads
             thread_state_enum initial_state = pending,
             error_code& ec = throws);
 
+        /// The function \a register_work adds new work items for all of the
+        /// given thread data to the thread manager at once. This is
+        /// equivalent to calling \a register_work for each of them, except
+        /// that the work items are distributed over the queues of the
+        /// scheduler in bulk.
+        void register_work(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state = pending,
+            error_code& ec = throws);
+
         /// The function \a register_thread adds a new work item to the thread
         /// manager. It creates a new \a thread, adds it to the internal
         /// management data structures, and schedules the new thread, if
@@ -376,6 +386,12 @@ namespace hpx { namespace threads
                 staged, thread_priority_default, std::size_t(-1), reset);
         }
 
+        std::int64_t get_num_parks(bool reset);
+        std::int64_t get_num_unparks(bool reset);
+        std::int64_t get_average_wakeup_latency(bool reset);
+
+        std::int64_t get_num_missed_deadlines(bool reset);
+
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         std::int64_t avg_idle_rate(bool reset);
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
@@ -387,6 +403,8 @@ namespace hpx { namespace threads
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
         std::int64_t get_executed_threads(bool reset);
         std::int64_t get_executed_thread_phases(bool reset);
+        std::int64_t get_num_thread_heap_hits(bool reset);
+        std::int64_t get_num_thread_heap_misses(bool reset);
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         std::int64_t get_thread_duration(bool reset);
         std::int64_t get_thread_phase_duration(bool reset);
@@ -404,6 +422,11 @@ namespace hpx { namespace threads
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+
+        std::int64_t get_num_stolen_from_l2(bool reset);
+        std::int64_t get_num_stolen_from_l3(bool reset);
+        std::int64_t get_num_stolen_from_numa_node(bool reset);
+        std::int64_t get_num_stolen_from_remote(bool reset);
 #endif
 
 private:
@@ -421,6 +444,9 @@ private:
 #endif
         pool_vector pools_;
 
+        // adjusts the number of active processing units of elastic pools
+        std::unique_ptr<detail::elasticity_controller> elasticity_controller_;
+
         notification_policy_type& notifier_;
     };
 }}
@@ -116,6 +116,18 @@ namespace hpx { namespace threads
         virtual mask_cref_type get_core_affinity_mask(std::size_t num_thread,
             error_code& ec = throws) const = 0;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level
+        ///        (1, 2, or 3) with the given thread. If the machine does not
+        ///        expose a cache at this level the core affinity mask (level
+        ///        1 and 2) or the socket affinity mask (level 3) is returned.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        virtual mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t cache_level, error_code& ec = throws) const = 0;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -0,0 +1,56 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_TRAITS_IS_CANCELLABLE_EXECUTOR_HPP)
+#define HPX_TRAITS_IS_CANCELLABLE_EXECUTOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename T>
+        struct is_cancellable_executor
+          : std::false_type
+        {};
+        /// \endcond
+    }
+
+    // Executor type traits:
+
+    // Condition: T carries a cancellation token (exposed through
+    // get_cancellation_token()) and gives access to the executor it wraps
+    // (exposed through base_executor())
+    template <typename T>
+    struct is_cancellable_executor
+      : detail::is_cancellable_executor<typename hpx::util::decay<T>::type>
+    {};
+
+    template <typename T>
+    using is_cancellable_executor_t =
+        typename is_cancellable_executor<T>::type;
+
+#if defined(HPX_HAVE_CXX17_VARIABLE_TEMPLATES)
+    template <typename T>
+    constexpr bool is_cancellable_executor_v =
+        is_cancellable_executor<T>::value;
+#endif
+}}}
+
+namespace hpx { namespace traits
+{
+    // new executor framework
+    template <typename Executor, typename Enable = void>
+    struct is_cancellable_executor
+      : parallel::execution::is_cancellable_executor<Executor>
+    {};
+}}
+
+#endif
@@ -8,7 +8,7 @@
 #define HPX_UTIL_ONE_SIZE_HEAP_LIST_HPP
 
 #include <hpx/config.hpp>
-#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/lcos/local/runtime_spinlock.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
@@ -30,7 +30,7 @@ namespace hpx { namespace util
         typedef typename list_type::iterator iterator;
         typedef typename list_type::const_iterator const_iterator;
 
-        typedef lcos::local::spinlock mutex_type;
+        typedef lcos::local::runtime_spinlock mutex_type;
 
         typedef std::unique_lock<mutex_type> unique_lock_type;
 
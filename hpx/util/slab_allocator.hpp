@@ -0,0 +1,31 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_SLAB_ALLOCATOR_HPP)
+#define HPX_UTIL_SLAB_ALLOCATOR_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A size-class based allocator for small, short lived objects (like the
+    // shared states of futures). Each OS thread carves blocks out of its own
+    // slabs. Memory released by a different OS thread is handed back to the
+    // slabs of the thread which allocated it. Requests for blocks larger than
+    // the biggest size class are forwarded to the global heap.
+    HPX_EXPORT void* slab_allocate(std::size_t size);
+    HPX_EXPORT void slab_deallocate(void* p) noexcept;
+
+    // Statistics
+    HPX_EXPORT std::int64_t get_slab_allocations(bool reset);
+    HPX_EXPORT std::int64_t get_slab_remote_deallocations(bool reset);
+    HPX_EXPORT std::int64_t get_slab_heap_allocations(bool reset);
+}}
+
+#endif
@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_SMALL_VECTOR_HPP)
+#define HPX_UTIL_SMALL_VECTOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A (move-only) sequence container which keeps the first N elements in
+    // inline storage, the heap is used only for sequences growing beyond
+    // this size. The elements are required to be nothrow move constructible.
+    template <typename T, std::size_t N>
+    class small_vector
+    {
+        static_assert(N != 0, "small_vector requires inline storage");
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+            "small_vector requires nothrow move constructible elements");
+
+        typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type
+            storage_type;
+
+    public:
+        typedef T value_type;
+        typedef std::size_t size_type;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef T* iterator;
+        typedef T const* const_iterator;
+
+        small_vector() noexcept
+          : data_(reinterpret_cast<T*>(&storage_)), size_(0), capacity_(N)
+        {}
+
+        small_vector(small_vector && rhs) noexcept
+          : data_(reinterpret_cast<T*>(&storage_)), size_(0), capacity_(N)
+        {
+            take_over(rhs);
+        }
+
+        small_vector& operator=(small_vector && rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                clear();
+                deallocate();
+                take_over(rhs);
+            }
+            return *this;
+        }
+
+        ~small_vector()
+        {
+            clear();
+            deallocate();
+        }
+
+        small_vector(small_vector const&) = delete;
+        small_vector& operator=(small_vector const&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        iterator begin() noexcept { return data_; }
+        iterator end() noexcept { return data_ + size_; }
+        const_iterator begin() const noexcept { return data_; }
+        const_iterator end() const noexcept { return data_ + size_; }
+
+        reference operator[](size_type pos)
+        {
+            HPX_ASSERT(pos < size_);
+            return data_[pos];
+        }
+        const_reference operator[](size_type pos) const
+        {
+            HPX_ASSERT(pos < size_);
+            return data_[pos];
+        }
+
+        reference front() { return (*this)[0]; }
+        reference back() { return (*this)[size_ - 1]; }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename... Ts>
+        reference emplace_back(Ts &&... ts)
+        {
+            if (size_ == capacity_)
+                grow(2 * capacity_);
+
+            T* p = ::new (static_cast<void*>(data_ + size_))
+                T(std::forward<Ts>(ts)...);
+            ++size_;
+            return *p;
+        }
+
+        void push_back(T && value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        void clear() noexcept
+        {
+            for (size_type i = 0; i != size_; ++i)
+                data_[i].~T();
+            size_ = 0;
+        }
+
+    private:
+        bool is_inline() const noexcept
+        {
+            return data_ == reinterpret_cast<T const*>(&storage_);
+        }
+
+        void grow(size_type capacity)
+        {
+            T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+            for (size_type i = 0; i != size_; ++i)
+            {
+                ::new (static_cast<void*>(data + i)) T(std::move(data_[i]));
+                data_[i].~T();
+            }
+
+            deallocate();
+            data_ = data;
+            capacity_ = capacity;
+        }
+
+        void deallocate() noexcept
+        {
+            if (!is_inline())
+            {
+                ::operator delete(data_);
+                data_ = reinterpret_cast<T*>(&storage_);
+                capacity_ = N;
+            }
+        }
+
+        // requires this to be empty and to use the inline storage
+        void take_over(small_vector& rhs) noexcept
+        {
+            if (rhs.is_inline())
+            {
+                for (size_type i = 0; i != rhs.size_; ++i)
+                {
+                    ::new (static_cast<void*>(data_ + i))
+                        T(std::move(rhs.data_[i]));
+                }
+                size_ = rhs.size_;
+                rhs.clear();
+            }
+            else
+            {
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                capacity_ = rhs.capacity_;
+
+                rhs.data_ = reinterpret_cast<T*>(&rhs.storage_);
+                rhs.size_ = 0;
+                rhs.capacity_ = N;
+            }
+        }
+
+    private:
+        T* data_;
+        size_type size_;
+        size_type capacity_;
+        storage_type storage_[N];
+    };
+}}
+
+#endif
@@ -20,10 +20,12 @@
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace detail
 {
@@ -35,7 +37,11 @@ namespace hpx { namespace lcos { namespace detail
     {
         lcos::local::futures_factory<bool()> p(std::move(f));
 
-        bool is_hpx_thread = nullptr != hpx::threads::get_self_ptr();
+        // stackless threads can neither yield to the new thread nor wait for
+        // it to finish, treat them like non-HPX threads
+        bool is_hpx_thread = nullptr != hpx::threads::get_self_ptr() &&
+            hpx::threads::get_self_stacksize() !=
+                std::size_t(HPX_NOSTACK_STACK_SIZE);
         hpx::launch policy = launch::fork;
         if (!is_hpx_thread)
             policy = launch::async;
@@ -55,8 +61,9 @@ namespace hpx { namespace lcos { namespace detail
         }
         else
         {
-            // If we are not on a HPX thread, we need to return immediately, to
-            // allow the newly spawned thread to execute. This might swallow
+            // If we are not on a HPX thread (or on a stackless one), we need
+            // to return immediately, to allow the newly spawned thread to
+            // execute. This might swallow
             // possible exceptions bubbling up from the completion handler (which
             // shouldn't happen anyway...
             return true;
@@ -129,13 +136,29 @@ namespace hpx { namespace lcos { namespace detail
         return true;
     }
 
-    // make sure continuation invocation does not recurse deeper than
-    // allowed
-    void future_data_base<traits::detail::future_data_void>::
-        handle_on_completed(completed_callback_type && on_completed)
+    bool future_data_base<traits::detail::future_data_void>::
+        run_on_completed(completed_callback_vector_type && on_completed,
+        std::exception_ptr& ptr)
+    {
+        try {
+            for (completed_callback_type& f : on_completed)
+            {
+                hpx::util::annotate_function annotate(f);
+                f();
+            }
+        }
+        catch (...) {
+            ptr = std::current_exception();
+            return false;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // We need to run the completion on a new thread if we are on a non HPX
+    // thread or if the recursion depth is exceeded.
+    static bool recurse_asynchronously()
     {
-        // We need to run the completion on a new thread if we are on a
-        // non HPX thread.
         bool recurse_asynchronously = hpx::threads::get_self_ptr() == nullptr;
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
         recurse_asynchronously =
@@ -145,7 +168,15 @@ namespace hpx { namespace lcos { namespace detail
         recurse_asynchronously = recurse_asynchronously ||
             cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
 #endif
-        if (!recurse_asynchronously)
+        return recurse_asynchronously;
+    }
+
+    // make sure continuation invocation does not recurse deeper than
+    // allowed
+    void future_data_base<traits::detail::future_data_void>::
+        handle_on_completed(completed_callback_type && on_completed)
+    {
+        if (!recurse_asynchronously())
         {
             // directly execute continuation on this thread
             std::exception_ptr ptr;
@@ -164,7 +195,50 @@ namespace hpx { namespace lcos { namespace detail
             std::exception_ptr ptr;
             if (!run_on_completed_on_new_thread(
                     util::deferred_call(
-                        &future_data_base::run_on_completed,
+                        static_cast<bool (future_data_base::*)(
+                            completed_callback_type&&, std::exception_ptr&)
+                        >(&future_data_base::run_on_completed),
+                        std::move(this_), std::move(on_completed),
+                        std::ref(ptr)),
+                    ec))
+            {
+                // thread creation went wrong
+                if (ec) {
+                    set_exception(hpx::detail::access_exception(ec));
+                    return;
+                }
+
+                // re-throw exception in this context
+                HPX_ASSERT(ptr);        // exception should have been set
+                std::rethrow_exception(ptr);
+            }
+        }
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        handle_on_completed(completed_callback_vector_type && on_completed)
+    {
+        HPX_ASSERT(!on_completed.empty());
+
+        if (on_completed.size() == 1)
+        {
+            handle_on_completed(std::move(on_completed.front()));
+            return;
+        }
+
+        if (recurse_asynchronously())
+        {
+            // re-spawn all continuations on a single new thread
+            boost::intrusive_ptr<future_data_base> this_(this);
+
+            error_code ec(lightweight);
+            std::exception_ptr ptr;
+            if (!run_on_completed_on_new_thread(
+                    util::deferred_call(
+                        static_cast<bool (future_data_base::*)(
+                            completed_callback_vector_type&&,
+                            std::exception_ptr&)
+                        >(&future_data_base::run_on_completed),
                         std::move(this_), std::move(on_completed),
                         std::ref(ptr)),
                     ec))
@@ -179,6 +253,64 @@ namespace hpx { namespace lcos { namespace detail
                 HPX_ASSERT(ptr);        // exception should have been set
                 std::rethrow_exception(ptr);
             }
+            return;
+        }
+
+        // hand all continuations which exceed the limit to the scheduler at
+        // once, this allows for them to be picked up by other cores while we
+        // run the remaining continuations
+        std::size_t const max_inline = HPX_CONTINUATION_MAX_INLINE_CALLBACKS;
+        if (on_completed.size() > max_inline)
+        {
+            boost::intrusive_ptr<future_data_base> this_(this);
+
+            std::vector<completed_callback_type> funcs;
+            funcs.reserve(on_completed.size() - max_inline);
+            for (std::size_t i = max_inline; i != on_completed.size(); ++i)
+            {
+                funcs.push_back(util::deferred_call(
+                    &future_data_base::run_on_completed_spawned, this_,
+                    std::move(on_completed[i])));
+            }
+
+            error_code ec(lightweight);
+            applier::register_work_nullary(funcs,
+                "future_data_base::handle_on_completed", threads::pending,
+                threads::thread_priority_boost,
+                threads::thread_stacksize_current, ec);
+            if (ec)
+            {
+                set_exception(hpx::detail::access_exception(ec));
+                return;
+            }
+        }
+
+        // directly execute the remaining continuations on this thread
+        std::exception_ptr ptr;
+        try {
+            for (std::size_t i = 0;
+                 i != max_inline && i != on_completed.size(); ++i)
+            {
+                completed_callback_type& f = on_completed[i];
+
+                hpx::util::annotate_function annotate(f);
+                f();
+            }
+        }
+        catch (...) {
+            error_code ec(lightweight);
+            set_exception(hpx::detail::access_exception(ec));
+        }
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        run_on_completed_spawned(completed_callback_type && on_completed)
+    {
+        std::exception_ptr ptr;
+        if (!run_on_completed(std::move(on_completed), ptr))
+        {
+            error_code ec(lightweight);
+            set_exception(hpx::detail::access_exception(ec));
         }
     }
 
@@ -194,7 +326,7 @@ namespace hpx { namespace lcos { namespace detail
 
         if (is_ready_locked(l)) {
 
-            HPX_ASSERT(!on_completed_);
+            HPX_ASSERT(on_completed_.empty());
 
             // invoke the callback (continuation) function right away
             l.unlock();
@@ -202,11 +334,11 @@ namespace hpx { namespace lcos { namespace detail
             handle_on_completed(std::move(data_sink));
         }
         else {
-            // store a combined callback wrapping the old and the new one
-            // make sure continuations are evaluated in the order they are
-            // attached
-            on_completed_ = compose_cb(
-                std::move(on_completed_), std::move(data_sink));
+            // only the first HPX_CONTINUATION_MAX_INLINE_CALLBACKS
+            // continuations are run in the order they are attached, the
+            // remaining ones run on new threads and may execute ahead of
+            // the earlier ones
+            on_completed_.push_back(std::move(data_sink));
         }
     }
 
@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/combining_tree.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    namespace
+    {
+        std::size_t const npos = std::size_t(-1);
+
+        // The number of times a waiting thread checks the release flag
+        // before it is suspended (see util::detail::yield_k).
+        std::size_t const spin_budget = 32;
+    }
+
+    combining_tree::combining_tree(std::size_t num_participants,
+            std::size_t fan_in)
+      : num_participants_(num_participants), fan_in_(fan_in)
+    {
+        HPX_ASSERT(fan_in_ > 1);
+        if (num_participants_ == 0)
+            return;
+
+        // determine the number of nodes on each level of the tree, the
+        // leaves come first
+        std::vector<std::size_t> level_sizes;
+        std::size_t num_nodes = 0;
+        std::size_t children = num_participants_;
+        do
+        {
+            std::size_t const size = (children + fan_in_ - 1) / fan_in_;
+            level_sizes.push_back(size);
+            num_nodes += size;
+            children = size;
+        } while (children > 1);
+
+        nodes_.reset(new node[num_nodes]);
+
+        std::size_t offset = 0;
+        children = num_participants_;
+        for (std::size_t level = 0; level != level_sizes.size(); ++level)
+        {
+            std::size_t const size = level_sizes[level];
+            std::size_t const next_offset = offset + size;
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                node& n = nodes_[offset + i];
+
+                n.initial_ = (std::min)(fan_in_, children - i * fan_in_);
+                n.count_.store(n.initial_, std::memory_order_relaxed);
+                n.parent_ = (level + 1 == level_sizes.size()) ?
+                    npos : next_offset + i / fan_in_;
+            }
+
+            offset = next_offset;
+            children = size;
+        }
+    }
+
+    bool combining_tree::arrive(std::size_t participant, bool reset)
+    {
+        HPX_ASSERT(participant < num_participants_);
+
+        std::size_t index = participant / fan_in_;
+        for (;;)
+        {
+            node& n = nodes_[index];
+            if (n.count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return false;
+
+            // we are the last to arrive at this node, nobody else is able
+            // to access it before the tree has been released
+            if (reset)
+                n.count_.store(n.initial_, std::memory_order_relaxed);
+
+            if (n.parent_ == npos)
+                return true;
+
+            index = n.parent_;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    release_flag::release_flag()
+      : generation_(0), sleepers_(0)
+    {}
+
+    release_flag::~release_flag()
+    {
+        // make sure the thread calling release() has left
+        std::lock_guard<mutex_type> l(mtx_);
+        HPX_ASSERT(sleepers_ == 0);
+    }
+
+    void release_flag::wait(std::size_t generation, char const* description)
+    {
+        for (std::size_t k = 0; k != spin_budget; ++k)
+        {
+            if (generation_.load(std::memory_order_acquire) != generation)
+                return;
+
+            util::detail::yield_k(k, description);
+        }
+
+        // the spin budget is exhausted, suspend this thread
+        std::unique_lock<mutex_type> l(mtx_);
+
+        ++sleepers_;
+        while (generation_.load(std::memory_order_acquire) == generation)
+        {
+            cond_.wait(l, description);
+        }
+        --sleepers_;
+    }
+
+    void release_flag::release()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        generation_.fetch_add(1, std::memory_order_release);
+        if (sleepers_ != 0)
+            cond_.notify_all(std::move(l));
+    }
+}}}}
@@ -0,0 +1,206 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/lcos/local/detail/pipeline_registry.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/regex.hpp>
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    namespace
+    {
+        std::int64_t get_stage_counter_value(
+            std::weak_ptr<pipeline_stage_statistics> const& weak_stats,
+            pipeline_stage_registry::counter_kind kind, bool reset)
+        {
+            // the counter outlives the pipeline, report zero afterwards
+            std::shared_ptr<pipeline_stage_statistics> stats =
+                weak_stats.lock();
+            if (!stats)
+                return 0;
+
+            if (kind == pipeline_stage_registry::processed_items)
+                return util::get_and_reset_value(stats->processed_, reset);
+
+            return stats->queued_.load(std::memory_order_relaxed);
+        }
+    }
+
+    pipeline_stage_registry& pipeline_stage_registry::instance()
+    {
+        hpx::util::static_<pipeline_stage_registry, tag> registry;
+        return registry.get();
+    }
+
+    void pipeline_stage_registry::register_stage(std::string const& name,
+        statistics_ptr const& stats)
+    {
+        if (name.empty())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "pipeline_stage_registry::register_stage",
+                "Cannot register a pipeline stage with an empty name");
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+        map_[name] = stats;
+    }
+
+    void pipeline_stage_registry::unregister_stage(std::string const& name,
+        pipeline_stage_statistics const* stats)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // the name might have been taken over by another pipeline
+        map_type::iterator it = map_.find(name);
+        if (it != map_.end())
+        {
+            statistics_ptr current = (*it).second.lock();
+            if (!current || current.get() == stats)
+                map_.erase(it);
+        }
+    }
+
+    hpx::util::function_nonser<std::int64_t(bool)>
+        pipeline_stage_registry::get_counter(std::string const& name,
+            counter_kind kind) const
+    {
+        std::weak_ptr<pipeline_stage_statistics> stats;
+        bool found = false;
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            map_type::const_iterator it = map_.find(name);
+            if (it != map_.end())
+            {
+                stats = (*it).second;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "pipeline_stage_registry::get_counter",
+                "unknown pipeline stage: " + name);
+            return nullptr;
+        }
+
+        return [stats, kind](bool reset) -> std::int64_t
+            {
+                return get_stage_counter_value(stats, kind, reset);
+            };
+    }
+
+    bool pipeline_stage_registry::counter_discoverer(
+        performance_counters::counter_info const& info,
+        performance_counters::counter_path_elements& p,
+        performance_counters::discover_counter_func const& f,
+        performance_counters::discover_counters_mode mode, error_code& ec)
+    {
+        if (mode == performance_counters::discover_counters_minimal ||
+            p.parentinstancename_.empty() || p.instancename_.empty())
+        {
+            if (p.parentinstancename_.empty())
+            {
+                p.parentinstancename_ = "locality#*";
+                p.parentinstanceindex_ = -1;
+            }
+
+            if (p.instancename_.empty())
+            {
+                p.instancename_ = "total";
+                p.instanceindex_ = -1;
+            }
+        }
+
+        if (p.parameters_.empty())
+        {
+            if (mode == performance_counters::discover_counters_minimal)
+            {
+                std::string fullname;
+                performance_counters::get_counter_name(p, fullname, ec);
+                if (ec) return false;
+
+                performance_counters::counter_info cinfo = info;
+                cinfo.fullname_ = fullname;
+                return f(cinfo, ec) && !ec;
+            }
+
+            p.parameters_ = "*";
+        }
+
+        // collect the names of all matching stages, pipelines are created
+        // and destroyed dynamically, thus a pattern may not match anything
+        std::vector<std::string> names;
+        if (p.parameters_.find_first_of("*?[]") != std::string::npos)
+        {
+            std::string str_rx(util::regex_from_pattern(p.parameters_, ec));
+            if (ec) return false;
+
+            boost::regex rx(str_rx, boost::regex::perl);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            for (map_type::value_type const& v : map_)
+            {
+                if (boost::regex_match(v.first, rx))
+                    names.push_back(v.first);
+            }
+        }
+        else
+        {
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (map_.find(p.parameters_) != map_.end())
+                    names.push_back(p.parameters_);
+            }
+
+            if (names.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "pipeline_stage_registry::counter_discoverer",
+                    hpx::util::format(
+                        "pipeline stage %s does not match any known "
+                        "stage", p.parameters_));
+                return false;
+            }
+        }
+
+        for (std::string const& name : names)
+        {
+            // propagate parameters
+            std::string fullname;
+            performance_counters::counter_path_elements cp = p;
+            cp.parameters_ = name;
+
+            performance_counters::get_counter_name(cp, fullname, ec);
+            if (ec) return false;
+
+            performance_counters::counter_info cinfo = info;
+            cinfo.fullname_ = fullname;
+
+            if (!f(cinfo, ec) || ec)
+                return false;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+}}}}
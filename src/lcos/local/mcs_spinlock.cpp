@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/mcs_spinlock.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    namespace
+    {
+        // The maximal number of queue nodes kept by each thread. A thread
+        // needs one node for each mcs_spinlock it holds or waits for.
+        std::size_t const max_cached_nodes = 16;
+
+        template <typename Node>
+        struct node_cache
+        {
+            node_cache()
+              : head_(nullptr), size_(0)
+            {}
+
+            ~node_cache()
+            {
+                while (head_ != nullptr)
+                {
+                    Node* n = head_;
+                    head_ = n->cache_next_;
+                    delete n;
+                }
+            }
+
+            Node* head_;
+            std::size_t size_;
+        };
+
+        template <typename Node>
+        node_cache<Node>& get_node_cache()
+        {
+            static thread_local node_cache<Node> cache;
+            return cache;
+        }
+    }
+
+    mcs_spinlock::node* mcs_spinlock::acquire_node()
+    {
+        node_cache<node>& cache = get_node_cache<node>();
+
+        node* n = cache.head_;
+        if (n == nullptr)
+            return new node;
+
+        cache.head_ = n->cache_next_;
+        --cache.size_;
+        return n;
+    }
+
+    void mcs_spinlock::release_node(node* n) noexcept
+    {
+        node_cache<node>& cache = get_node_cache<node>();
+
+        if (cache.size_ == max_cached_nodes)
+        {
+            delete n;
+            return;
+        }
+
+        n->cache_next_ = cache.head_;
+        cache.head_ = n;
+        ++cache.size_;
+    }
+}}}
@@ -7,7 +7,9 @@
 #include <hpx/lcos/local/mutex.hpp>
 
 #include <hpx/error_code.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
+#include <hpx/lcos/local/promise.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
@@ -16,11 +18,19 @@
 #include <hpx/util/register_locks.hpp>
 #include <hpx/util/steady_clock.hpp>
 
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace local
 {
+    namespace
+    {
+        // marks a mutex which was acquired using async_lock()
+        threads::thread_id_repr_type const async_owner_id =
+            reinterpret_cast<threads::thread_id_repr_type>(std::intptr_t(-1));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id_repr)
@@ -82,25 +92,61 @@ namespace hpx { namespace lcos { namespace local
         return true;
     }
 
-    void mutex::unlock(error_code& ec)
+    future<void> mutex::async_lock()
     {
-        HPX_ASSERT(threads::get_self_ptr() != nullptr);
+        std::unique_lock<mutex_type> l(mtx_);
 
+        if (owner_id_ == threads::invalid_thread_id_repr)
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+            HPX_ITT_SYNC_ACQUIRED(this);
+            owner_id_ = async_owner_id;
+
+            l.unlock();
+            return make_ready_future();
+        }
+
+        // the mutex will be handed over to us by unlock()
+        return async_waiters_.push();
+    }
+
+    void mutex::unlock(error_code& ec)
+    {
         HPX_ITT_SYNC_RELEASING(this);
         std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_repr_type self_id = threads::get_self_id().get();
-        if (HPX_UNLIKELY(owner_id_ != self_id))
+        // a mutex acquired by async_lock() may be released by any thread
+        if (owner_id_ != async_owner_id)
         {
+            HPX_ASSERT(threads::get_self_ptr() != nullptr);
+
+            threads::thread_id_repr_type self_id = threads::get_self_id().get();
+            if (HPX_UNLIKELY(owner_id_ != self_id))
+            {
+                util::unregister_lock(this);
+                HPX_THROWS_IF(ec, lock_error,
+                    "mutex::unlock",
+                    "The calling thread does not own the mutex");
+                return;
+            }
+
             util::unregister_lock(this);
-            HPX_THROWS_IF(ec, lock_error,
-                "mutex::unlock",
-                "The calling thread does not own the mutex");
-            return;
         }
 
-        util::unregister_lock(this);
         HPX_ITT_SYNC_RELEASED(this);
+
+        if (!async_waiters_.empty())
+        {
+            // hand the mutex over to the next asynchronous waiter, its
+            // continuations have to run without holding the lock
+            owner_id_ = async_owner_id;
+            lcos::local::promise<void> p = async_waiters_.pop();
+
+            l.unlock();
+            p.set_value();
+            return;
+        }
+
         owner_id_ = threads::invalid_thread_id_repr;
 
         cond_.notify_one(std::move(l), threads::thread_priority_boost, ec);
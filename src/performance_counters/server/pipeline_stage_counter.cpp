@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/detail/pipeline_registry.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/util/function.hpp>
+
+#include <cstdint>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace performance_counters
+{
+    using hpx::lcos::local::detail::pipeline_stage_registry;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Discoverer function for pipeline stage counters
+    bool pipeline_stage_counter_discoverer(counter_info const& info,
+        discover_counter_func const& f, discover_counters_mode mode,
+        error_code& ec)
+    {
+        // compose the counter name templates
+        performance_counters::counter_path_elements p;
+        performance_counters::counter_status status =
+            get_counter_path_elements(info.fullname_, p, ec);
+        if (!status_is_valid(status)) return false;
+
+        bool result = pipeline_stage_registry::instance().counter_discoverer(
+            info, p, f, mode, ec);
+        if (!result || ec) return false;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation function for pipeline stage counters
+    naming::gid_type pipeline_stage_counter_creator(counter_info const& info,
+        pipeline_stage_registry::counter_kind kind, error_code& ec)
+    {
+        switch (info.type_) {
+        case counter_raw:
+            {
+                counter_path_elements paths;
+                get_counter_path_elements(info.fullname_, paths, ec);
+                if (ec) return naming::invalid_gid;
+
+                if (paths.parentinstance_is_basename_) {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "pipeline_stage_counter_creator",
+                        "invalid pipeline stage counter name (instance name "
+                        "must not be a valid base counter name)");
+                    return naming::invalid_gid;
+                }
+
+                if (paths.parameters_.empty()) {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "pipeline_stage_counter_creator",
+                        "invalid pipeline stage counter parameter: must "
+                        "specify a pipeline stage (<pipeline>/<stage>)");
+                    return naming::invalid_gid;
+                }
+
+                // ask registry
+                hpx::util::function_nonser<std::int64_t(bool)> f =
+                    pipeline_stage_registry::instance().get_counter(
+                        paths.parameters_, kind);
+
+                return detail::create_raw_counter(info, std::move(f), ec);
+            }
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "pipeline_stage_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
+    naming::gid_type pipeline_processed_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        return pipeline_stage_counter_creator(info,
+            pipeline_stage_registry::processed_items, ec);
+    }
+
+    naming::gid_type pipeline_queue_length_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        return pipeline_stage_counter_creator(info,
+            pipeline_stage_registry::queue_length, ec);
+    }
+}}
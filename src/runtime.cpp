@@ -26,11 +26,13 @@
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/backtrace.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/command_line_handling.hpp>
 #include <hpx/util/debugging.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/query_counters.hpp>
+#include <hpx/util/slab_allocator.hpp>
 #include <hpx/util/static_reinit.hpp>
 #include <hpx/util/thread_mapper.hpp>
 #include <hpx/version.hpp>
@@ -540,6 +542,28 @@ namespace hpx
               &performance_counters::remote_action_invocation_counter_creator,
               &performance_counters::remote_action_invocation_counter_discoverer,
               ""
+            },
+
+            // pipeline stage counters
+            { "/pipeline/count/processed", performance_counters::counter_raw,
+              "returns the number of items processed by a specific stage "
+              "of a local pipeline (the stage has to be specified as the "
+              "counter parameter: <pipeline-name>/<stage-name>)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              &performance_counters::pipeline_processed_counter_creator,
+              &performance_counters::pipeline_stage_counter_discoverer,
+              ""
+            },
+
+            { "/pipeline/queue/length", performance_counters::counter_raw,
+              "returns the number of items waiting to be processed by a "
+              "specific stage of a local pipeline (the stage has to be "
+              "specified as the counter parameter: "
+              "<pipeline-name>/<stage-name>)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              &performance_counters::pipeline_queue_length_counter_creator,
+              &performance_counters::pipeline_stage_counter_discoverer,
+              ""
             }
         };
         performance_counters::install_counter_types(
@@ -643,6 +667,51 @@ namespace hpx
         performance_counters::install_counter_types(
             arithmetic_counter_types,
             sizeof(arithmetic_counter_types)/sizeof(arithmetic_counter_types[0]));
+
+#if defined(HPX_HAVE_SHARED_STATE_SLAB_ALLOCATOR)
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        performance_counters::generic_counter_type_data const
+            slab_allocator_counter_types[] =
+        {
+            { "/runtime/count/slab-allocations",
+              performance_counters::counter_raw,
+              "returns the number of shared states which were allocated from "
+                  "the per-thread slabs on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &util::get_slab_allocations, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/runtime/count/slab-remote-deallocations",
+              performance_counters::counter_raw,
+              "returns the number of shared states which were released by a "
+                  "different OS thread than the one which allocated them on "
+                  "this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &util::get_slab_remote_deallocations, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/runtime/count/slab-heap-allocations",
+              performance_counters::counter_raw,
+              "returns the number of shared states which were too large to be "
+                  "allocated from the per-thread slabs on this locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, &util::get_slab_heap_allocations, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(
+            slab_allocator_counter_types,
+            sizeof(slab_allocator_counter_types) /
+                sizeof(slab_allocator_counter_types[0]));
+#endif
     }
 
     std::uint32_t runtime::assign_cores(std::string const& locality_basename,
@@ -1191,7 +1260,14 @@ namespace hpx { namespace threads
     std::ptrdiff_t get_stack_size(threads::thread_stacksize stacksize)
     {
         if (stacksize == threads::thread_stacksize_current)
-            return threads::get_self_stacksize();
+        {
+            // threads created by a stackless thread are not stackless
+            // themselves, they may have to suspend
+            std::size_t self_stacksize = threads::get_self_stacksize();
+            if (self_stacksize == std::size_t(HPX_NOSTACK_STACK_SIZE))
+                return get_default_stack_size();
+            return self_stacksize;
+        }
 
         return get_runtime().get_config().get_stack_size(stacksize);
     }
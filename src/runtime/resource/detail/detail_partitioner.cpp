@@ -156,6 +156,12 @@ namespace hpx { namespace resource { namespace detail
         case resource::throttle:
             sched = "throttle";
             break;
+        case resource::numa_stealing:
+            sched = "numa_stealing";
+            break;
+        case resource::deadline:
+            sched = "deadline";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -444,6 +450,14 @@ namespace hpx { namespace resource { namespace detail
         {
             default_scheduler = scheduling_policy::throttle;
         }
+        else if (0 == std::string("numa-stealing").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::numa_stealing;
+        }
+        else if (0 == std::string("deadline").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::deadline;
+        }
         else
         {
             throw hpx::detail::command_line_error(
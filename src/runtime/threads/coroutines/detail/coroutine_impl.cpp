@@ -73,58 +73,62 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     }
 #endif
 
-    void coroutine_impl::operator()()
+    coroutine_impl::context_exit_status coroutine_impl::execute(
+        std::exception_ptr& tinfo)
     {
-        typedef super_type::context_exit_status context_exit_status;
         context_exit_status status = super_type::ctx_exited_return;
-
-        // loop as long this coroutine has been rebound
-        do
+        try
         {
-            std::exception_ptr tinfo;
-            try
-            {
-                this->check_exit_state();
+            this->check_exit_state();
 
-                HPX_ASSERT(this->count() > 0);
+            HPX_ASSERT(this->count() > 0);
 
-                {
-                    coroutine_self* old_self = coroutine_self::get_self();
-                    coroutine_self self(this, old_self);
-                    reset_self_on_exit on_exit(&self, old_self);
-
-                    this->m_result_last = m_fun(*this->args());
+            {
+                coroutine_self* old_self = coroutine_self::get_self();
+                coroutine_self self(this, old_self);
+                reset_self_on_exit on_exit(&self, old_self);
 
-                    // if this thread returned 'terminated' we need to reset
-                    // the functor and the bound arguments
-                    if (this->m_result_last.first == terminated)
-                        this->reset();
-                }
+                this->m_result_last = m_fun(*this->args());
 
-                // return value to other side of the fence
-                this->bind_result(&this->m_result_last);
-            }
-            catch (exit_exception const&) {
-                status = super_type::ctx_exited_exit;
-                tinfo = std::current_exception();
-                this->reset();            // reset functor
-            }
-            catch (boost::exception const&) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = std::current_exception();
-                this->reset();
-            }
-            catch (std::exception const&) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = std::current_exception();
-                this->reset();
-            }
-            catch (...) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = std::current_exception();
-                this->reset();
+                // if this thread returned 'terminated' we need to reset
+                // the functor and the bound arguments
+                if (this->m_result_last.first == terminated)
+                    this->reset();
             }
 
+            // return value to other side of the fence
+            this->bind_result(&this->m_result_last);
+        }
+        catch (exit_exception const&) {
+            status = super_type::ctx_exited_exit;
+            tinfo = std::current_exception();
+            this->reset();            // reset functor
+        }
+        catch (boost::exception const&) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = std::current_exception();
+            this->reset();
+        }
+        catch (std::exception const&) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = std::current_exception();
+            this->reset();
+        }
+        catch (...) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = std::current_exception();
+            this->reset();
+        }
+        return status;
+    }
+
+    void coroutine_impl::operator()()
+    {
+        // loop as long this coroutine has been rebound
+        do
+        {
+            std::exception_ptr tinfo;
+            context_exit_status status = this->execute(tinfo);
             this->do_return(status, std::move(tinfo));
 
         } while (this->m_state == super_type::ctx_running);
@@ -133,6 +137,15 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
 
+    void coroutine_impl::invoke_stackless() noexcept
+    {
+        // the function is run to completion on the stack of the caller, there
+        // is no other context to switch back to
+        std::exception_ptr tinfo;
+        context_exit_status status = this->execute(tinfo);
+        this->do_return_stackless(status, std::move(tinfo));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the memory for the threads is managed by a lockfree caching_freelist
     struct coroutine_heap
@@ -174,6 +187,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     struct heap_tag_medium {};
     struct heap_tag_large {};
     struct heap_tag_huge {};
+    struct heap_tag_nostack {};
 
     template <std::size_t NumHeaps, typename Tag>
     static coroutine_heap& get_heap(std::size_t i)
@@ -185,6 +199,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
     static coroutine_heap& get_heap(std::size_t i, std::ptrdiff_t stacksize)
     {
+        // stackless coroutines must not be reused for stackful ones
+        if (stacksize == nostack_stack_size)
+            return get_heap<HPX_COROUTINE_NUM_HEAPS / 4,
+                heap_tag_nostack>(i % (HPX_COROUTINE_NUM_HEAPS / 4)); //-V112
+
         // FIXME: This should check the sizes in runtime_configuration, not the
         // default macro sizes
         if (stacksize > HPX_MEDIUM_STACK_SIZE)
@@ -207,6 +226,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
     static std::size_t get_heap_count(ptrdiff_t stacksize)
     {
+        if (stacksize == nostack_stack_size)
+            return HPX_COROUTINE_NUM_HEAPS / 4; //-V112
+
         if (stacksize > HPX_MEDIUM_STACK_SIZE)
             return HPX_COROUTINE_NUM_HEAPS / 4; //-V112
 
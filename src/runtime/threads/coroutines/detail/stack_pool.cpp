@@ -0,0 +1,336 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+namespace posix
+{
+    namespace
+    {
+        // Stacks are carved out of slabs of (roughly) this size, each slab
+        // holds at least one and at most max_stacks_per_slab stacks.
+        std::size_t const slab_size = 32 * 1024 * 1024;
+        std::size_t const max_stacks_per_slab = 256;
+
+        // The maximum number of unused stacks kept by each OS thread, half of
+        // them are returned to the global pool if this is exceeded.
+        std::size_t const max_local_stacks = 32;
+
+        // statistics, see get_stack_pool_size and get_stack_pool_hits
+        std::atomic<std::int64_t> pool_size(0);
+        std::atomic<std::int64_t> pool_hits(0);
+
+        ///////////////////////////////////////////////////////////////////////
+        // Give the physical memory of an unused stack back to the system
+        // while keeping its address range reserved.
+        void release_stack_memory(void* stack, std::size_t size)
+        {
+#if defined(MADV_FREE)
+            if (::madvise(stack, size, MADV_FREE) == 0)
+                return;
+#endif
+            ::madvise(stack, size, MADV_DONTNEED);
+        }
+
+        bool has_guard_page()
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            return use_guard_pages;
+#else
+            return false;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // All stacks of the same size (and with or without guard page) are
+        // managed by one pool. Slabs are never unmapped, unused stacks are
+        // kept for reuse instead.
+        class stack_pool
+        {
+            typedef hpx::util::spinlock mutex_type;
+
+        public:
+            stack_pool(std::size_t size, bool guard)
+              : size_(size), guard_(guard),
+                slot_size_(size + (guard ? EXEC_PAGESIZE : 0)),
+                next_(nullptr), end_(nullptr)
+            {}
+
+            std::size_t size() const { return size_; }
+            bool guard() const { return guard_; }
+
+            // Return a stack, additionally move some of the unused stacks
+            // into the given local cache.
+            void* allocate(std::vector<void*>& local)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                if (!free_.empty())
+                {
+                    std::size_t count =
+                        (std::min)(free_.size(), max_local_stacks / 2);
+                    local.insert(local.end(), free_.end() - count, free_.end());
+                    free_.resize(free_.size() - count);
+
+                    void* stack = local.back();
+                    local.pop_back();
+                    ++pool_hits;
+                    return stack;
+                }
+
+                if (next_ == end_)
+                    allocate_slab();
+                ++pool_size;
+
+                char* slot = next_;
+                next_ += slot_size_;
+
+                if (guard_)
+                {
+                    // Add a guard page. Note that this splits the mapping of
+                    // the slab.
+                    ::mprotect(slot, EXEC_PAGESIZE, PROT_NONE);
+                    return slot + EXEC_PAGESIZE;
+                }
+                return slot;
+            }
+
+            // Take over unused stacks from a local cache.
+            void deallocate(void* const* stacks, std::size_t count)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                free_.insert(free_.end(), stacks, stacks + count);
+            }
+
+        private:
+            void allocate_slab()
+            {
+                std::size_t num_stacks = (std::max)(std::size_t(1),
+                    (std::min)(slab_size / slot_size_, max_stacks_per_slab));
+
+                void* slab = ::mmap(nullptr, num_stacks * slot_size_,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (slab == MAP_FAILED)
+                {
+                    if (ENOMEM == errno)
+                        throw std::runtime_error("mmap() failed to allocate "
+                            "thread stack slab due to insufficient resources, "
+                            "increase /proc/sys/vm/max_map_count or add "
+                            "-Ihpx.stacks.use_guard_pages=0 to the command "
+                            "line");
+                    else
+                        throw std::runtime_error(
+                            "mmap() failed to allocate thread stack slab");
+                }
+
+                next_ = static_cast<char*>(slab);
+                end_ = next_ + num_stacks * slot_size_;
+            }
+
+            mutex_type mtx_;
+            std::size_t const size_;
+            bool const guard_;
+            std::size_t const slot_size_;
+
+            // unused part of the current slab
+            char* next_;
+            char* end_;
+
+            // stacks which have been returned to the pool
+            std::vector<void*> free_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The pools are never destroyed as stacks may be released by OS
+        // threads exiting after static destruction has started.
+        class stack_pools
+        {
+            typedef hpx::util::spinlock mutex_type;
+
+        public:
+            stack_pool& get(std::size_t size, bool guard)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                for (stack_pool* pool : pools_)
+                {
+                    if (pool->size() == size && pool->guard() == guard)
+                        return *pool;
+                }
+
+                pools_.push_back(new stack_pool(size, guard));
+                return *pools_.back();
+            }
+
+        private:
+            mutex_type mtx_;
+            std::vector<stack_pool*> pools_;
+        };
+
+        stack_pool& get_stack_pool(std::size_t size, bool guard)
+        {
+            static stack_pools* pools = new stack_pools;
+            return pools->get(size, guard);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Each OS thread keeps a small number of unused stacks of each size
+        // for reuse. Stacks may still be released by an OS thread after its
+        // cache has been destroyed (e.g. by the coroutine heaps which are
+        // cleaned up at process exit), these go directly to the global pools.
+        struct local_stacks
+        {
+            local_stacks(stack_pool& pool)
+              : pool_(&pool)
+            {}
+
+            stack_pool* pool_;
+            std::vector<void*> stacks_;
+        };
+
+        struct local_stack_cache
+        {
+            ~local_stack_cache()
+            {
+                for (local_stacks& l : caches_)
+                {
+                    if (!l.stacks_.empty())
+                        l.pool_->deallocate(l.stacks_.data(), l.stacks_.size());
+                }
+            }
+
+            local_stacks& get(std::size_t size, bool guard)
+            {
+                for (local_stacks& l : caches_)
+                {
+                    if (l.pool_->size() == size && l.pool_->guard() == guard)
+                        return l;
+                }
+
+                caches_.emplace_back(get_stack_pool(size, guard));
+                caches_.back().stacks_.reserve(max_local_stacks + 1);
+                return caches_.back();
+            }
+
+            std::vector<local_stacks> caches_;
+        };
+
+        // trivially destructible, hence still accessible while the
+        // thread_local objects of the OS thread are being destroyed
+        thread_local bool local_stack_cache_destroyed = false;
+
+        struct local_stack_cache_holder
+        {
+            ~local_stack_cache_holder()
+            {
+                local_stack_cache_destroyed = true;
+            }
+
+            local_stack_cache cache_;
+        };
+
+        // Returns nullptr if the cache of the calling OS thread has already
+        // been destroyed.
+        local_stacks* get_local_stacks(std::size_t size, bool guard)
+        {
+            if (local_stack_cache_destroyed)
+                return nullptr;
+
+            static thread_local local_stack_cache_holder holder;
+            return &holder.cache_.get(size, guard);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* alloc_pooled_stack(std::size_t size)
+    {
+        bool guard = has_guard_page();
+        local_stacks* local = get_local_stacks(size, guard);
+        if (local == nullptr)
+        {
+            std::vector<void*> stacks;
+            stack_pool& pool = get_stack_pool(size, guard);
+            void* stack = pool.allocate(stacks);
+            if (!stacks.empty())
+                pool.deallocate(stacks.data(), stacks.size());
+            return stack;
+        }
+
+        if (!local->stacks_.empty())
+        {
+            void* stack = local->stacks_.back();
+            local->stacks_.pop_back();
+            ++pool_hits;
+            return stack;
+        }
+
+        return local->pool_->allocate(local->stacks_);
+    }
+
+    void free_pooled_stack(void* stack, std::size_t size)
+    {
+        HPX_ASSERT(stack != nullptr);
+
+        release_stack_memory(stack, size);
+
+        bool guard = has_guard_page();
+        local_stacks* local = get_local_stacks(size, guard);
+        if (local == nullptr)
+        {
+            get_stack_pool(size, guard).deallocate(&stack, 1);
+            return;
+        }
+
+        local->stacks_.push_back(stack);
+
+        if (local->stacks_.size() > max_local_stacks)
+        {
+            std::size_t count = local->stacks_.size() / 2;
+            local->pool_->deallocate(
+                local->stacks_.data() + local->stacks_.size() - count, count);
+            local->stacks_.resize(local->stacks_.size() - count);
+        }
+    }
+
+    std::int64_t get_stack_pool_size(bool /*reset*/)
+    {
+        return pool_size.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t get_stack_pool_hits(bool reset)
+    {
+        if (reset)
+            return pool_hits.exchange(0, std::memory_order_relaxed);
+        return pool_hits.load(std::memory_order_relaxed);
+    }
+}
+}}}}
+
+#endif
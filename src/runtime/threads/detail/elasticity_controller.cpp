@@ -0,0 +1,290 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compat/condition_variable.hpp>
+#include <hpx/compat/mutex.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/threads/detail/elasticity_controller.hpp>
+#include <hpx/runtime/threads/detail/thread_pool_base.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/state.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/logging.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+#include <hpx/util/unlock_guard.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    elasticity_parameters::elasticity_parameters()
+      : interval_(util::safe_lexical_cast<std::int64_t>(
+            get_config_entry("hpx.elasticity.interval", 100))),
+        min_threads_(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.elasticity.min_threads", 1))),
+        grow_queue_length_(util::safe_lexical_cast<std::int64_t>(
+            get_config_entry("hpx.elasticity.grow_queue_length", 4))),
+        shrink_idle_rate_(util::safe_lexical_cast<std::int64_t>(
+            get_config_entry("hpx.elasticity.shrink_idle_rate", 5000))),
+        grow_intervals_(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.elasticity.grow_intervals", 1))),
+        shrink_intervals_(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.elasticity.shrink_intervals", 10)))
+    {
+        if (interval_ <= 0)
+            interval_ = 1;
+        if (min_threads_ == 0)
+            min_threads_ = 1;
+        if (grow_intervals_ == 0)
+            grow_intervals_ = 1;
+        if (shrink_intervals_ == 0)
+            shrink_intervals_ = 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    elasticity_controller::pool_data::pool_data(thread_pool_base* pool)
+      : pool_(pool), grow_count_(0), shrink_count_(0),
+        suspended_(pool->get_os_thread_count(), false)
+    {
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        std::size_t num_threads = pool->get_os_thread_count();
+        exec_times_.resize(num_threads);
+        tfunc_times_.resize(num_threads);
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+            pool->get_idle_rate_times(i, exec_times_[i], tfunc_times_[i]);
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    elasticity_controller::elasticity_controller(
+            std::vector<thread_pool_base*> const& pools,
+            elasticity_parameters const& params)
+      : params_(params), stopped_(true)
+    {
+        pools_.reserve(pools.size());
+        for (thread_pool_base* pool : pools)
+        {
+            HPX_ASSERT(
+                pool->get_scheduler_mode() & policies::enable_elasticity);
+            pools_.emplace_back(pool);
+        }
+    }
+
+    elasticity_controller::~elasticity_controller()
+    {
+        stop();
+    }
+
+    void elasticity_controller::start()
+    {
+        std::lock_guard<compat::mutex> l(mtx_);
+        if (!stopped_)
+            return;
+
+        stopped_ = false;
+        thread_ = compat::thread(&elasticity_controller::run, this);
+    }
+
+    void elasticity_controller::stop()
+    {
+        {
+            std::lock_guard<compat::mutex> l(mtx_);
+            if (stopped_)
+                return;
+
+            stopped_ = true;
+            cond_.notify_all();
+        }
+
+        thread_.join();
+
+        // give back all processing units we took away
+        for (pool_data& data : pools_)
+        {
+            for (std::size_t i = 0; i != data.suspended_.size(); ++i)
+            {
+                if (data.suspended_[i])
+                {
+                    error_code ec(lightweight);
+                    data.pool_->resume_processing_unit(i, ec);
+                    data.suspended_[i] = false;
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void elasticity_controller::run()
+    {
+        std::unique_lock<compat::mutex> l(mtx_);
+        while (!stopped_)
+        {
+            cond_.wait_for(l, std::chrono::milliseconds(params_.interval_));
+            if (stopped_)
+                break;
+
+            util::unlock_guard<std::unique_lock<compat::mutex> > ul(l);
+            for (pool_data& data : pools_)
+                sample(data);
+        }
+    }
+
+    void elasticity_controller::sample(pool_data& data)
+    {
+        thread_pool_base& pool = *data.pool_;
+        std::size_t const num_threads = data.suspended_.size();
+
+        // collect the processing units which are currently running and the
+        // overall amount of pending work (suspended processing units may
+        // still hold work in their queues)
+        std::vector<std::size_t> running;
+        running.reserve(num_threads);
+
+        std::size_t resumable = num_threads;
+        std::int64_t queue_length = 0;
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            queue_length += pool.get_queue_length(i, false);
+
+            hpx::state s = pool.get_state(i);
+            if (s == state_running)
+            {
+                running.push_back(i);
+            }
+            else if (s == state_sleeping && data.suspended_[i] &&
+                resumable == num_threads)
+            {
+                resumable = i;
+            }
+        }
+
+        // the pool is being stopped or the application has suspended all of
+        // its processing units
+        if (running.empty())
+            return;
+
+        std::int64_t idle_rate = get_idle_rate(data, running);
+        std::int64_t num_running = static_cast<std::int64_t>(running.size());
+
+        // resume the lowest numbered processing unit we have suspended if
+        // work is piling up
+        if (resumable != num_threads &&
+            queue_length > params_.grow_queue_length_ * num_running)
+        {
+            data.shrink_count_ = 0;
+            if (++data.grow_count_ < params_.grow_intervals_)
+                return;
+
+            data.grow_count_ = 0;
+
+            error_code ec(lightweight);
+            pool.resume_processing_unit(resumable, ec);
+            if (!ec)
+            {
+                data.suspended_[resumable] = false;
+                LTM_(info) << "elasticity_controller: resumed processing unit "
+                           << resumable << " of pool '"
+                           << pool.get_pool_name() << "'";
+            }
+            return;
+        }
+        data.grow_count_ = 0;
+
+        // suspend the highest numbered running processing unit if the pool
+        // stays idle
+        if (running.size() > params_.min_threads_ &&
+            idle_rate >= params_.shrink_idle_rate_ &&
+            queue_length < num_running)
+        {
+            if (++data.shrink_count_ < params_.shrink_intervals_)
+                return;
+
+            data.shrink_count_ = 0;
+
+            std::size_t virt_core = running.back();
+
+            // The processing unit may have been suspended (e.g. by the
+            // application) since its state was sampled. The pool checks the
+            // state again while holding its lock and reports an error in this
+            // case, the processing unit is skipped then.
+            error_code ec(lightweight);
+            pool.suspend_processing_unit(virt_core, ec);
+            if (!ec)
+            {
+                data.suspended_[virt_core] = true;
+                LTM_(info) << "elasticity_controller: suspended processing "
+                              "unit " << virt_core << " of pool '"
+                           << pool.get_pool_name() << "'";
+            }
+            return;
+        }
+        data.shrink_count_ = 0;
+    }
+
+    // Return the idle rate (in 0.01%) of the given processing units since the
+    // last sample.
+    std::int64_t elasticity_controller::get_idle_rate(pool_data& data,
+        std::vector<std::size_t> const& running)
+    {
+        thread_pool_base& pool = *data.pool_;
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        std::uint64_t exec_total = 0;
+        std::uint64_t tfunc_total = 0;
+
+        std::vector<std::size_t>::const_iterator it = running.begin();
+        for (std::size_t i = 0; i != data.suspended_.size(); ++i)
+        {
+            std::uint64_t exec_time = 0, tfunc_time = 0;
+            pool.get_idle_rate_times(i, exec_time, tfunc_time);
+
+            if (it != running.end() && *it == i)
+            {
+                exec_total += exec_time - data.exec_times_[i];
+                tfunc_total += tfunc_time - data.tfunc_times_[i];
+                ++it;
+            }
+
+            data.exec_times_[i] = exec_time;
+            data.tfunc_times_[i] = tfunc_time;
+        }
+
+        if (tfunc_total == 0)    // avoid division by zero
+            return 10000LL;
+
+        exec_total = (std::min)(exec_total, tfunc_total);
+
+        double const percent =
+            1. - (double(exec_total) / double(tfunc_total));
+        return std::int64_t(10000. * percent);    // 0.01 percent
+#else
+        // without idle rate support, estimate the idle rate from the number
+        // of processing units which are currently executing an HPX thread
+        std::int64_t busy = 0;
+        for (std::size_t i : running)
+        {
+            if (pool.get_thread_count(
+                    active, thread_priority_default, i, false) > 0)
+            {
+                ++busy;
+            }
+        }
+
+        std::int64_t num_running = static_cast<std::int64_t>(running.size());
+        return ((num_running - busy) * 10000LL) / num_running;
+#endif
+    }
+}}}
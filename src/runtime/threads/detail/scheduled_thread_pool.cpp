@@ -52,6 +52,18 @@ template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::periodic_priority_queue_scheduler<>>;
 #endif
 
+#if defined(HPX_HAVE_NUMA_STEALING_SCHEDULER)
+#include <hpx/runtime/threads/policies/numa_stealing_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::numa_stealing_queue_scheduler<>>;
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::deadline_queue_scheduler<>>;
+#endif
+
 #if defined(HPX_HAVE_THROTTLING_SCHEDULER)
 #include <hpx/runtime/threads/policies/throttling_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
@@ -192,6 +192,16 @@ namespace hpx { namespace threads
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
         }
+
+        for (std::size_t l = 0; l != max_cache_level; ++l)
+        {
+            cache_affinity_masks_[l].reserve(num_of_pus_);
+            for (std::size_t i = 0; i < num_of_pus_; ++i)
+            {
+                cache_affinity_masks_[l].push_back(
+                    init_cache_affinity_mask(i, l + 1));
+            }
+        }
     } // }}}
 
     void hwloc_topology_info::write_to_log() const
@@ -341,6 +351,42 @@ namespace hpx { namespace threads
         return empty_mask;
     }
 
+    mask_cref_type hwloc_topology_info::get_cache_affinity_mask(
+        std::size_t num_thread
+      , std::size_t cache_level
+      , error_code& ec
+        ) const
+    { // {{{
+        if (cache_level == 0 || cache_level > max_cache_level)
+        {
+            HPX_THROWS_IF(ec, bad_parameter
+              , "hpx::threads::hwloc_topology_info::get_cache_affinity_mask"
+              , hpx::util::format(
+                    "cache level %1% is not supported",
+                    cache_level));
+            return empty_mask;
+        }
+
+        std::vector<mask_type> const& masks =
+            cache_affinity_masks_[cache_level - 1];
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < masks.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return masks[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter
+          , "hpx::threads::hwloc_topology_info::get_cache_affinity_mask"
+          , hpx::util::format(
+                "thread number %1% is out of range",
+                num_thread));
+        return empty_mask;
+    } // }}}
+
     mask_cref_type hwloc_topology_info::get_thread_affinity_mask(
         std::size_t num_thread
       , error_code& ec
@@ -957,6 +1003,53 @@ namespace hpx { namespace threads
         return default_mask;
     } // }}}
 
+    mask_type hwloc_topology_info::init_cache_affinity_mask(
+        std::size_t num_thread
+      , std::size_t cache_level
+        ) const
+    { // {{{
+        // fall back to the core (L1, L2) or socket (L3) if the topology does
+        // not expose a cache at the requested level
+        mask_type default_mask = cache_level < 3 ?
+            core_affinity_masks_[num_thread] :
+            socket_affinity_masks_[num_thread];
+
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t cache_obj = nullptr;
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+
+            hwloc_obj_t obj = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU,
+                static_cast<unsigned>(num_pu));
+
+            for (/**/; obj != nullptr; obj = obj->parent)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                if (hwloc_obj_type_is_dcache(obj->type) &&
+#else
+                if (obj->type == HWLOC_OBJ_CACHE &&
+#endif
+                    obj->attr->cache.depth == cache_level)
+                {
+                    cache_obj = obj;
+                    break;
+                }
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        return default_mask;
+    } // }}}
+
     mask_type hwloc_topology_info::init_thread_affinity_mask(
         std::size_t num_thread
         ) const
@@ -476,6 +476,15 @@ namespace hpx { namespace this_thread
         threads::thread_self& self = threads::get_self();
         threads::thread_id_type id = threads::get_self_id();
 
+        // stackless threads can't be suspended
+        if (HPX_UNLIKELY(id->get_stack_size() == HPX_NOSTACK_STACK_SIZE))
+        {
+            HPX_THROWS_IF(ec, invalid_status, "suspend",
+                "a stackless HPX thread (thread_stacksize_nostack) can't be "
+                "suspended");
+            return threads::wait_unknown;
+        }
+
         // handle interruption, if needed
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
@@ -528,6 +537,15 @@ namespace hpx { namespace this_thread
         threads::thread_self& self = threads::get_self();
         threads::thread_id_type id = threads::get_self_id();
 
+        // stackless threads can't be suspended
+        if (HPX_UNLIKELY(id->get_stack_size() == HPX_NOSTACK_STACK_SIZE))
+        {
+            HPX_THROWS_IF(ec, invalid_status, "suspend_at",
+                "a stackless HPX thread (thread_stacksize_nostack) can't be "
+                "suspended");
+            return threads::wait_unknown;
+        }
+
         // handle interruption, if needed
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
@@ -640,4 +658,23 @@ namespace hpx { namespace this_thread
         return true;
 #endif
     }
+
+    bool can_fork_inline()
+    {
+        threads::thread_self* self = threads::get_self_ptr();
+        if (nullptr == self)
+            return false;
+
+        // stackless threads can't suspend, forked tasks always run inline
+        if (threads::get_ctx_ptr()->is_stackless())
+            return true;
+
+        // expose the parent's continuation if other worker threads are
+        // waiting for work, otherwise there is nobody who could steal it
+        threads::thread_id_type id = threads::get_self_id();
+        if (id->get_scheduler_base()->has_idle_threads())
+            return false;
+
+        return has_sufficient_stack_space();
+    }
 }}
@@ -15,10 +15,15 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
 #include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/detail/elasticity_controller.hpp>
 #include <hpx/runtime/threads/detail/scheduled_thread_pool.hpp>
 #include <hpx/runtime/threads/detail/set_thread_state.hpp>
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#endif
 #include <hpx/runtime/threads/executors/current_executor.hpp>
 #include <hpx/runtime/threads/policies/schedulers.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
@@ -34,6 +39,7 @@
 #include <hpx/util/itt_notify.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -305,7 +311,7 @@ namespace hpx { namespace threads
 
     namespace strings {
         char const* const stack_size_names[] = {
-            "small", "medium", "large", "huge",
+            "small", "medium", "large", "huge", "nostack",
         };
     }
 
@@ -323,6 +329,8 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (HPX_NOSTACK_STACK_SIZE == size)
+            return strings::stack_size_names[4];
 
         if (size < thread_stacksize_small || size > thread_stacksize_huge)
             return "custom";
@@ -330,6 +338,43 @@ namespace hpx { namespace threads
         return strings::stack_size_names[size - 1];
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Instantiates a pool using one of the schedulers which are configured
+        // by the number of high priority queues and the NUMA sensitivity only
+        // (numa-stealing and deadline).
+        template <typename Scheduler>
+        std::unique_ptr<thread_pool_base> create_priority_queue_pool(
+            util::command_line_handling const& cfg, std::size_t num_threads,
+            char const* description, policies::callback_notifier& notifier,
+            std::size_t index, std::string const& name,
+            std::size_t thread_offset)
+        {
+            // set parameters for scheduler and pool instantiation and
+            // perform compatibility checks
+            hpx::detail::ensure_hierarchy_arity_compatibility(cfg.vm_);
+            hpx::detail::ensure_hwloc_compatibility(cfg.vm_);
+            std::size_t num_high_priority_queues =
+                hpx::detail::get_num_high_priority_queues(cfg, num_threads);
+
+            // instantiate the scheduler
+            typename Scheduler::init_parameter_type init(num_threads,
+                num_high_priority_queues, 1000, cfg.numa_sensitive_,
+                description);
+            std::unique_ptr<Scheduler> sched(new Scheduler(init));
+
+            // instantiate the pool
+            return std::unique_ptr<thread_pool_base>(
+                new scheduled_thread_pool<Scheduler>(std::move(sched),
+                    notifier, index, name.c_str(),
+                    policies::scheduler_mode(policies::do_background_work |
+                        policies::reduce_thread_priority |
+                        policies::delay_exit),
+                    thread_offset));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     threadmanager::threadmanager(
 #ifdef HPX_HAVE_TIMER_POOL
@@ -710,6 +755,45 @@ namespace hpx { namespace threads
                 break;
             }
 
+            case resource::numa_stealing:
+            {
+#if defined(HPX_HAVE_NUMA_STEALING_SCHEDULER)
+                typedef hpx::threads::policies::
+                    numa_stealing_queue_scheduler<>
+                        local_sched_type;
+                pools_.push_back(detail::create_priority_queue_pool<
+                        local_sched_type
+                    >(cfg_, num_threads_in_pool,
+                        "core-numa_stealing_queue_scheduler", notifier_, i,
+                        name, thread_offset));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=numa-stealing "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=numa-stealing'.");
+#endif
+                break;
+            }
+
+            case resource::deadline:
+            {
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+                typedef hpx::threads::policies::deadline_queue_scheduler<>
+                    local_sched_type;
+                pools_.push_back(detail::create_priority_queue_pool<
+                        local_sched_type
+                    >(cfg_, num_threads_in_pool,
+                        "core-deadline_queue_scheduler", notifier_, i,
+                        name, thread_offset));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=deadline "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=deadline'.");
+#endif
+                break;
+            }
+
             case resource::throttle:
             {
 #if defined(HPX_HAVE_THROTTLING_SCHEDULER)
@@ -957,6 +1041,22 @@ namespace hpx { namespace threads
         pool->create_work(data, initial_state, ec);
     }
 
+    void threadmanager::register_work(std::vector<thread_init_data>& data,
+        thread_state_enum initial_state, error_code& ec)
+    {
+        detail::thread_pool_base *pool = nullptr;
+        if (get_self_ptr())
+        {
+            auto tid = get_self_id();
+            pool = tid->get_scheduler_base()->get_parent_pool();
+        }
+        else
+        {
+            pool = &default_pool();
+        }
+        pool->create_threads(data, initial_state, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_CONSTEXPR std::size_t all_threads = std::size_t(-1);
 
@@ -968,6 +1068,41 @@ namespace hpx { namespace threads
         return result;
     }
 
+    std::int64_t threadmanager::get_num_parks(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_parks(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_unparks(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_unparks(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_wakeup_latency(bool reset)
+    {
+        if (pools_.empty())
+            return 0;
+
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_average_wakeup_latency(all_threads, reset);
+        return result / static_cast<std::int64_t>(pools_.size());
+    }
+
+    std::int64_t threadmanager::get_num_missed_deadlines(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_missed_deadlines(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset)
     {
@@ -1040,6 +1175,22 @@ namespace hpx { namespace threads
         return result;
     }
 
+    std::int64_t threadmanager::get_num_thread_heap_hits(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_thread_heap_hits(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_thread_heap_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_thread_heap_misses(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     std::int64_t threadmanager::get_thread_duration(bool reset)
     {
@@ -1141,6 +1292,38 @@ namespace hpx { namespace threads
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_from_l2(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_l2(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_l3(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_l3(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_numa_node(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_numa_node(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_remote(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_remote(all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1477,6 +1660,16 @@ namespace hpx { namespace threads
                 util::bind_front(
                     &coroutine_type::impl_type::get_stack_unbind_count),
                 util::function_nonser<std::uint64_t(bool)>(), "", 0},
+#endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            // /threads{locality#%d/total}/count/stack-pool-size
+            {"count/stack-pool-size",
+                &coroutines::detail::posix::get_stack_pool_size,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                &coroutines::detail::posix::get_stack_pool_hits,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
 #endif
             // /threads{locality#%d/total}/count/objects
             // /threads{locality#%d/allocator%d}/count/objects
@@ -1593,6 +1786,28 @@ namespace hpx { namespace threads
                     &detail::thread_pool_base::get_executed_thread_phases),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/thread-heap-hits",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-thread objects which were "
+                "reused from the free lists of recycled threads for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_thread_heap_hits,
+                    &detail::thread_pool_base::get_num_thread_heap_hits),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/thread-heap-misses",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-thread objects which had to "
+                "be newly allocated because the free lists of recycled threads "
+                "were empty for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_thread_heap_misses,
+                    &detail::thread_pool_base::get_num_thread_heap_misses),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
             {"/threads/time/average", performance_counters::counter_raw,
                 "returns the average time spent executing one HPX-thread",
@@ -1729,6 +1944,20 @@ namespace hpx { namespace threads
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &performance_counters::locality_counter_discoverer, ""},
+#endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            {"/threads/count/stack-pool-size",
+                performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks carved out of "
+                "the pooled stack slabs of the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-hits",
+                performance_counters::counter_raw,
+                "returns the total number of HPX-thread stack allocations "
+                "served by a recycled stack for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
 #endif
             {"/threads/count/objects", performance_counters::counter_raw,
                 "returns the overall number of created HPX-thread objects for "
@@ -1801,7 +2030,96 @@ namespace hpx { namespace threads
                     &detail::thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/stolen-from-l2",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen by "
+                "the referenced worker-thread from a worker-thread sharing its "
+                "L2 cache (numa-stealing scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_l2,
+                    &detail::thread_pool_base::get_num_stolen_from_l2),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-l3",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen by "
+                "the referenced worker-thread from a worker-thread sharing its "
+                "L3 cache (but not its L2 cache) (numa-stealing scheduler "
+                "only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_l3,
+                    &detail::thread_pool_base::get_num_stolen_from_l3),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-numa-domain",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen by "
+                "the referenced worker-thread from a worker-thread in the same "
+                "NUMA domain (but not sharing its L3 cache) (numa-stealing "
+                "scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_numa_node,
+                    &detail::thread_pool_base::get_num_stolen_from_numa_node),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-remote",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen by "
+                "the referenced worker-thread from a worker-thread in a "
+                "different NUMA domain (numa-stealing scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_remote,
+                    &detail::thread_pool_base::get_num_stolen_from_remote),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
 #endif
+            // worker thread parking
+            {"/threads/count/parks",
+                performance_counters::counter_raw,
+                "returns the overall number of times the referenced "
+                "worker-thread(s) were parked because of being idle",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_parks,
+                    &detail::thread_pool_base::get_num_parks),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/unparks",
+                performance_counters::counter_raw,
+                "returns the overall number of times the referenced parked "
+                "worker-thread(s) were woken up because of new work",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_unparks,
+                    &detail::thread_pool_base::get_num_unparks),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/time/average-wakeup-latency",
+                performance_counters::counter_raw,
+                "returns the average time between waking up a parked "
+                "worker-thread and it resuming to look for work",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_average_wakeup_latency,
+                    &detail::thread_pool_base::get_average_wakeup_latency),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            // deadline scheduling
+            {"/threads/count/missed-deadlines",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads which were completed "
+                "by the referenced worker-thread(s) after their deadline had "
+                "expired (deadline scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_missed_deadlines,
+                    &detail::thread_pool_base::get_num_missed_deadlines),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
             // scheduler utilization
             {"/scheduler/utilization/instantaneous",
                 performance_counters::counter_raw,
@@ -1899,6 +2217,31 @@ namespace hpx { namespace threads
             if (sched) sched->set_all_states(state_running);
         }
 
+        // start watching the load of all pools which support suspending and
+        // resuming their processing units, if requested
+        if (util::safe_lexical_cast<int>(
+                get_config_entry("hpx.elasticity.enabled", "0")) != 0)
+        {
+            std::vector<detail::thread_pool_base*> elastic_pools;
+            for (auto& pool_iter : pools_)
+            {
+                if (pool_iter->get_scheduler_mode() &
+                    policies::enable_elasticity)
+                {
+                    elastic_pools.push_back(pool_iter.get());
+                }
+            }
+
+            if (!elastic_pools.empty())
+            {
+                LTM_(info) << "run: starting elasticity controller for "
+                           << elastic_pools.size() << " pool(s)";
+                elasticity_controller_.reset(new detail::elasticity_controller(
+                    elastic_pools, detail::elasticity_parameters()));
+                elasticity_controller_->start();
+            }
+        }
+
         LTM_(info) << "run: running";
         return true;
     }
@@ -1908,6 +2251,15 @@ namespace hpx { namespace threads
         LTM_(info) << "stop: blocking(" << std::boolalpha << blocking << ")";
 
         std::unique_lock<mutex_type> lk(mtx_);
+
+        // the elasticity controller resumes all processing units it has
+        // suspended, this has to happen before the pools are stopped
+        if (elasticity_controller_)
+        {
+            elasticity_controller_->stop();
+            elasticity_controller_.reset();
+        }
+
         for (auto& pool_iter : pools_)
         {
             pool_iter->stop(lk, blocking);
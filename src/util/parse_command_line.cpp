@@ -451,8 +451,9 @@ namespace hpx { namespace util
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
                   "'abp-priority', "
-                  "'hierarchy', 'static', 'static-priority', and "
-                  "'periodic-priority' (default: 'local-priority'; "
+                  "'hierarchy', 'static', 'static-priority', "
+                  "'periodic-priority', 'numa-stealing', and 'deadline' "
+                  "(default: 'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:hierarchy-arity", value<std::size_t>(),
                   "the arity of the of the thread queue tree, valid for "
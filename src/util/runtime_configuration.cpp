@@ -195,6 +195,8 @@ namespace hpx { namespace util
                 HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_IDLE_LOOP_COUNT_MAX)) "}",
             "max_busy_loop_count = ${HPX_MAX_BUSY_LOOP_COUNT:"
                 HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_BUSY_LOOP_COUNT_MAX)) "}",
+            "idle_mode = ${HPX_IDLE_MODE:spin}",
+            "max_park_duration = ${HPX_MAX_PARK_DURATION:1000}",
 
             /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
             /// then apply the test-failure value as default.
@@ -250,6 +252,16 @@ namespace hpx { namespace util
             "max_delete_count = ${HPX_THREAD_QUEUE_MAX_DELETE_COUNT:1000}",
             "max_terminated_threads = ${HPX_SCHEDULER_MAX_TERMINATED_THREADS:"
               HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_SCHEDULER_MAX_TERMINATED_THREADS)) "}",
+            "max_thread_heap_size = ${HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE:1000}",
+
+            "[hpx.elasticity]",
+            "enabled = ${HPX_ELASTICITY_ENABLED:0}",
+            "interval = ${HPX_ELASTICITY_INTERVAL:100}",
+            "min_threads = ${HPX_ELASTICITY_MIN_THREADS:1}",
+            "grow_queue_length = ${HPX_ELASTICITY_GROW_QUEUE_LENGTH:4}",
+            "shrink_idle_rate = ${HPX_ELASTICITY_SHRINK_IDLE_RATE:5000}",
+            "grow_intervals = ${HPX_ELASTICITY_GROW_INTERVALS:1}",
+            "shrink_intervals = ${HPX_ELASTICITY_SHRINK_INTERVALS:10}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -1041,6 +1053,9 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+            return HPX_NOSTACK_STACK_SIZE;
+
         default:
         case threads::thread_stacksize_small:
             break;
@@ -0,0 +1,331 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/slab_allocator.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace util
+{
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Blocks are handed out in multiples of the granularity, each block is
+        // prefixed by a header identifying the thread cache it belongs to.
+        std::size_t const granularity = 64;
+        std::size_t const num_size_classes = 16;     // up to 1024 bytes
+
+        // The number of bytes carved out of the global heap whenever a
+        // thread cache runs out of blocks of a given size.
+        std::size_t const slab_size = 16 * 1024;
+
+        struct thread_cache;
+
+        struct block_header
+        {
+            thread_cache* owner_;       // nullptr: allocated from global heap
+            std::size_t size_class_;
+        };
+
+        // keep the alignment guaranteed by the global operator new
+        std::size_t const header_size =
+            (sizeof(block_header) + alignof(std::max_align_t) - 1) &
+                ~(alignof(std::max_align_t) - 1);
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        inline void* to_user(block_header* h)
+        {
+            return reinterpret_cast<char*>(h) + header_size;
+        }
+
+        inline block_header* to_header(void* p)
+        {
+            return reinterpret_cast<block_header*>(
+                static_cast<char*>(p) - header_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct size_class_cache
+        {
+            size_class_cache()
+              : free_(nullptr), remote_free_(nullptr)
+            {}
+
+            free_block* free_;                      // used by owner only
+            std::atomic<free_block*> remote_free_;  // pushed by other threads
+        };
+
+        // Counters which are written by the owning thread only.
+        inline void increment(std::atomic<std::uint64_t>& counter)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+        }
+
+        struct thread_cache
+        {
+            thread_cache()
+              : allocations_(0), remote_deallocations_(0),
+                heap_allocations_(0)
+            {}
+
+            void* allocate(std::size_t size_class)
+            {
+                size_class_cache& c = classes_[size_class];
+
+                if (c.free_ == nullptr)
+                {
+                    // take over all blocks released by other threads
+                    c.free_ = c.remote_free_.exchange(
+                        nullptr, std::memory_order_acquire);
+
+                    if (c.free_ == nullptr)
+                        allocate_slab(c, size_class);
+                }
+
+                free_block* b = c.free_;
+                c.free_ = b->next_;
+
+                increment(allocations_);
+                return b;
+            }
+
+            void deallocate(block_header* h)
+            {
+                HPX_ASSERT(h->owner_ == this);
+
+                free_block* b = static_cast<free_block*>(to_user(h));
+                size_class_cache& c = classes_[h->size_class_];
+                b->next_ = c.free_;
+                c.free_ = b;
+            }
+
+            void deallocate_remote(block_header* h)
+            {
+                free_block* b = static_cast<free_block*>(to_user(h));
+                std::atomic<free_block*>& head =
+                    classes_[h->size_class_].remote_free_;
+
+                b->next_ = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(b->next_, b,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+
+                remote_deallocations_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void allocate_slab(size_class_cache& c, std::size_t size_class)
+            {
+                std::size_t block_size = (size_class + 1) * granularity;
+                std::size_t num_blocks = slab_size / block_size;
+
+                // slabs are never given back to the global heap
+                char* slab = static_cast<char*>(
+                    ::operator new(num_blocks * block_size));
+
+                for (std::size_t i = 0; i != num_blocks; ++i)
+                {
+                    block_header* h =
+                        reinterpret_cast<block_header*>(slab + i * block_size);
+                    h->owner_ = this;
+                    h->size_class_ = size_class;
+
+                    free_block* b = static_cast<free_block*>(to_user(h));
+                    b->next_ = c.free_;
+                    c.free_ = b;
+                }
+            }
+
+            size_class_cache classes_[num_size_classes];
+
+            std::atomic<std::uint64_t> allocations_;
+            std::atomic<std::uint64_t> remote_deallocations_;
+            std::atomic<std::uint64_t> heap_allocations_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Thread caches are never destroyed as blocks may still be released
+        // after the thread which allocated them has exited. Caches of exited
+        // threads are reused by new threads.
+        class thread_caches
+        {
+            typedef util::spinlock mutex_type;
+
+        public:
+            thread_cache* acquire()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (!abandoned_.empty())
+                {
+                    thread_cache* cache = abandoned_.back();
+                    abandoned_.pop_back();
+                    return cache;
+                }
+
+                all_.push_back(new thread_cache);
+                return all_.back();
+            }
+
+            void release(thread_cache* cache)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                abandoned_.push_back(cache);
+            }
+
+            template <typename F>
+            std::uint64_t accumulate(F && f)
+            {
+                std::uint64_t result = 0;
+
+                std::lock_guard<mutex_type> l(mtx_);
+                for (thread_cache* cache : all_)
+                    result += f(*cache);
+                return result;
+            }
+
+        private:
+            mutex_type mtx_;
+            std::vector<thread_cache*> all_;
+            std::vector<thread_cache*> abandoned_;
+        };
+
+        thread_caches& get_thread_caches()
+        {
+            static thread_caches* caches = new thread_caches;
+            return *caches;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The cache of the current thread is given back on thread exit. Any
+        // allocation after that point is served by the global heap.
+        thread_local thread_cache* local_cache = nullptr;
+        thread_local bool local_cache_released = false;
+
+        struct local_cache_releaser
+        {
+            ~local_cache_releaser()
+            {
+                if (local_cache != nullptr)
+                {
+                    get_thread_caches().release(local_cache);
+                    local_cache = nullptr;
+                }
+                local_cache_released = true;
+            }
+        };
+
+        thread_cache* get_local_cache()
+        {
+            if (HPX_LIKELY(local_cache != nullptr))
+                return local_cache;
+
+            if (local_cache_released)
+                return nullptr;
+
+            static thread_local local_cache_releaser releaser;
+            local_cache = get_thread_caches().acquire();
+            return local_cache;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::uint64_t allocations_reset = 0;
+        std::uint64_t remote_deallocations_reset = 0;
+        std::uint64_t heap_allocations_reset = 0;
+
+        std::int64_t get_statistics(
+            std::atomic<std::uint64_t> thread_cache::* counter,
+            std::uint64_t& reset_value, bool reset)
+        {
+            std::uint64_t value = get_thread_caches().accumulate(
+                [counter](thread_cache const& cache)
+                {
+                    return (cache.*counter).load(std::memory_order_relaxed);
+                });
+
+            std::uint64_t result = value - reset_value;
+            if (reset)
+                reset_value = value;
+            return static_cast<std::int64_t>(result);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* slab_allocate(std::size_t size)
+    {
+        std::size_t size_class = (size + header_size - 1) / granularity;
+
+        thread_cache* cache = get_local_cache();
+        if (size_class >= num_size_classes || cache == nullptr)
+        {
+            block_header* h = static_cast<block_header*>(
+                ::operator new(size + header_size));
+            h->owner_ = nullptr;
+            h->size_class_ = size_class;
+
+            if (cache != nullptr)
+                increment(cache->heap_allocations_);
+            return to_user(h);
+        }
+
+        block_header* h = to_header(cache->allocate(size_class));
+        HPX_ASSERT(h->owner_ == cache && h->size_class_ == size_class);
+        return to_user(h);
+    }
+
+    void slab_deallocate(void* p) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        block_header* h = to_header(p);
+        if (h->owner_ == nullptr)
+        {
+            ::operator delete(h);
+            return;
+        }
+
+        thread_cache* cache = local_cache;
+        if (h->owner_ == cache)
+        {
+            cache->deallocate(h);
+            return;
+        }
+
+        // hand the block back to the thread which allocated it
+        h->owner_->deallocate_remote(h);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_slab_allocations(bool reset)
+    {
+        return get_statistics(
+            &thread_cache::allocations_, allocations_reset, reset);
+    }
+
+    std::int64_t get_slab_remote_deallocations(bool reset)
+    {
+        return get_statistics(&thread_cache::remote_deallocations_,
+            remote_deallocations_reset, reset);
+    }
+
+    std::int64_t get_slab_heap_allocations(bool reset)
+    {
+        return get_statistics(
+            &thread_cache::heap_allocations_, heap_allocations_reset, reset);
+    }
+}}
@@ -5,6 +5,7 @@
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/parallel/executors/default_executor.hpp>
 
 #include "worker_timed.hpp"
 
@@ -19,12 +20,25 @@
 std::size_t num_level_tasks = 16;
 std::size_t spread = 2;
 std::uint64_t delay_ns = 0;
+bool nostack = false;
 
 void test_func()
 {
     worker_timed(delay_ns);
 }
 
+hpx::future<void> spawn_test_func()
+{
+    // the leaf tasks never suspend, they can run as stackless threads
+    if (nostack)
+    {
+        hpx::parallel::execution::default_executor exec(
+            hpx::threads::thread_stacksize_nostack);
+        return hpx::async(exec, &test_func);
+    }
+    return hpx::async(&test_func);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 hpx::future<void> spawn_level(std::size_t num_tasks)
 {
@@ -55,7 +69,7 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
 
     // then spawn required number of tasks on this level
     for (std::size_t i = 0; i != num_tasks; ++i)
-        tasks.push_back(hpx::async(&test_func));
+        tasks.push_back(spawn_test_func());
 
     return hpx::when_all(tasks);
 }
@@ -66,6 +80,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::size_t num_tasks = 128;
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
+    nostack = vm.count("nostack") != 0;
 
     double seqential_time_per_task = 0;
 
@@ -76,7 +91,7 @@ int hpx_main(boost::program_options::variables_map& vm)
         std::uint64_t start = hpx::util::high_resolution_clock::now();
 
         for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
+            tasks.push_back(spawn_test_func());
 
         hpx::wait_all(tasks);
 
@@ -129,6 +144,8 @@ int main(int argc, char* argv[])
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
          "time spent in the delay loop [ns]")
+        ("nostack",
+         "run the leaf tasks as stackless threads")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,147 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the average latency of a barrier synchronizing one HPX thread per
+// core, for an increasing number of cores.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/lcos/local/barrier.hpp>
+#include <hpx/lcos/local/tree_barrier.hpp>
+#include <hpx/parallel/executors/default_executor.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+// Adapt the different barrier types to a common interface
+void wait(hpx::lcos::local::barrier& b, std::size_t)
+{
+    b.wait();
+}
+
+void wait(hpx::lcos::local::tree_barrier& b, std::size_t participant)
+{
+    b.wait(participant);
+}
+
+template <typename Barrier>
+void participant(Barrier& b, std::size_t id, std::uint64_t iterations)
+{
+    for (std::uint64_t i = 0; i != iterations; ++i)
+        wait(b, id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// returns the average time per barrier in seconds
+template <typename Barrier>
+double measure(std::size_t num_threads, std::uint64_t iterations)
+{
+    Barrier b(num_threads);
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_threads);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    // schedule one participant on each of the cores
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::threads::executors::default_executor exec(i);
+        futures.push_back(hpx::async(exec, &participant<Barrier>,
+            std::ref(b), i, iterations));
+    }
+
+    hpx::wait_all(futures);
+
+    // stop the clock
+    return walltime.elapsed() / iterations;
+}
+
+void print_result(char const* name, std::size_t num_threads, double latency,
+    bool csv)
+{
+    if (csv)
+    {
+        hpx::util::format_to(cout, "%1%,%2%,%3%\n",
+            name, num_threads, latency * 1e6) << flush;
+    }
+    else
+    {
+        hpx::util::format_to(cout,
+            "%1%: %2% thread(s), %3% us per barrier\n",
+            name, num_threads, latency * 1e6) << flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+        bool const csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == iterations))
+            throw std::logic_error("error: count of 0 iterations specified\n");
+
+        // measure for 1, 2, 4, ... cores and for all cores
+        std::size_t const num_cores = hpx::get_os_thread_count();
+
+        std::vector<std::size_t> core_counts;
+        for (std::size_t n = 1; n < num_cores; n *= 2)
+            core_counts.push_back(n);
+        core_counts.push_back(num_cores);
+
+        for (std::size_t num_threads : core_counts)
+        {
+            print_result("barrier", num_threads,
+                measure<hpx::lcos::local::barrier>(num_threads, iterations),
+                csv);
+            print_result("tree_barrier", num_threads,
+                measure<hpx::lcos::local::tree_barrier>(
+                    num_threads, iterations),
+                csv);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "iterations"
+        , value<std::uint64_t>()->default_value(10000)
+        , "number of barrier synchronizations performed for each measurement")
+
+        ( "csv"
+        , "output results as csv (format: barrier,threads,latency[us])")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
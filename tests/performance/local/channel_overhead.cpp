@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the local channel implementations when a number
+// of producers and consumers concurrently push small items through a single
+// channel.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+// prevent the received values from being optimized away
+std::uint64_t global_scratch = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+double measure(Channel c, std::uint64_t count, std::size_t producers)
+{
+    std::vector<hpx::future<std::uint64_t> > consumers;
+    std::vector<hpx::future<void> > senders;
+
+    consumers.reserve(producers);
+    senders.reserve(producers);
+
+    std::uint64_t const per_thread = count / producers;
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (std::size_t i = 0; i != producers; ++i)
+    {
+        senders.push_back(hpx::async(
+            [c, per_thread]() mutable
+            {
+                for (std::uint64_t j = 0; j != per_thread; ++j)
+                    c.set(j);
+            }));
+
+        consumers.push_back(hpx::async(
+            [c, per_thread]() -> std::uint64_t
+            {
+                std::uint64_t sum = 0;
+                for (std::uint64_t j = 0; j != per_thread; ++j)
+                    sum += c.get(hpx::launch::sync);
+                return sum;
+            }));
+    }
+
+    hpx::wait_all(senders);
+    for (hpx::future<std::uint64_t>& f : consumers)
+        global_scratch += f.get();
+
+    // stop the clock
+    return walltime.elapsed();
+}
+
+void print_result(char const* name, std::uint64_t count,
+    std::size_t producers, double duration, bool csv)
+{
+    if (csv)
+    {
+        hpx::util::format_to(cout,
+            "%1%,%2%,%3%,%4%\n",
+            name, count, producers, duration) << flush;
+    }
+    else
+    {
+        hpx::util::format_to(cout,
+            "%1%: sent %2% items through a channel using %3% producer(s) "
+            "and consumer(s) in %4% seconds (%5% items/s)\n",
+            name, count, producers, duration, count / duration) << flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        std::uint64_t const count = vm["items"].as<std::uint64_t>();
+        std::size_t const producers = vm["producers"].as<std::size_t>();
+        std::size_t const capacity = vm["capacity"].as<std::size_t>();
+        bool const csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == count))
+            throw std::logic_error("error: count of 0 items specified\n");
+        if (HPX_UNLIKELY(0 == producers))
+            throw std::logic_error("error: count of 0 producers specified\n");
+
+        std::uint64_t const total = (count / producers) * producers;
+
+        print_result("channel", total, producers,
+            measure(hpx::lcos::local::channel<std::uint64_t>(),
+                count, producers), csv);
+
+        // one_element_channel supports only one waiting producer and consumer
+        if (producers == 1)
+        {
+            print_result("one_element_channel", total, producers,
+                measure(hpx::lcos::local::one_element_channel<std::uint64_t>(),
+                    count, producers), csv);
+        }
+
+        print_result("bounded_channel", total, producers,
+            measure(hpx::lcos::local::bounded_channel<std::uint64_t>(capacity),
+                count, producers), csv);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "items"
+        , value<std::uint64_t>()->default_value(1000000)
+        , "number of items to send through each channel")
+
+        ( "producers"
+        , value<std::size_t>()->default_value(4)
+        , "number of concurrent producers (and consumers)")
+
+        ( "capacity"
+        , value<std::size_t>()->default_value(1024)
+        , "capacity of the bounded channel")
+
+        ( "csv"
+        , "output results as csv (format: channel,count,producers,duration)")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
@@ -11,8 +11,10 @@
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/util/format.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/slab_allocator.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/iostreams.hpp>
+#include <hpx/parallel/executors/default_executor.hpp>
 
 #include <cstdint>
 #include <stdexcept>
@@ -91,17 +93,27 @@ void measure_action_futures(std::uint64_t count, bool csv)
             duration) << flush;
 }
 
-void measure_function_futures(std::uint64_t count, bool csv)
+void measure_function_futures(std::uint64_t count, bool csv, bool nostack)
 {
     std::vector<future<double> > futures;
 
     futures.reserve(count);
 
+    // null_function never suspends, it can optionally be run as a stackless
+    // thread
+    hpx::parallel::execution::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
     // start the clock
     high_resolution_timer walltime;
 
     for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async(&null_function));
+    {
+        if (nostack)
+            futures.push_back(async(exec, &null_function));
+        else
+            futures.push_back(async(&null_function));
+    }
 
     wait_each(scratcher(), futures);
 
@@ -120,6 +132,52 @@ void measure_function_futures(std::uint64_t count, bool csv)
             duration) << flush;
 }
 
+// measures the overhead of creating shared states only, no threads are created
+void measure_ready_futures(std::uint64_t count, bool csv)
+{
+    std::vector<future<double> > futures;
+
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        futures.push_back(hpx::make_ready_future(double(i)).then(
+            hpx::launch::sync,
+            [](future<double> f) { return f.get() + 1.; }));
+    }
+
+    wait_each(scratcher(), futures);
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+
+    if (csv)
+        hpx::util::format_to(cout,
+            "%1%,%2%\n",
+            count,
+            duration) << flush;
+    else
+        hpx::util::format_to(cout,
+            "invoked %1% futures (ready continuations) in %2% seconds\n",
+            count,
+            duration) << flush;
+}
+
+#if defined(HPX_HAVE_SHARED_STATE_SLAB_ALLOCATOR)
+void print_slab_statistics()
+{
+    hpx::util::format_to(cout,
+        "shared states allocated from slabs: %1%, released remotely: %2%, "
+        "allocated from heap: %3%\n",
+        hpx::util::get_slab_allocations(true),
+        hpx::util::get_slab_remote_deallocations(true),
+        hpx::util::get_slab_heap_allocations(true)) << flush;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(
     variables_map& vm
@@ -133,8 +191,23 @@ int hpx_main(
         if (HPX_UNLIKELY(0 == count))
             throw std::logic_error("error: count of 0 futures specified\n");
 
-        measure_action_futures(count, vm.count("csv") != 0);
-        measure_function_futures(count, vm.count("csv") != 0);
+        bool const csv = vm.count("csv") != 0;
+
+#if defined(HPX_HAVE_SHARED_STATE_SLAB_ALLOCATOR)
+        // reset the slab statistics
+        hpx::util::get_slab_allocations(true);
+        hpx::util::get_slab_remote_deallocations(true);
+        hpx::util::get_slab_heap_allocations(true);
+#endif
+
+        measure_action_futures(count, csv);
+        measure_function_futures(count, csv, vm.count("nostack") != 0);
+        measure_ready_futures(count, csv);
+
+#if defined(HPX_HAVE_SHARED_STATE_SLAB_ALLOCATOR)
+        if (!csv)
+            print_slab_statistics();
+#endif
     }
 
     finalize();
@@ -161,6 +234,9 @@ int main(
 
         ( "csv"
         , "output results as csv (format: count,duration)")
+
+        ( "nostack"
+        , "run the function futures as stackless threads")
         ;
 
     // Initialize and run HPX.
@@ -6,6 +6,7 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/iostreams.hpp>
+#include <hpx/include/parallel_executors.hpp>
 #include <hpx/util/format.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 
@@ -68,6 +69,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool do_child = vm.count("no-child") == 0;      // fork only
     bool do_parent = vm.count("no-parent") == 0;    // async only
+    bool do_executor = vm.count("no-executor") == 0; // fork_join_executor only
     std::size_t num_cores = hpx::get_os_thread_count();
     if (vm.count("num_cores") != 0)
         num_cores = vm["num_cores"].as<std::size_t>();
@@ -82,19 +84,27 @@ int hpx_main(boost::program_options::variables_map& vm)
     if (do_child)
         parent_stealing_time = measure(hpx::launch::fork);
 
+    // finally collect times for the work-first executor
+    double executor_time = 0;
+    if (do_executor)
+        executor_time =
+            measure(hpx::parallel::execution::fork_join_executor());
+
     if (print_header)
     {
         hpx::cout
-            << "num_cores,num_threads,child_stealing_time[s],parent_stealing_time[s]"
+            << "num_cores,num_threads,child_stealing_time[s],"
+               "parent_stealing_time[s],fork_join_executor_time[s]"
             << hpx::endl;
     }
 
     hpx::util::format_to(hpx::cout,
-        "%d,%d,%f,%f",
+        "%d,%d,%f,%f,%f",
         num_cores,
         iterations,
         child_stealing_time,
-        parent_stealing_time) << hpx::endl;
+        parent_stealing_time,
+        executor_time) << hpx::endl;
 
     return hpx::finalize();
 }
@@ -121,6 +131,7 @@ int main(int argc, char* argv[])
         ("no-header", "do not print out the csv header row")
         ("no-child", "do not test child-stealing (launch::fork only)")
         ("no-parent", "do not test child-stealing (launch::async only)")
+        ("no-executor", "do not test fork_join_executor")
         ;
 
     return hpx::init(cmdline, argc, argv);
@@ -0,0 +1,287 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/include/parallel_adjacent_difference.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/include/parallel_replace.hpp>
+#include <hpx/include/parallel_transform_reduce.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 100;
+int chunk_size = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy, typename Vector>
+std::uint64_t copy_vector(Policy && policy, Vector const& v1, Vector& v2)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::copy(std::forward<Policy>(policy),
+            std::begin(v1), std::end(v1), std::begin(v2));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t fill_n_vector(Policy && policy, Vector& v)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::fill_n(std::forward<Policy>(policy),
+            std::begin(v), v.size(), i);
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t equal_vector(Policy && policy, Vector const& v1,
+    Vector const& v2)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::equal(std::forward<Policy>(policy),
+            std::begin(v1), std::end(v1), std::begin(v2));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t mismatch_vector(Policy && policy, Vector const& v1,
+    Vector const& v2)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::mismatch(std::forward<Policy>(policy),
+            std::begin(v1), std::end(v1), std::begin(v2));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t adjacent_find_vector(Policy && policy, Vector const& v)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::adjacent_find(std::forward<Policy>(policy),
+            std::begin(v), std::end(v));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t adjacent_difference_vector(Policy && policy, Vector const& v1,
+    Vector& v2)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::adjacent_difference(std::forward<Policy>(policy),
+            std::begin(v1), std::end(v1), std::begin(v2));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t inner_product_vector(Policy && policy, Vector const& v1,
+    Vector const& v2)
+{
+    typedef typename Vector::value_type value_type;
+
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::transform_reduce(std::forward<Policy>(policy),
+            std::begin(v1), std::end(v1), std::begin(v2), value_type(0));
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Policy, typename Vector>
+std::uint64_t replace_vector(Policy && policy, Vector& v)
+{
+    std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::parallel::replace(std::forward<Policy>(policy),
+            std::begin(v), std::end(v), i, i + 1);
+    }
+
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy, typename Vector1, typename Vector2>
+void run_benchmarks(Policy && policy, std::string const& name,
+    Vector1 const& ref1, Vector1& ref2, Vector2 const& v1, Vector2& v2)
+{
+    hpx::cout
+        << name << " copy: "
+        << copy_vector(policy, v1, v2) /
+                double(copy_vector(policy, ref1, ref2))
+        << "\n"
+        << name << " fill_n: "
+        << fill_n_vector(policy, v2) / double(fill_n_vector(policy, ref2))
+        << "\n"
+        << name << " equal: "
+        << equal_vector(policy, v1, v2) /
+                double(equal_vector(policy, ref1, ref2))
+        << "\n"
+        << name << " mismatch: "
+        << mismatch_vector(policy, v1, v2) /
+                double(mismatch_vector(policy, ref1, ref2))
+        << "\n"
+        << name << " adjacent_find: "
+        << adjacent_find_vector(policy, v1) /
+                double(adjacent_find_vector(policy, ref1))
+        << "\n"
+        << name << " adjacent_difference: "
+        << adjacent_difference_vector(policy, v1, v2) /
+                double(adjacent_difference_vector(policy, ref1, ref2))
+        << "\n"
+        << name << " inner_product: "
+        << inner_product_vector(policy, v1, v2) /
+                double(inner_product_vector(policy, ref1, ref2))
+        << "\n"
+        << name << " replace: "
+        << replace_vector(policy, v2) / double(replace_vector(policy, ref2))
+        << "\n" << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    chunk_size = vm["chunk_size"].as<int>();
+
+    // verify that input is within domain of program
+    if (test_count == 0 || test_count < 0) {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else {
+        // create executor parameters object
+        hpx::parallel::execution::static_chunk_size cs(chunk_size);
+
+        // reference vectors, all timings are reported relative to these
+        std::vector<int> ref1(vector_size, 1);
+        std::vector<int> ref2(vector_size, 1);
+
+        {
+            hpx::partitioned_vector<int> v1(vector_size, 1);
+            hpx::partitioned_vector<int> v2(vector_size, 1);
+
+            run_benchmarks(hpx::parallel::execution::seq,
+                "hpx::partitioned_vector<int>(execution::seq)",
+                ref1, ref2, v1, v2);
+            run_benchmarks(hpx::parallel::execution::par.with(cs),
+                "hpx::partitioned_vector<int>(execution::par)",
+                ref1, ref2, v1, v2);
+        }
+
+        {
+            std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+            hpx::partitioned_vector<int> v1(vector_size, 1,
+                hpx::container_layout(localities));
+            hpx::partitioned_vector<int> v2(vector_size, 1,
+                hpx::container_layout(localities));
+
+            run_benchmarks(hpx::parallel::execution::seq,
+                "hpx::partitioned_vector<int>(execution::seq, "
+                    "container_layout(localities))",
+                ref1, ref2, v1, v2);
+            run_benchmarks(hpx::parallel::execution::par.with(cs),
+                "hpx::partitioned_vector<int>(execution::par, "
+                    "container_layout(localities))",
+                ref1, ref2, v1, v2);
+        }
+
+        {
+            hpx::partitioned_vector<int> v1(vector_size, 1,
+                hpx::container_layout(10));
+            hpx::partitioned_vector<int> v2(vector_size, 1,
+                hpx::container_layout(10));
+
+            run_benchmarks(hpx::parallel::execution::seq,
+                "hpx::partitioned_vector<int>(execution::seq, "
+                    "container_layout(10))",
+                ref1, ref2, v1, v2);
+            run_benchmarks(hpx::parallel::execution::par.with(cs),
+                "hpx::partitioned_vector<int>(execution::par, "
+                    "container_layout(10))",
+                ref1, ref2, v1, v2);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("vector_size"
+        , boost::program_options::value<std::size_t>()->default_value(100000)
+        , "size of vector (default: 100000)")
+
+        ("test_count"
+        , boost::program_options::value<int>()->default_value(100)
+        , "number of tests to be averaged (default: 100)")
+
+        ("chunk_size"
+        , boost::program_options::value<int>()->default_value(0)
+        , "number of iterations to combine while parallelization (default: 0)")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
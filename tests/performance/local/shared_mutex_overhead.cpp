@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of read-mostly workloads protected by different
+// lock implementations. A number of concurrent readers repeatedly acquire the
+// lock for reading, optionally every n-th operation acquires it for writing
+// instead.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+// the protected data, prevents the reads from being optimized away
+std::uint64_t shared_data = 0;
+std::uint64_t global_scratch = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Adapt the different lock types to a common interface
+template <typename Mutex>
+struct lock_traits
+{
+    static void lock_shared(Mutex& mtx) { mtx.lock_shared(); }
+    static void unlock_shared(Mutex& mtx) { mtx.unlock_shared(); }
+};
+
+template <>
+struct lock_traits<hpx::lcos::local::spinlock>
+{
+    static void lock_shared(hpx::lcos::local::spinlock& mtx) { mtx.lock(); }
+    static void unlock_shared(hpx::lcos::local::spinlock& mtx) { mtx.unlock(); }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Mutex>
+std::uint64_t reader(Mutex& mtx, std::uint64_t iterations,
+    std::uint64_t write_every)
+{
+    std::uint64_t sum = 0;
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        if (write_every != 0 && (i % write_every) == write_every - 1)
+        {
+            std::lock_guard<Mutex> l(mtx);
+            ++shared_data;
+        }
+        else
+        {
+            lock_traits<Mutex>::lock_shared(mtx);
+            sum += shared_data;
+            lock_traits<Mutex>::unlock_shared(mtx);
+        }
+    }
+    return sum;
+}
+
+template <typename Mutex>
+double measure(Mutex& mtx, std::size_t readers, std::uint64_t iterations,
+    std::uint64_t write_every)
+{
+    std::vector<hpx::future<std::uint64_t> > futures;
+    futures.reserve(readers);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (std::size_t i = 0; i != readers; ++i)
+    {
+        futures.push_back(hpx::async(&reader<Mutex>, std::ref(mtx),
+            iterations, write_every));
+    }
+
+    for (hpx::future<std::uint64_t>& f : futures)
+        global_scratch += f.get();
+
+    // stop the clock
+    return walltime.elapsed();
+}
+
+void print_result(char const* name, std::size_t readers,
+    std::uint64_t iterations, double duration, bool csv)
+{
+    std::uint64_t const total = readers * iterations;
+    if (csv)
+    {
+        hpx::util::format_to(cout,
+            "%1%,%2%,%3%,%4%\n",
+            name, readers, total, duration) << flush;
+    }
+    else
+    {
+        hpx::util::format_to(cout,
+            "%1%: %2% reader(s) performed %3% operations in %4% seconds "
+            "(%5% operations/s)\n",
+            name, readers, total, duration, total / duration) << flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+        std::uint64_t const write_every = vm["write-every"].as<std::uint64_t>();
+        std::size_t const max_readers = vm["max-readers"].as<std::size_t>();
+        bool const csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == iterations))
+            throw std::logic_error("error: count of 0 iterations specified\n");
+
+        for (std::size_t readers = 1; readers <= max_readers; readers *= 2)
+        {
+            {
+                hpx::lcos::local::shared_mutex mtx;
+                print_result("shared_mutex", readers, iterations,
+                    measure(mtx, readers, iterations, write_every), csv);
+            }
+            {
+                hpx::lcos::local::scalable_shared_mutex mtx;
+                print_result("scalable_shared_mutex", readers, iterations,
+                    measure(mtx, readers, iterations, write_every), csv);
+            }
+            {
+                hpx::lcos::local::scalable_shared_mutex mtx(true);
+                print_result("scalable_shared_mutex (writer preference)",
+                    readers, iterations,
+                    measure(mtx, readers, iterations, write_every), csv);
+            }
+            {
+                hpx::lcos::local::spinlock mtx;
+                print_result("spinlock", readers, iterations,
+                    measure(mtx, readers, iterations, write_every), csv);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "iterations"
+        , value<std::uint64_t>()->default_value(100000)
+        , "number of lock operations performed by each reader")
+
+        ( "write-every"
+        , value<std::uint64_t>()->default_value(0)
+        , "acquire the lock for writing every n-th operation (default: 0, "
+          "never write)")
+
+        ( "max-readers"
+        , value<std::size_t>()->default_value(64)
+        , "maximal number of concurrent readers, the measurements are "
+          "performed for 1, 2, 4, ... readers")
+
+        ( "csv"
+        , "output results as csv (format: lock,readers,operations,duration)")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #include <hpx/runtime.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/lcos/local/mcs_spinlock.hpp>
 #include <hpx/lcos/wait_each.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
@@ -186,14 +187,16 @@ namespace test
 }
 
 test::local_spinlock mtx[N];
+hpx::lcos::local::mcs_spinlock mcs_mtx[N];
 
 ///////////////////////////////////////////////////////////////////////////////
-double null_function(std::size_t i)
+template <typename Mutex>
+double null_function_impl(Mutex* mtxs, std::size_t i)
 {
     double d = 0.;
     std::size_t idx = i % N;
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mtxs[idx]);
         d = global_init[idx];
     }
     for (double j = 0; j < num_iterations; ++j)
@@ -201,13 +204,45 @@ double null_function(std::size_t i)
         d += 1 / (2. * j + 1);
     }
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mtxs[idx]);
         global_init[idx] = d;
     }
     return d;
 }
 
+double null_function(std::size_t i)
+{
+    return null_function_impl(mtx, i);
+}
+
+double mcs_null_function(std::size_t i)
+{
+    return null_function_impl(mcs_mtx, i);
+}
+
 HPX_PLAIN_ACTION(null_function, null_action)
+HPX_PLAIN_ACTION(mcs_null_function, mcs_null_action)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action>
+double measure(id_type const& here, std::uint64_t count)
+{
+    std::vector<future<double> > futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(async<Action>(here, i));
+
+    wait_each(hpx::util::unwrapping(
+        [] (double r) { global_scratch += r; }),
+        futures);
+
+    // stop the clock
+    return walltime.elapsed();
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(
@@ -228,50 +263,30 @@ int hpx_main(
         if (HPX_UNLIKELY(0 == count))
             throw std::logic_error("error: count of 0 futures specified\n");
 
-        std::vector<future<double> > futures;
-
-        futures.reserve(count);
-
-        // start the clock
+        // compare the test-and-set spinlock with the queued (MCS) spinlock
+        char const* const names[] = { "spinlock", "mcs_spinlock" };
+        double const durations[] =
+        {
+            measure<null_action>(here, count),
+            measure<mcs_null_action>(here, count)
+        };
 
-        /*
-        k1 = 1;
-        k2 = 2;
-        for(; k1 < 256; k1 = k1 * 2)*/
+        for (std::size_t i = 0; i != 2; ++i)
         {
-            //for(; k2 < 2056; k2 = k2 * 2)
-            {
-                high_resolution_timer walltime;
-                for (std::uint64_t i = 0; i < count; ++i)
-                    futures.push_back(async<null_action>(here, i));
-
-                wait_each(hpx::util::unwrapping(
-                    [] (double r) { global_scratch += r; }),
-                    futures);
-
-                // stop the clock
-                const double duration = walltime.elapsed();
-
-                if (vm.count("csv"))
-                    hpx::util::format_to(cout,
-                        "%3%,%4%,%5%,%2%\n",
-                        count,
-                        duration,
-                        k1,
-                        k2,
-                        k3
-                    ) << flush;
-                else
-                    hpx::util::format_to(cout,
-                        "invoked %1% futures in %2% seconds "
-                        "(k1 = %3%, k2 = %4%, k3 = %5%)\n",
-                        count,
-                        duration,
-                        k1,
-                        k2,
-                        k3
-                    ) << flush;
-            }
+            char const* name = names[i];
+            double duration = durations[i];
+
+            if (vm.count("csv"))
+                hpx::util::format_to(cout,
+                    "%1%,%4%,%5%,%6%,%3%\n",
+                    name, count, duration, k1, k2, k3
+                ) << flush;
+            else
+                hpx::util::format_to(cout,
+                    "%1%: invoked %2% futures in %3% seconds "
+                    "(k1 = %4%, k2 = %5%, k3 = %6%)\n",
+                    name, count, duration, k1, k2, k3
+                ) << flush;
         }
     }
 
@@ -310,7 +325,7 @@ int main(
         , "")
 
         ( "csv"
-        , "output results as csv (format: count,duration)")
+        , "output results as csv (format: lock,k1,k2,k3,duration)")
         ;
 
     // Initialize and run HPX.
@@ -37,8 +37,17 @@ create_tasks(std::size_t num_tasks, std::size_t delay)
     return tasks;
 }
 
+// join on all given tasks either using wait_all or when_all
+void join_tasks(std::vector<hpx::future<void> >& tasks, bool use_when_all)
+{
+    if (use_when_all)
+        tasks = hpx::when_all(tasks).get();
+    else
+        hpx::wait_all(tasks);
+}
+
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, bool use_when_all)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks = num_tasks - (num_chunks - 1) * num_chunk_tasks;
@@ -62,15 +71,17 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         hpx::util::high_resolution_timer t;
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            join_tasks(chunks[0], use_when_all);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
                 chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); })
-                );
+                    hpx::async([&chunks, c, use_when_all]()
+                    {
+                        join_tasks(chunks[c], use_when_all);
+                    }));
             }
             hpx::wait_all(chunk_results);
         }
@@ -88,6 +99,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::size_t num_chunks = 1;
     std::size_t delay = 0;
     bool header = true;
+    bool use_when_all = vm.count("when-all") != 0;
 
     if (vm.count("no-header"))
         header = false;
@@ -104,12 +116,14 @@ int hpx_main(boost::program_options::variables_map& vm)
         num_chunks = 1;
 
     // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
+    double elapsed_seq =
+        wait_tasks(num_samples, num_tasks, 1, delay, use_when_all);
 
     // wait of tasks in chunks
     double elapsed_chunks = 0;
     if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
+        elapsed_chunks = wait_tasks(
+            num_samples, num_tasks, num_chunks, delay, use_when_all);
 
     if (header)
     {
@@ -154,6 +168,8 @@ int main(int argc, char* argv[])
          "number of iterations in the delay loop")
         ("no-header,n", po::value<bool>()->default_value(true),
          "do not print out the csv header row")
+        ("when-all,w",
+         "join on the tasks using when_all instead of wait_all")
         ;
 
     // Initialize and run HPX.
@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct random_fill
+{
+    random_fill(std::size_t random_range)
+        : gen(std::rand()),
+        dist(0, random_range - 1)
+    {}
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename OrgIter, typename RandIter>
+double run_partial_sort_benchmark_std(int test_count,
+    OrgIter org_first, OrgIter org_last, RandIter first, RandIter last,
+    RandIter middle)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore [first, last) with original data.
+        hpx::parallel::copy(hpx::parallel::execution::par,
+            org_first, org_last, first);
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        std::partial_sort(first, middle, last);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename OrgIter, typename RandIter>
+double run_partial_sort_benchmark_hpx(int test_count, ExPolicy policy,
+    OrgIter org_first, OrgIter org_last, RandIter first, RandIter last,
+    RandIter middle)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore [first, last) with original data.
+        hpx::parallel::copy(hpx::parallel::execution::par,
+            org_first, org_last, first);
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        hpx::parallel::partial_sort(policy, first, middle, last);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_benchmark(std::size_t vector_size, double ratio, int test_count,
+    std::size_t random_range)
+{
+    std::cout << "* Preparing Benchmark..." << std::endl;
+
+    std::vector<int> c(vector_size);
+    std::vector<int> org_c(vector_size);
+
+    auto first = std::begin(c);
+    auto last = std::end(c);
+    auto middle = first + std::size_t(vector_size * ratio);
+
+    // initialize data
+    using namespace hpx::parallel;
+    generate(execution::par, std::begin(org_c), std::end(org_c),
+        random_fill(random_range));
+
+    auto org_first = std::begin(org_c);
+    auto org_last = std::end(org_c);
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    std::cout << "--- run_partial_sort_benchmark_std ---" << std::endl;
+    double time_std =
+        run_partial_sort_benchmark_std(test_count,
+            org_first, org_last, first, last, middle);
+
+    std::cout << "--- run_partial_sort_benchmark_seq ---" << std::endl;
+    double time_seq =
+        run_partial_sort_benchmark_hpx(test_count, execution::seq,
+            org_first, org_last, first, last, middle);
+
+    std::cout << "--- run_partial_sort_benchmark_par ---" << std::endl;
+    double time_par =
+        run_partial_sort_benchmark_hpx(test_count, execution::par,
+            org_first, org_last, first, last, middle);
+
+    std::cout << "--- run_partial_sort_benchmark_par_unseq ---" << std::endl;
+    double time_par_unseq =
+        run_partial_sort_benchmark_hpx(test_count, execution::par_unseq,
+            org_first, org_last, first, last, middle);
+
+    std::cout << "\n-------------- Benchmark Result --------------" << std::endl;
+    auto fmt = "partial_sort (%1%) : %2%(sec)";
+    hpx::util::format_to(std::cout, fmt, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "seq", time_seq) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par", time_par) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par_unseq", time_par_unseq) << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::srand(seed);
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    double ratio = vm["ratio"].as<double>();
+    std::size_t random_range = vm["random_range"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    if (random_range < 1)
+        random_range = 1;
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed              : " << seed << std::endl;
+    std::cout << "vector_size       : " << vector_size << std::endl;
+    std::cout << "ratio             : " << ratio << std::endl;
+    std::cout << "random_range      : " << random_range << std::endl;
+    std::cout << "test_count        : " << test_count << std::endl;
+    std::cout << "os threads        : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n" << std::endl;
+
+    run_benchmark(vector_size, ratio, test_count, random_range);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("vector_size",
+            boost::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("ratio",
+            boost::program_options::value<double>()->default_value(0.1),
+            "ratio of the number of sorted elements (default: 0.1)")
+        ("random_range",
+            boost::program_options::value<std::size_t>()->default_value(1000000),
+            "range of random numbers [0, x) (default: 1000000)")
+        ("test_count",
+            boost::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", boost::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -5,6 +5,7 @@
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/apply.hpp>
+#include <hpx/include/async.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
@@ -325,6 +326,143 @@ void closed_channel_set1()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void pingpong2()
+{
+    hpx::lcos::local::bounded_channel<std::string> pings(4);
+    hpx::lcos::local::bounded_channel<std::string> pongs(4);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        ping(pings, "passed message");
+        pong(pings, pongs);
+
+        std::string result = pongs.get(hpx::launch::sync);
+        HPX_TEST_EQ(std::string("passed message"), result);
+    }
+}
+
+void bounded_channel_range()
+{
+    std::atomic<int> received_elements(0);
+
+    hpx::lcos::local::bounded_channel<> queue(4);
+    queue.set();
+    queue.set();
+    queue.set();
+    queue.close();
+
+    for (auto const& elem : queue)
+    {
+        (void)elem;
+        ++received_elements;
+    }
+
+    HPX_TEST_EQ(received_elements.load(), 3);
+}
+
+void bounded_channel_backpressure()
+{
+    hpx::lcos::local::bounded_channel<int> c(2);
+
+    c.set(1);
+    c.set(2);
+
+    // the channel is full, the next value is accepted once a value was read
+    hpx::future<void> f = c.set(hpx::launch::async, 3);
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 1);
+    f.get();
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 2);
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 3);
+}
+
+void bounded_channel_mpmc()
+{
+    int const num_producers = 4;
+    int const num_values = 10000;
+
+    hpx::lcos::local::bounded_channel<int> c(16);
+    std::atomic<long> sum(0);
+
+    std::vector<hpx::future<void> > producers;
+    std::vector<hpx::future<void> > consumers;
+    for (int p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async(
+            [c]() mutable
+            {
+                for (int i = 1; i <= num_values; ++i)
+                    c.set(i);
+            }));
+        consumers.push_back(hpx::async(
+            [c, &sum]()
+            {
+                for (int i = 0; i != num_values; ++i)
+                    sum += c.get(hpx::launch::sync);
+            }));
+    }
+
+    hpx::wait_all(producers);
+    hpx::wait_all(consumers);
+
+    long expected = long(num_producers) * num_values * (num_values + 1) / 2;
+    HPX_TEST_EQ(sum.load(), expected);
+}
+
+void deadlock_test2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void)value;
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_get2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        c.set(42);
+        c.close();
+
+        HPX_TEST_EQ(c.get(hpx::launch::sync), 42);
+
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void)value;
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_set2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        c.close();
+
+        c.set(42);
+        HPX_TEST(false);
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -346,5 +484,13 @@ int main(int argc, char* argv[])
     closed_channel_get1();
     closed_channel_set1();
 
+    pingpong2();
+    bounded_channel_range();
+    bounded_channel_backpressure();
+    bounded_channel_mpmc();
+    deadlock_test2();
+    closed_channel_get2();
+    closed_channel_set2();
+
     return hpx::util::report_errors();
 }
@@ -38,6 +38,27 @@ int hpx_main()
 
     HPX_TEST_EQ(count, 10);
 
+    // Wait asynchronously for all threads to finish executing.
+    for (std::size_t i = 0; i != 10; ++i)
+        hpx::apply(&worker, std::ref(sem));
+
+    hpx::future<void> f = sem.async_acquire(10);
+    f.get();
+
+    HPX_TEST_EQ(count, 20);
+
+    // Asynchronous waiters are served in FIFO order.
+    hpx::future<void> f1 = sem.async_acquire(2);
+    hpx::future<void> f2 = sem.async_acquire(1);
+
+    sem.signal(1);
+    HPX_TEST(!f1.is_ready());
+    HPX_TEST(!f2.is_ready());
+
+    sem.signal(2);
+    HPX_TEST(f1.is_ready());
+    HPX_TEST(f2.is_ready());
+
     return hpx::finalize();
 }
 
@@ -7,6 +7,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
 #include <hpx/lcos/local/condition_variable.hpp>
 #include <hpx/lcos/local/mutex.hpp>
 #include <hpx/runtime/threads/thread.hpp>
@@ -276,10 +277,59 @@ struct test_recursive_lock
     }
 };
 
+template <typename M>
+struct test_async_lock
+{
+    typedef M mutex_type;
+
+    void operator()()
+    {
+        mutex_type mutex;
+
+        // The mutex is available, the future is ready right away.
+        hpx::future<void> f1 = mutex.async_lock();
+        HPX_TEST(f1.is_ready());
+        f1.get();
+        HPX_TEST(!mutex.try_lock());
+
+        // The mutex is handed over to the asynchronous waiters in FIFO order.
+        hpx::future<void> f2 = mutex.async_lock();
+        hpx::future<void> f3 = mutex.async_lock();
+        HPX_TEST(!f2.is_ready());
+        HPX_TEST(!f3.is_ready());
+
+        mutex.unlock();
+        HPX_TEST(f2.is_ready());
+        HPX_TEST(!f3.is_ready());
+
+        // A mutex acquired asynchronously may be released from any thread.
+        hpx::async([&mutex]() { mutex.unlock(); }).get();
+        HPX_TEST(f3.is_ready());
+
+        // Threads blocked in lock() are woken up once the last asynchronous
+        // owner has released the mutex.
+        hpx::future<void> f4 = hpx::async(
+            [&mutex]()
+            {
+                std::unique_lock<mutex_type> l(mutex);
+            });
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        HPX_TEST(!f4.is_ready());
+
+        mutex.unlock();
+        f4.get();
+
+        HPX_TEST(mutex.try_lock());
+        mutex.unlock();
+    }
+};
+
 void test_mutex()
 {
     test_lock<hpx::lcos::local::mutex>()();
     test_trylock<hpx::lcos::local::mutex>()();
+    test_async_lock<hpx::lcos::local::mutex>()();
 }
 
 void test_timed_mutex()
@@ -287,6 +337,7 @@ void test_timed_mutex()
     test_lock<hpx::lcos::local::timed_mutex>()();
     test_trylock<hpx::lcos::local::timed_mutex>()();
     test_timedlock<hpx::lcos::local::timed_mutex>()();
+    test_async_lock<hpx::lcos::local::timed_mutex>()();
 }
 
 //void test_recursive_mutex()
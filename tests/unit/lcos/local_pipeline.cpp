@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::lcos::local::make_pipeline;
+using hpx::lcos::local::pipeline_mode;
+
+#define NUM_ITEMS std::size_t(1000)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ordered(std::size_t batch_size, std::size_t capacity)
+{
+    std::vector<std::string> results;
+
+    auto p = make_pipeline<std::size_t>(std::string(), batch_size, capacity)
+        .stage(pipeline_mode::unordered, 4,
+            [](std::size_t i) { return i * i; })
+        .stage(pipeline_mode::ordered, 4,
+            [](std::size_t i) { return std::to_string(i); })
+        .sink([&](std::string && s) { results.push_back(std::move(s)); });
+
+    for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+        p.push(i);
+    p.wait();
+
+    HPX_TEST_EQ(results.size(), NUM_ITEMS);
+    for (std::size_t i = 0; i != results.size(); ++i)
+        HPX_TEST_EQ(results[i], std::to_string(i * i));
+}
+
+void test_unordered()
+{
+    std::atomic<std::size_t> sum(0);
+    std::atomic<std::size_t> count(0);
+
+    auto p = make_pipeline<std::size_t>(hpx::parallel::execution::par,
+            std::string(), 7, 2)
+        .stage(pipeline_mode::unordered, 3,
+            [](std::size_t i) { return 2 * i; })
+        .sink(pipeline_mode::unordered, 3,
+            [&](std::size_t i) { sum += i; ++count; });
+
+    for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+        p.push(i);
+    p.wait();
+
+    HPX_TEST_EQ(count.load(), NUM_ITEMS);
+    HPX_TEST_EQ(sum.load(), NUM_ITEMS * (NUM_ITEMS - 1));
+}
+
+void test_concurrent_producers()
+{
+    std::atomic<std::size_t> count(0);
+
+    auto p = make_pipeline<std::size_t>(std::string(), 4, 1)
+        .sink(pipeline_mode::ordered, 2, [&](std::size_t) { ++count; });
+
+    std::vector<hpx::future<void> > producers;
+    for (std::size_t j = 0; j != 4; ++j)
+    {
+        producers.push_back(hpx::async(
+            [&p]()
+            {
+                for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+                    p.push(i);
+            }));
+    }
+    hpx::wait_all(producers);
+    p.wait();
+
+    HPX_TEST_EQ(count.load(), 4 * NUM_ITEMS);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::atomic<std::size_t> count(0);
+
+    auto p = make_pipeline<std::size_t>()
+        .stage(pipeline_mode::ordered, 2,
+            [](std::size_t i) -> std::size_t
+            {
+                if (i == 42)
+                    throw std::runtime_error("test");
+                return i;
+            })
+        .sink([&](std::size_t) { ++count; });
+
+    for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+        p.push(i);
+    p.close();
+
+    bool caught_exception = false;
+    try {
+        p.get_future().get();
+    }
+    catch (std::runtime_error const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // only the failing item was dropped
+    HPX_TEST_EQ(count.load(), NUM_ITEMS - 1);
+
+    caught_exception = false;
+    try {
+        p.push(0);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool wait_for_count(std::atomic<std::size_t> const& count, std::size_t value)
+{
+    // don't wait longer than 10s
+    hpx::util::high_resolution_timer t;
+    while (count.load() != value && t.elapsed() < 10.0)
+        hpx::this_thread::yield();
+    return count.load() == value;
+}
+
+void test_partial_batch()
+{
+    std::atomic<std::size_t> count(0);
+
+    auto p = make_pipeline<std::size_t>(std::string(), 16)
+        .stage(pipeline_mode::ordered, 2,
+            [](std::size_t i) { return i + 1; })
+        .sink([&](std::size_t) { ++count; });
+
+    // the partial batch is processed without closing the pipeline
+    for (std::size_t i = 0; i != 5; ++i)
+        p.push(i);
+    HPX_TEST(wait_for_count(count, 5));
+
+    for (std::size_t i = 0; i != 3; ++i)
+        p.push(i);
+    p.flush();
+    HPX_TEST(wait_for_count(count, 8));
+
+    p.wait();
+    HPX_TEST_EQ(count.load(), std::size_t(8));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/pipeline{locality#0/total}/" + name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_counters()
+{
+    std::atomic<std::size_t> count(0);
+
+    auto p = make_pipeline<std::size_t>("test_pipeline", 10)
+        .stage("double", pipeline_mode::unordered, 2,
+            [](std::size_t i) { return 2 * i; })
+        .sink([&](std::size_t) { ++count; });
+
+    for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+        p.push(i);
+
+    // the stages are alive as long as the pipeline has not been drained
+    while (count.load() != NUM_ITEMS)
+        hpx::this_thread::yield();
+
+    HPX_TEST_EQ(query_counter("count/processed@test_pipeline/double"),
+        std::int64_t(NUM_ITEMS));
+    HPX_TEST_EQ(query_counter("queue/length@test_pipeline/double"),
+        std::int64_t(0));
+
+    p.wait();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_ordered(1, 1);
+    test_ordered(16, 4);
+    test_ordered(NUM_ITEMS + 1, 16);
+    test_unordered();
+    test_concurrent_producers();
+    test_exception();
+    test_partial_batch();
+    test_counters();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#define NUM_THREADS std::size_t(37)
+#define NUM_ITERATIONS std::size_t(100)
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> num_arrived(0);
+
+void test_barrier_wait(hpx::lcos::local::tree_barrier& b,
+    std::size_t participant)
+{
+    for (std::size_t i = 0; i != NUM_ITERATIONS; ++i)
+    {
+        ++num_arrived;
+
+        b.wait(participant);
+
+        // all threads have arrived in this round, none has started the
+        // next round yet
+        HPX_TEST_EQ(num_arrived.load(), (i + 1) * NUM_THREADS);
+
+        b.wait(participant);
+    }
+}
+
+void test_latch_count_down(hpx::lcos::local::tree_latch& l,
+    std::size_t participant)
+{
+    ++num_arrived;
+    l.count_down_and_wait(participant);
+
+    HPX_TEST_EQ(num_arrived.load(), NUM_THREADS);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // tree_barrier
+    {
+        for (std::size_t fan_in : { 2, 4, 64 })
+        {
+            num_arrived.store(0);
+
+            hpx::lcos::local::tree_barrier b(NUM_THREADS, fan_in);
+
+            std::vector<hpx::future<void> > results;
+            for (std::size_t i = 0; i != NUM_THREADS; ++i)
+            {
+                results.push_back(
+                    hpx::async(&test_barrier_wait, std::ref(b), i));
+            }
+
+            hpx::wait_all(results);
+
+            HPX_TEST_EQ(num_arrived.load(), NUM_THREADS * NUM_ITERATIONS);
+        }
+    }
+
+    // tree_latch
+    {
+        num_arrived.store(0);
+
+        hpx::lcos::local::tree_latch l(NUM_THREADS + 1);
+        HPX_TEST(!l.is_ready());
+
+        std::vector<hpx::future<void> > results;
+        for (std::size_t i = 0; i != NUM_THREADS; ++i)
+        {
+            results.push_back(
+                hpx::async(&test_latch_count_down, std::ref(l), i));
+        }
+
+        HPX_TEST(!l.is_ready());
+
+        // wait for all threads to reach this point
+        while (num_arrived.load() != NUM_THREADS)
+            hpx::this_thread::yield();
+
+        HPX_TEST(!l.is_ready());
+        l.count_down(NUM_THREADS);
+
+        l.wait();
+        hpx::wait_all(results);
+
+        HPX_TEST(l.is_ready());
+    }
+
+    // an empty tree_latch is ready right away
+    {
+        hpx::lcos::local::tree_latch l(0);
+        HPX_TEST(l.is_ready());
+        l.wait();
+    }
+
+    HPX_TEST_EQ(hpx::finalize(), 0);
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
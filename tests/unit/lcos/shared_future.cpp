@@ -12,6 +12,7 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -521,6 +522,34 @@ void test_wait_callback_with_timed_wait()
     HPX_TEST_EQ(callback_called, 1U);
 }
 
+void test_wait_callback_fan_out()
+{
+    // attach more continuations than are run directly, the remaining ones
+    // are handed to the scheduler at once
+    std::size_t const num_callbacks = 4 * HPX_CONTINUATION_MAX_INLINE_CALLBACKS;
+
+    callback_called = 0;
+    hpx::lcos::local::promise<int> pi;
+    hpx::lcos::shared_future<int> fi = pi.get_future();
+
+    std::vector<hpx::future<void> > cbfs;
+    cbfs.reserve(num_callbacks);
+    for (std::size_t i = 0; i != num_callbacks; ++i)
+        cbfs.push_back(fi.then(&wait_callback));
+
+    hpx::thread t(&promise_set_value, std::ref(pi));
+
+    hpx::wait_all(cbfs);
+    t.join();
+
+    HPX_TEST_EQ(callback_called, unsigned(num_callbacks));
+    HPX_TEST_EQ(fi.get(), 42);
+
+    // continuations attached to a ready future are run right away
+    hpx::future<void> cbf = fi.then(&wait_callback);
+    cbf.wait();
+    HPX_TEST_EQ(callback_called, unsigned(num_callbacks + 1));
+}
 
 void test_packaged_task_can_be_moved()
 {
@@ -1568,6 +1597,7 @@ int hpx_main(variables_map&)
         test_shared_future_for_string();
         test_wait_callback();
         test_wait_callback_with_timed_wait();
+        test_wait_callback_fan_out();
         test_packaged_task_can_be_moved();
         test_destroying_a_promise_stores_broken_promise();
         test_destroying_a_packaged_task_stores_broken_task();
@@ -0,0 +1,149 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/local/scalable_shared_mutex.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+typedef hpx::lcos::local::scalable_shared_mutex shared_mutex_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// multiple readers are allowed to hold the lock concurrently
+void test_multiple_readers(bool writer_preference)
+{
+    shared_mutex_type mtx(writer_preference);
+
+    mtx.lock_shared();
+    HPX_TEST(!mtx.try_lock());
+
+    hpx::future<bool> f = hpx::async(
+        [&mtx]()
+        {
+            if (!mtx.try_lock_shared())
+                return false;
+            mtx.unlock_shared();
+            return true;
+        });
+    HPX_TEST(f.get());
+
+    mtx.unlock_shared();
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock_shared());
+    mtx.unlock();
+
+    HPX_TEST(mtx.try_lock_shared());
+    mtx.unlock_shared();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writers exclude readers and other writers
+void test_writer_exclusion(bool writer_preference)
+{
+    std::size_t const num_tasks = 16;
+    std::size_t const num_iterations = 1000;
+
+    shared_mutex_type mtx(writer_preference);
+    std::atomic<std::size_t> readers(0);
+    std::atomic<std::size_t> writers(0);
+    std::atomic<bool> failed(false);
+    std::size_t value = 0;
+
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async(
+            [&, t]()
+            {
+                for (std::size_t i = 0; i != num_iterations; ++i)
+                {
+                    if ((i + t) % 8 == 0)
+                    {
+                        std::lock_guard<shared_mutex_type> l(mtx);
+                        if (++writers != 1 || readers != 0)
+                            failed = true;
+                        ++value;
+                        --writers;
+                    }
+                    else
+                    {
+                        mtx.lock_shared();
+                        ++readers;
+                        if (writers != 0)
+                            failed = true;
+                        --readers;
+                        mtx.unlock_shared();
+                    }
+                }
+            }));
+    }
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST(!failed);
+    HPX_TEST_EQ(value, num_tasks * num_iterations / 8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a writer waiting for the lock blocks new readers if writer preference is
+// requested
+void test_writer_preference()
+{
+    shared_mutex_type mtx(true);
+
+    mtx.lock_shared();
+
+    std::atomic<bool> writer_done(false);
+    hpx::future<void> writer = hpx::async(
+        [&]()
+        {
+            std::lock_guard<shared_mutex_type> l(mtx);
+            writer_done = true;
+        });
+
+    // wait for the writer to announce itself
+    while (mtx.try_lock_shared())
+    {
+        mtx.unlock_shared();
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    HPX_TEST(!writer_done);
+    mtx.unlock_shared();
+
+    writer.get();
+    HPX_TEST(writer_done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_multiple_readers(false);
+    test_multiple_readers(true);
+
+    test_writer_exclusion(false);
+    test_writer_exclusion(true);
+
+    test_writer_preference();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
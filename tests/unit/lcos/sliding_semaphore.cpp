@@ -37,6 +37,20 @@ int hpx_main()
 
     HPX_TEST(count == 10);
 
+    // Wait asynchronously for the lower limit to be advanced.
+    hpx::lcos::local::sliding_semaphore sem2(2);
+
+    hpx::future<void> f1 = sem2.async_acquire(5);
+    hpx::future<void> f2 = sem2.async_acquire(2);
+    HPX_TEST(!f1.is_ready());
+    HPX_TEST(f2.is_ready());
+
+    sem2.signal(2);
+    HPX_TEST(!f1.is_ready());
+
+    sem2.signal(3);
+    HPX_TEST(f1.is_ready());
+
     return hpx::finalize();
 }
 
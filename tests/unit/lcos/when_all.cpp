@@ -11,6 +11,7 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -270,12 +271,58 @@ void test_wait_for_all_deferred_futures()
     HPX_TEST(hpx::util::get<1>(result).is_ready());
 }
 
+using hpx::lcos::future;
+
+void test_wait_for_all_wide_range()
+{
+    // the futures become ready concurrently while continuations are attached
+    std::size_t const count = 10000;
+
+    std::vector<hpx::lcos::local::promise<int> > promises(count);
+    std::vector<future<int> > futures;
+    futures.reserve(count);
+    for (auto& p : promises)
+        futures.push_back(p.get_future());
+
+    hpx::future<void> setter = hpx::async(
+        [&promises]()
+        {
+            int i = 0;
+            for (auto& p : promises)
+                p.set_value(i++);
+        });
+
+    future<std::vector<future<int> > > r = hpx::when_all(futures);
+    std::vector<future<int> > result = r.get();
+
+    setter.get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(result[i].is_ready());
+        HPX_TEST_EQ(result[i].get(), int(i));
+    }
+}
+
+void test_wait_for_all_deferred_range()
+{
+    std::vector<future<int> > futures;
+    futures.push_back(hpx::async(hpx::launch::deferred, &make_int_slowly));
+    futures.push_back(hpx::async(hpx::launch::deferred, &make_int_slowly));
+
+    future<std::vector<future<int> > > r = hpx::when_all(futures);
+    std::vector<future<int> > result = r.get();
+
+    HPX_TEST_EQ(result.size(), std::size_t(2));
+    for (auto& f : result)
+        HPX_TEST_EQ(f.get(), 42);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using boost::program_options::variables_map;
 using boost::program_options::options_description;
 
-using hpx::lcos::future;
-
 int hpx_main(variables_map&)
 {
     {
@@ -292,6 +339,8 @@ int hpx_main(variables_map&)
         test_wait_for_all_five_futures();
         test_wait_for_all_late_futures();
         test_wait_for_all_deferred_futures();
+        test_wait_for_all_wide_range();
+        test_wait_for_all_deferred_range();
     }
 
     hpx::finalize();
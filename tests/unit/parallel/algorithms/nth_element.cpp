@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+std::vector<int> make_data(std::size_t size, int range)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<> dist(0, range);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dist(gen); });
+    return c;
+}
+
+template <typename Compare>
+void verify_nth_element(std::vector<int> const& c, std::vector<int> const& d,
+    std::size_t n, Compare comp)
+{
+    HPX_TEST_EQ(c[n], d[n]);
+    for (std::size_t i = 0; i != n; ++i)
+        HPX_TEST(!comp(c[n], c[i]));
+    for (std::size_t i = n + 1; i < c.size(); ++i)
+        HPX_TEST(!comp(c[i], c[n]));
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_nth_element(ExPolicy policy, std::size_t size, int range)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> d = make_data(size, range);
+    std::vector<int> org = d;
+    std::sort(std::begin(d), std::end(d));
+
+    for (std::size_t n : { std::size_t(0), size / 3, size / 2, size - 1 })
+    {
+        std::vector<int> c = org;
+        auto result = hpx::parallel::nth_element(policy,
+            std::begin(c), std::begin(c) + n, std::end(c));
+
+        HPX_TEST(result == std::end(c));
+        verify_nth_element(c, d, n, std::less<int>());
+    }
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy policy, std::size_t size, int range)
+{
+    std::vector<int> c = make_data(size, range);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d), std::greater<int>());
+
+    std::size_t n = size / 3;
+    auto f = hpx::parallel::nth_element(policy,
+        std::begin(c), std::begin(c) + n, std::end(c), std::greater<int>());
+
+    HPX_TEST(f.get() == std::end(c));
+    verify_nth_element(c, d, n, std::greater<int>());
+}
+
+template <typename ExPolicy>
+void test_nth_element_exception(ExPolicy policy)
+{
+    std::vector<int> c = make_data(300007, 100000);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::nth_element(policy, std::begin(c),
+            std::begin(c) + 1000, std::end(c), throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<
+                ExPolicy, std::random_access_iterator_tag
+            >::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_nth_element_exception_async(ExPolicy policy)
+{
+    std::vector<int> c = make_data(300007, 100000);
+
+    bool caught_exception = false;
+    bool returned_from_algorithm = false;
+    try {
+        auto f = hpx::parallel::nth_element(policy, std::begin(c),
+            std::begin(c) + 1000, std::end(c), throw_always());
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+}
+
+////////////////////////////////////////////////////////////////////////////
+void nth_element_test()
+{
+    using namespace hpx::parallel;
+
+    // many distinct values and many duplicates
+    for (int range : { 100000000, 10 })
+    {
+        test_nth_element(execution::seq, 300007, range);
+        test_nth_element(execution::par, 300007, range);
+        test_nth_element(execution::par_unseq, 300007, range);
+
+        test_nth_element_async(execution::seq(execution::task), 300007, range);
+        test_nth_element_async(execution::par(execution::task), 300007, range);
+    }
+
+    test_nth_element(execution::par, 1007, 1000);
+}
+
+void nth_element_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_nth_element_exception(execution::seq);
+    test_nth_element_exception(execution::par);
+
+    test_nth_element_exception_async(execution::seq(execution::task));
+    test_nth_element_exception_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    nth_element_test();
+    nth_element_exception_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<> dist(0, 100000);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dist(gen); });
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy policy, std::size_t size, std::size_t count)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d));
+
+    auto result = hpx::parallel::partial_sort(policy,
+        std::begin(c), std::begin(c) + count, std::end(c));
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + count, std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy policy, std::size_t size,
+    std::size_t count)
+{
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d), std::greater<int>());
+
+    auto f = hpx::parallel::partial_sort(policy,
+        std::begin(c), std::begin(c) + count, std::end(c),
+        std::greater<int>());
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + count, std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy policy, std::size_t size,
+    std::size_t count)
+{
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d));
+
+    std::vector<int> dest(count);
+    auto result = hpx::parallel::partial_sort_copy(policy,
+        std::begin(c), std::end(c), std::begin(dest), std::end(dest));
+
+    std::size_t sorted = (std::min)(size, count);
+    HPX_TEST(result == std::begin(dest) + sorted);
+    HPX_TEST(std::equal(std::begin(dest), result, std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_exception(ExPolicy policy)
+{
+    std::vector<int> c = make_data(300007);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::partial_sort(policy, std::begin(c),
+            std::begin(c) + 1000, std::end(c), throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<
+                ExPolicy, std::random_access_iterator_tag
+            >::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_exception_async(ExPolicy policy)
+{
+    std::vector<int> c = make_data(300007);
+
+    bool caught_exception = false;
+    bool returned_from_algorithm = false;
+    try {
+        auto f = hpx::parallel::partial_sort(policy, std::begin(c),
+            std::begin(c) + 1000, std::end(c), throw_always());
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+}
+
+////////////////////////////////////////////////////////////////////////////
+void partial_sort_test()
+{
+    using namespace hpx::parallel;
+
+    std::size_t const size = 300007;
+    for (std::size_t count : { std::size_t(0), std::size_t(1),
+        std::size_t(1000), std::size_t(100003), size })
+    {
+        test_partial_sort(execution::seq, size, count);
+        test_partial_sort(execution::par, size, count);
+        test_partial_sort(execution::par_unseq, size, count);
+
+        test_partial_sort_async(execution::seq(execution::task), size, count);
+        test_partial_sort_async(execution::par(execution::task), size, count);
+    }
+
+    test_partial_sort(execution::par, 1007, 100);
+}
+
+void partial_sort_copy_test()
+{
+    using namespace hpx::parallel;
+
+    std::size_t const size = 300007;
+    for (std::size_t count : { std::size_t(0), std::size_t(1000),
+        std::size_t(100003), size, size + 10 })
+    {
+        test_partial_sort_copy(execution::seq, size, count);
+        test_partial_sort_copy(execution::par, size, count);
+        test_partial_sort_copy(execution::par_unseq, size, count);
+    }
+
+    test_partial_sort_copy(execution::par, 1007, 100);
+}
+
+void partial_sort_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_partial_sort_exception(execution::seq);
+    test_partial_sort_exception(execution::par);
+
+    test_partial_sort_exception_async(execution::seq(execution::task));
+    test_partial_sort_exception_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partial_sort_test();
+    partial_sort_copy_test();
+    partial_sort_exception_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,240 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Arithmetic keys compared using std::less or std::greater are sorted using
+// a radix sort, this verifies the ordering of the keys it produces.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// sizes below the threshold for the radix sort, handled by a single task,
+// and split into several tasks
+std::size_t const sizes[] = { 0, 1, 17, 5000, 100000, 1000007 };
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T> >::type
+random_values(std::size_t size)
+{
+    // the conversion keeps the lowest bits which are uniformly distributed
+    std::uniform_int_distribution<std::uint64_t> dis;
+
+    std::vector<T> c(size);
+    for (T& v : c)
+        v = T(dis(gen));
+    return c;
+}
+
+template <typename T>
+typename std::enable_if<!std::is_integral<T>::value, std::vector<T> >::type
+random_values(std::size_t size)
+{
+    std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+
+    std::vector<T> c(size);
+    for (T& v : c)
+        v = dis(gen);
+
+    // make sure the special values are ordered correctly as well
+    if (size > 4)
+    {
+        c[0] = T(-0.0);
+        c[1] = T(0.0);
+        c[2] = -(std::numeric_limits<T>::max)();
+        c[3] = (std::numeric_limits<T>::infinity)();
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix(ExPolicy policy, T, Compare comp)
+{
+    static_assert(
+        hpx::parallel::v1::detail::is_radix_sortable<
+            typename std::vector<T>::iterator, Compare,
+            hpx::parallel::util::projection_identity
+        >::value,
+        "the radix sort should be used for arithmetic keys");
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = random_values<T>(size);
+        std::vector<T> d = c;
+
+        hpx::parallel::sort(policy, c.begin(), c.end(), comp);
+        std::sort(d.begin(), d.end(), comp);
+
+        HPX_TEST(std::is_sorted(c.begin(), c.end(), comp));
+
+        // -0.0 and 0.0 are equivalent but distinguishable, compare using the
+        // comparison function only
+        bool equal = std::equal(c.begin(), c.end(), d.begin(),
+            [&](T const& lhs, T const& rhs)
+            {
+                return !comp(lhs, rhs) && !comp(rhs, lhs);
+            });
+        HPX_TEST(equal);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_radix(ExPolicy policy, T)
+{
+    test_sort_radix(policy, T(), std::less<T>());
+    test_sort_radix(policy, T(), std::greater<T>());
+}
+
+template <typename ExPolicy>
+void test_sort_radix(ExPolicy policy)
+{
+    test_sort_radix(policy, std::int8_t());
+    test_sort_radix(policy, std::uint8_t());
+    test_sort_radix(policy, std::int16_t());
+    test_sort_radix(policy, std::uint16_t());
+    test_sort_radix(policy, std::int32_t());
+    test_sort_radix(policy, std::uint32_t());
+    test_sort_radix(policy, std::int64_t());
+    test_sort_radix(policy, std::uint64_t());
+    test_sort_radix(policy, float());
+    test_sort_radix(policy, double());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_radix_async(ExPolicy policy)
+{
+    std::vector<std::int64_t> c = random_values<std::int64_t>(1000007);
+
+    auto f = hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Compare>
+void test_sort_by_key_radix(ExPolicy policy, Compare comp)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::uint32_t> keys =
+            random_values<std::uint32_t>(size);
+        std::vector<std::uint32_t> values(keys);
+
+        hpx::parallel::sort_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), comp);
+
+        HPX_TEST(std::is_sorted(keys.begin(), keys.end(), comp));
+
+        // the values have to be moved along with the keys
+        HPX_TEST(keys == values);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sort_radix_exception()
+{
+    using namespace hpx::parallel;
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::decorated_iterator<
+            base_iterator, std::random_access_iterator_tag
+        > decorated_iterator;
+
+    std::vector<int> c = random_values<int>(1000007);
+
+    bool caught_exception = false;
+    try {
+        sort(execution::par,
+            decorated_iterator(
+                c.begin(), [](){ throw std::runtime_error("test"); }),
+            decorated_iterator(c.end()));
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<
+                execution::parallel_policy, std::random_access_iterator_tag
+            >::call(execution::par, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_sort_radix(execution::seq);
+    test_sort_radix(execution::par);
+    test_sort_radix(execution::par_unseq);
+
+    test_sort_radix_async(execution::seq(execution::task));
+    test_sort_radix_async(execution::par(execution::task));
+
+    test_sort_by_key_radix(execution::seq, std::less<std::uint32_t>());
+    test_sort_by_key_radix(execution::par, std::less<std::uint32_t>());
+    test_sort_by_key_radix(execution::par, std::greater<std::uint32_t>());
+
+    test_sort_radix_exception();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,342 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Large sequences are sorted using a sample sort, the threshold is lowered
+// using the sample_sort_threshold executor parameters to exercise it here.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// A comparison function object which is not handled by the radix sort.
+struct compare_values
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_sample(ExPolicy policy, int range)
+{
+    std::uniform_int_distribution<> dis(0, range - 1);
+
+    std::vector<int> c(1000007);
+    for (int& v : c)
+        v = dis(gen);
+
+    std::vector<int> d = c;
+
+    hpx::parallel::sort(policy, c.begin(), c.end(), compare_values());
+    std::sort(d.begin(), d.end());
+
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_sort_sample(ExPolicy policy)
+{
+    // few values result in buckets of very different sizes
+    test_sort_sample(policy, 3);
+    test_sort_sample(policy, 1000);
+    test_sort_sample(policy, (std::numeric_limits<int>::max)());
+}
+
+template <typename ExPolicy>
+void test_sort_sample_strings(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<std::string> c(200000);
+    for (std::string& s : c)
+        s = std::to_string(dis(gen));
+
+    std::vector<std::string> d = c;
+
+    hpx::parallel::sort(policy, c.begin(), c.end(),
+        std::greater<std::string>());
+    std::sort(d.begin(), d.end(), std::greater<std::string>());
+
+    HPX_TEST(c == d);
+}
+
+// The sample sort does not need to copy or to default construct elements.
+template <typename ExPolicy>
+void test_sort_sample_move_only(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<std::unique_ptr<int> > c;
+    c.reserve(200000);
+    for (std::size_t i = 0; i != 200000; ++i)
+        c.emplace_back(new int(dis(gen)));
+
+    hpx::parallel::sort(policy, c.begin(), c.end(),
+        [](std::unique_ptr<int> const& lhs, std::unique_ptr<int> const& rhs)
+        {
+            return *lhs < *rhs;
+        });
+
+    HPX_TEST(std::is_sorted(c.begin(), c.end(),
+        [](std::unique_ptr<int> const& lhs, std::unique_ptr<int> const& rhs)
+        {
+            return *lhs < *rhs;
+        }));
+}
+
+template <typename ExPolicy>
+void test_sort_sample_async(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<int> c(1000007);
+    for (int& v : c)
+        v = dis(gen);
+
+    auto f = hpx::parallel::sort(policy, c.begin(), c.end(),
+        compare_values());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_sample_exception(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<int> c(1000007);
+    for (int& v : c)
+        v = dis(gen);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::sort(policy, c.begin(), c.end(),
+            [](int lhs, int rhs) -> bool
+            {
+                throw std::runtime_error("test");
+                return lhs < rhs;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+// The comparison fails only once the buckets are sorted, i.e. when it is
+// invoked for elements which are not part of the original sequence.
+template <typename ExPolicy>
+void test_sort_sample_exception_sort(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<int> c(1000007);
+    for (int& v : c)
+        v = dis(gen);
+
+    std::vector<int> d = c;
+
+    int const* begin = c.data();
+    int const* end = c.data() + c.size();
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::sort(policy, c.begin(), c.end(),
+            [begin, end](int const& lhs, int const& rhs) -> bool
+            {
+                std::less<int const*> less;
+                if (less(&lhs, begin) || !less(&lhs, end))
+                    throw std::runtime_error("test");
+                return lhs < rhs;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+
+    // all elements have been moved back into the sequence
+    std::sort(c.begin(), c.end());
+    std::sort(d.begin(), d.end());
+    HPX_TEST(c == d);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> live_objects(0);
+std::atomic<std::int64_t> moves_left(-1);
+
+// The move constructor fails once moves_left drops to zero.
+struct throwing_move
+{
+    explicit throwing_move(int value)
+      : value_(value)
+    {
+        ++live_objects;
+    }
+
+    throwing_move(throwing_move && rhs)
+      : value_(rhs.value_)
+    {
+        if (moves_left.load() >= 0 && moves_left-- == 0)
+            throw std::runtime_error("test");
+
+        rhs.value_ = -1;
+        ++live_objects;
+    }
+
+    throwing_move& operator=(throwing_move && rhs)
+    {
+        value_ = rhs.value_;
+        rhs.value_ = -1;
+        return *this;
+    }
+
+    ~throwing_move()
+    {
+        --live_objects;
+    }
+
+    int value_;
+};
+
+template <typename ExPolicy>
+void test_sort_sample_exception_move(ExPolicy policy)
+{
+    std::uniform_int_distribution<> dis(0, 1000000);
+
+    std::vector<throwing_move> c;
+    std::vector<int> d;
+    c.reserve(200000);
+    d.reserve(200000);
+    for (std::size_t i = 0; i != 200000; ++i)
+    {
+        c.emplace_back(dis(gen));
+        d.push_back(c.back().value_);
+    }
+
+    // fail while the elements are moved to their buckets
+    moves_left = std::int64_t(c.size() / 2);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::sort(policy, c.begin(), c.end(),
+            [](throwing_move const& lhs, throwing_move const& rhs)
+            {
+                return lhs.value_ < rhs.value_;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (std::runtime_error const&) {
+        // a single chunk is moved on the calling thread
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    moves_left = -1;
+
+    HPX_TEST(caught_exception);
+
+    // the moved elements have been moved back to their original position
+    // and the copies in the buckets have been destroyed
+    HPX_TEST_EQ(live_objects.load(), std::int64_t(c.size()));
+    for (std::size_t i = 0; i != c.size(); ++i)
+        HPX_TEST_EQ(c[i].value_, d[i]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    execution::sample_sort_threshold threshold(0);
+
+    test_sort_sample(execution::par.with(threshold));
+    test_sort_sample(
+        execution::par.with(execution::static_chunk_size(), threshold));
+
+    test_sort_sample_strings(execution::par.with(threshold));
+    test_sort_sample_move_only(execution::par.with(threshold));
+
+    test_sort_sample_async(execution::par(execution::task).with(threshold));
+
+    test_sort_sample_exception(execution::par.with(threshold));
+    test_sort_sample_exception_sort(execution::par.with(threshold));
+    test_sort_sample_exception_move(execution::par.with(threshold));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
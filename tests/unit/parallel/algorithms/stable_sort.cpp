@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+// The second member records the original position of the element, which
+// allows verifying that the order of equal keys is preserved.
+typedef std::pair<int, std::size_t> element_type;
+
+std::vector<element_type> make_data(std::size_t size)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<> dist(0, 1000);
+
+    std::vector<element_type> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = element_type(dist(gen), i);
+    return c;
+}
+
+struct compare_keys
+{
+    bool operator()(element_type const& lhs, element_type const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    auto result = hpx::parallel::stable_sort(policy,
+        std::begin(c), std::end(c), compare_keys());
+    std::stable_sort(std::begin(d), std::end(d), compare_keys());
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy policy, std::size_t size)
+{
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    auto f = hpx::parallel::stable_sort(policy,
+        std::begin(c), std::end(c), compare_keys());
+    auto result = f.get();
+    std::stable_sort(std::begin(d), std::end(d), compare_keys());
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_proj(ExPolicy policy, std::size_t size)
+{
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    // sort descending by key using a projection
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        std::greater<int>(),
+        [](element_type const& e) { return e.first; });
+    std::stable_sort(std::begin(d), std::end(d),
+        [](element_type const& lhs, element_type const& rhs)
+        {
+            return lhs.first > rhs.first;
+        });
+
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy policy)
+{
+    std::vector<element_type> c = make_data(300007);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+            throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<
+                ExPolicy, std::random_access_iterator_tag
+            >::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception_async(ExPolicy policy)
+{
+    std::vector<element_type> c = make_data(300007);
+
+    bool caught_exception = false;
+    bool returned_from_algorithm = false;
+    try {
+        auto f = hpx::parallel::stable_sort(policy,
+            std::begin(c), std::end(c), throw_always());
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+}
+
+////////////////////////////////////////////////////////////////////////////
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    // sizes below and above the sequential cut-off
+    for (std::size_t size : { std::size_t(1007), std::size_t(300007) })
+    {
+        test_stable_sort(execution::seq, size);
+        test_stable_sort(execution::par, size);
+        test_stable_sort(execution::par_unseq, size);
+
+        test_stable_sort_async(execution::seq(execution::task), size);
+        test_stable_sort_async(execution::par(execution::task), size);
+
+        test_stable_sort_proj(execution::seq, size);
+        test_stable_sort_proj(execution::par, size);
+    }
+
+    test_stable_sort(execution::par, 0);
+    test_stable_sort(execution::par, 1);
+}
+
+void stable_sort_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_stable_sort_exception(execution::seq);
+    test_stable_sort_exception(execution::par);
+
+    test_stable_sort_exception_async(execution::seq(execution::task));
+    test_stable_sort_exception_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stable_sort_test();
+    stable_sort_exception_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_data(std::size_t size)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<> dist(0, 1000);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dist(gen); });
+    return c;
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(300007);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d));
+
+    std::size_t const n = 100003;
+    auto result = hpx::parallel::nth_element(policy, c, std::begin(c) + n);
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST_EQ(c[n], d[n]);
+    HPX_TEST(std::all_of(std::begin(c), std::begin(c) + n,
+        [&](int v) { return v <= c[n]; }));
+    HPX_TEST(std::all_of(std::begin(c) + n, std::end(c),
+        [&](int v) { return v >= c[n]; }));
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy policy)
+{
+    std::vector<int> c = make_data(300007);
+    std::vector<int> d = c;
+    std::sort(std::begin(d), std::end(d), std::greater<int>());
+
+    std::size_t const n = 1000;
+    auto f = hpx::parallel::nth_element(policy, c, std::begin(c) + n,
+        std::greater<int>());
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST_EQ(c[n], d[n]);
+}
+
+void nth_element_test()
+{
+    using namespace hpx::parallel;
+
+    test_nth_element(execution::seq);
+    test_nth_element(execution::par);
+    test_nth_element(execution::par_unseq);
+
+    test_nth_element_async(execution::seq(execution::task));
+    test_nth_element_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    nth_element_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::lcos::local::cancellation_source;
+using hpx::parallel::execution::cancellable_executor;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> invoked(0);
+
+int test(int passed_through)
+{
+    ++invoked;
+    return passed_through;
+}
+
+template <typename Future>
+bool is_cancelled(Future& f)
+{
+    try {
+        f.get();
+    }
+    catch (hpx::exception const& e) {
+        return e.get_error() == hpx::future_cancelled;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void static_check_executor()
+{
+    using namespace hpx::traits;
+    typedef cancellable_executor<> executor;
+
+    static_assert(has_async_execute_member<executor>::value,
+        "has_async_execute_member<executor>::value");
+    static_assert(has_then_execute_member<executor>::value,
+        "has_then_execute_member<executor>::value");
+    static_assert(has_post_member<executor>::value,
+        "has_post_member<executor>::value");
+    static_assert(is_two_way_executor<executor>::value,
+        "is_two_way_executor<executor>::value");
+    static_assert(is_cancellable_executor<executor>::value,
+        "is_cancellable_executor<executor>::value");
+    static_assert(
+        !is_cancellable_executor<
+            hpx::parallel::execution::parallel_executor
+        >::value,
+        "!is_cancellable_executor<parallel_executor>::value");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async()
+{
+    cancellation_source source;
+    cancellable_executor<> exec(source.get_token());
+
+    invoked = 0;
+    HPX_TEST_EQ(hpx::async(exec, &test, 42).get(), 42);
+    HPX_TEST_EQ(invoked.load(), std::size_t(1));
+
+    HPX_TEST(source.cancel());
+    HPX_TEST(!source.cancel());
+    HPX_TEST(exec.get_cancellation_token().is_cancelled());
+
+    hpx::future<int> f = hpx::async(exec, &test, 42);
+    HPX_TEST(is_cancelled(f));
+    HPX_TEST_EQ(invoked.load(), std::size_t(1));
+}
+
+void test_then()
+{
+    cancellation_source source;
+    cancellable_executor<> exec(source.get_token());
+
+    invoked = 0;
+
+    hpx::lcos::local::promise<int> p;
+    hpx::future<int> f = p.get_future().then(exec,
+        [](hpx::future<int> && f) { return test(f.get()); });
+
+    // the continuation is scheduled only after the promise has been set
+    source.cancel();
+    p.set_value(42);
+
+    HPX_TEST(is_cancelled(f));
+    HPX_TEST_EQ(invoked.load(), std::size_t(0));
+}
+
+void test_dataflow()
+{
+    cancellation_source source;
+    cancellable_executor<> exec(source.get_token());
+
+    invoked = 0;
+
+    hpx::lcos::local::promise<int> p1, p2;
+    hpx::future<int> f1 = hpx::dataflow(exec,
+        [](hpx::future<int> && f) { return test(f.get()); },
+        p1.get_future());
+    hpx::future<int> f2 = hpx::dataflow(exec,
+        [](hpx::future<int> && f) { return test(f.get()); },
+        p2.get_future());
+
+    p1.set_value(42);
+    HPX_TEST_EQ(f1.get(), 42);
+
+    source.cancel();
+    p2.set_value(42);
+
+    HPX_TEST(is_cancelled(f2));
+    HPX_TEST_EQ(invoked.load(), std::size_t(1));
+}
+
+void test_bulk_async()
+{
+    cancellation_source source;
+    cancellable_executor<> exec(source.get_token());
+
+    invoked = 0;
+    source.cancel();
+
+    std::vector<int> v(107);
+    std::vector<hpx::future<int> > results =
+        hpx::parallel::execution::bulk_async_execute(exec,
+            [](int i) { return test(i); }, v);
+
+    for (hpx::future<int>& f : results)
+        HPX_TEST(is_cancelled(f));
+    HPX_TEST_EQ(invoked.load(), std::size_t(0));
+}
+
+void test_default_token()
+{
+    // a default constructed token is never cancelled
+    cancellable_executor<> exec{hpx::lcos::local::cancellation_token()};
+
+    HPX_TEST(!exec.get_cancellation_token().can_be_cancelled());
+    HPX_TEST_EQ(hpx::async(exec, &test, 42).get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    static_check_executor();
+
+    test_async();
+    test_then();
+    test_dataflow();
+    test_bulk_async();
+    test_default_token();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
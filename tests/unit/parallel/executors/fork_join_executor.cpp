@@ -0,0 +1,177 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test(int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    return passed_through;
+}
+
+void test_sync()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    HPX_TEST_EQ(hpx::parallel::execution::sync_execute(exec, &test, 42), 42);
+}
+
+void test_async()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    HPX_TEST_EQ(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get(), 42);
+}
+
+std::atomic<std::size_t> post_count(0);
+
+void test_post_f(int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    ++post_count;
+}
+
+void test_post()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    hpx::parallel::execution::post(exec, &test_post_f, 42);
+
+    // the task may have been run on a new thread
+    while (post_count.load() == 0)
+        hpx::this_thread::yield();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void throw_exception()
+{
+    throw std::runtime_error("test");
+}
+
+void test_async_exception()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    executor exec;
+    hpx::future<void> f =
+        hpx::parallel::execution::async_execute(exec, &throw_exception);
+
+    bool caught_exception = false;
+    try {
+        f.get();
+    }
+    catch (std::runtime_error const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::parallel::execution::fork_join_executor exec;
+    hpx::future<std::uint64_t> lhs =
+        hpx::parallel::execution::async_execute(exec, &fibonacci, n - 1);
+    std::uint64_t rhs = fibonacci(n - 2);
+
+    return lhs.get() + rhs;
+}
+
+void test_recursive()
+{
+    HPX_TEST_EQ(fibonacci(20), std::uint64_t(6765));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> bulk_count(0);
+
+void bulk_test(int value, int passed_through) //-V813
+{
+    HPX_TEST_EQ(passed_through, 42);
+    ++bulk_count;
+}
+
+void test_bulk_sync()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    bulk_count.store(0);
+
+    executor exec;
+    hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+
+    HPX_TEST_EQ(bulk_count.load(), v.size());
+}
+
+void test_bulk_async()
+{
+    typedef hpx::parallel::execution::fork_join_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    bulk_count.store(0);
+
+    executor exec;
+    hpx::when_all(hpx::parallel::execution::bulk_async_execute(
+        exec, &bulk_test, v, 42)
+    ).get();
+
+    HPX_TEST_EQ(bulk_count.load(), v.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sync();
+    test_async();
+    test_post();
+    test_async_exception();
+    test_recursive();
+
+    test_bulk_sync();
+    test_bulk_async();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_adjacent_difference.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void square_vector(hpx::partitioned_vector<T>& v)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for(T val = T(0); it != end; ++it, ++val)
+        *it = val * val;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v, T const& first,
+    std::size_t offset = 0)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator const_iterator;
+
+    const_iterator it = v.begin() + offset, end = v.end();
+    HPX_TEST_EQ(*it, first);
+
+    // the difference of two consecutive squares is 2 * n - 1
+    T n = T(1);
+    for (++it; it != end; ++it, ++n)
+    {
+        HPX_TEST_EQ(*it, T(2) * n - T(1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void adjacent_difference_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& adjacent_difference_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+    square_vector(c);
+
+    iterator result = hpx::parallel::adjacent_difference(
+        adjacent_difference_policy, c.begin(), c.end(), d.begin());
+    HPX_TEST(result == d.end());
+    verify_vector(d, T(0));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void adjacent_difference_algo_tests_misaligned(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& adjacent_difference_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    square_vector(c);
+
+    // the destination is shifted by one element
+    hpx::partitioned_vector<T> d1(size, policy);
+    iterator result = hpx::parallel::adjacent_difference(
+        adjacent_difference_policy, c.begin(), c.end() - 1, d1.begin() + 1);
+    HPX_TEST(result == d1.end());
+    verify_vector(d1, T(0), 1);
+
+    // the destination is partitioned differently
+    hpx::partitioned_vector<T> d2(size, hpx::container_layout(2));
+    result = hpx::parallel::adjacent_difference(
+        adjacent_difference_policy, c.begin(), c.end(), d2.begin());
+    HPX_TEST(result == d2.end());
+    verify_vector(d2, T(0));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void adjacent_difference_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& adjacent_difference_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+    square_vector(c);
+
+    hpx::future<iterator> f = hpx::parallel::adjacent_difference(
+        adjacent_difference_policy, c.begin(), c.end(), d.begin());
+    HPX_TEST(f.get() == d.end());
+    verify_vector(d, T(0));
+}
+
+template <typename T, typename DistPolicy>
+void adjacent_difference_tests_with_policy(std::size_t size,
+    std::size_t localities, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    adjacent_difference_algo_tests_with_policy<T>(size, policy, seq);
+    adjacent_difference_algo_tests_with_policy<T>(size, policy, par);
+
+    adjacent_difference_algo_tests_misaligned<T>(size, policy, seq);
+    adjacent_difference_algo_tests_misaligned<T>(size, policy, par);
+
+    //async
+    adjacent_difference_algo_tests_with_policy_async<T>(
+        size, policy, seq(task));
+    adjacent_difference_algo_tests_with_policy_async<T>(
+        size, policy, par(task));
+}
+
+template <typename T>
+void adjacent_difference_tests()
+{
+    std::size_t const length = 12;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    adjacent_difference_tests_with_policy<T>(length, 1, hpx::container_layout);
+    adjacent_difference_tests_with_policy<T>(length, 3,
+        hpx::container_layout(3));
+    adjacent_difference_tests_with_policy<T>(length, 3,
+        hpx::container_layout(3, localities));
+    adjacent_difference_tests_with_policy<T>(length, localities.size(),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    adjacent_difference_tests<double>();
+    adjacent_difference_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v, T val)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for(/**/; it != end; ++it)
+        *it = val++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void adjacent_find_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& adjacent_find_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    iota_vector(c, T(1234));
+
+    iterator result = hpx::parallel::adjacent_find(
+        adjacent_find_policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+
+    // create a pair of equal elements straddling the middle of the vector,
+    // which may be located on two different partitions
+    c[size / 2] = c[size / 2 - 1];
+
+    result = hpx::parallel::adjacent_find(
+        adjacent_find_policy, c.begin(), c.end());
+    HPX_TEST(result == c.begin() + (size / 2 - 1));
+
+    // an earlier pair has to be found first
+    c[2] = c[1];
+
+    result = hpx::parallel::adjacent_find(
+        adjacent_find_policy, c.begin(), c.end());
+    HPX_TEST(result == c.begin() + 1);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void adjacent_find_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& adjacent_find_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    iota_vector(c, T(1234));
+
+    c[size / 2] = c[size / 2 - 1];
+
+    hpx::future<iterator> f = hpx::parallel::adjacent_find(
+        adjacent_find_policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.begin() + (size / 2 - 1));
+}
+
+template <typename T, typename DistPolicy>
+void adjacent_find_tests_with_policy(std::size_t size, std::size_t localities,
+    DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    adjacent_find_algo_tests_with_policy<T>(size, policy, seq);
+    adjacent_find_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    adjacent_find_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    adjacent_find_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void adjacent_find_tests()
+{
+    std::size_t const length = 12;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    adjacent_find_tests_with_policy<T>(length, 1, hpx::container_layout);
+    adjacent_find_tests_with_policy<T>(length, 3, hpx::container_layout(3));
+    adjacent_find_tests_with_policy<T>(length, 3,
+        hpx::container_layout(3, localities));
+    adjacent_find_tests_with_policy<T>(length, localities.size(),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    adjacent_find_tests<double>();
+    adjacent_find_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_equal.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v, T val)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for(/**/; it != end; ++it)
+        *it = val++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void equal_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& equal_policy)
+{
+    hpx::partitioned_vector<T> c1(size, policy);
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c1, T(1234));
+    iota_vector(c2, T(1234));
+
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin()));
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin(), c2.end()));
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin(), c2.end() - 1));
+
+    // modify the last element of the first partition
+    c2[size / 2] = T(42);
+
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin()));
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin(), c2.end()));
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.begin() + size / 2, c2.begin()));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void equal_algo_tests_misaligned(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& equal_policy)
+{
+    hpx::partitioned_vector<T> c1(size, policy);
+    iota_vector(c1, T(1234));
+
+    // both sequences start at the same offset
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c2, T(1234));
+
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin() + 1, c1.end() - 1, c2.begin() + 1));
+    c2[size - 2] = T(42);
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin() + 1, c1.end() - 1, c2.begin() + 1, c2.end() - 1));
+
+    // the second sequence is shifted by one element
+    hpx::partitioned_vector<T> c3(size, policy);
+    iota_vector(c3, T(1233));
+
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end() - 1, c3.begin() + 1));
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end() - 1, c3.begin() + 1, c3.end()));
+    c3[size / 2] = T(42);
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end() - 1, c3.begin() + 1));
+
+    // the second sequence is partitioned differently
+    hpx::partitioned_vector<T> c4(size, hpx::container_layout(2));
+    iota_vector(c4, T(1234));
+
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c4.begin()));
+    HPX_TEST(hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c4.begin(), c4.end()));
+    c4[size / 2 + 1] = T(42);
+    HPX_TEST(!hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c4.begin(), c4.end()));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void equal_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& equal_policy)
+{
+    hpx::partitioned_vector<T> c1(size, policy);
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c1, T(1234));
+    iota_vector(c2, T(1234));
+
+    hpx::future<bool> f = hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin());
+    HPX_TEST(f.get());
+
+    c2[size / 2] = T(42);
+
+    hpx::future<bool> f1 = hpx::parallel::equal(equal_policy,
+        c1.begin(), c1.end(), c2.begin(), c2.end());
+    HPX_TEST(!f1.get());
+}
+
+template <typename T, typename DistPolicy>
+void equal_tests_with_policy(std::size_t size, std::size_t localities,
+    DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    equal_algo_tests_with_policy<T>(size, policy, seq);
+    equal_algo_tests_with_policy<T>(size, policy, par);
+
+    equal_algo_tests_misaligned<T>(size, policy, seq);
+    equal_algo_tests_misaligned<T>(size, policy, par);
+
+    //async
+    equal_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    equal_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void equal_tests()
+{
+    std::size_t const length = 12;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    equal_tests_with_policy<T>(length, 1, hpx::container_layout);
+    equal_tests_with_policy<T>(length, 3, hpx::container_layout(3));
+    equal_tests_with_policy<T>(length, 3, hpx::container_layout(3, localities));
+    equal_tests_with_policy<T>(length, localities.size(),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    equal_tests<double>();
+    equal_tests<int>();
+
+    return hpx::util::report_errors();
+}
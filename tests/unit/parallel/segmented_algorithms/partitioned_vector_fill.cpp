@@ -79,6 +79,13 @@ void fill_algo_tests_with_policy(std::size_t size,
     verify_values(c.begin()+1, c.end()-1, v1);
     verify_values(c.begin(), c.begin()+1, v1, false);
     verify_values(c.end()-1, c.end(), v1, false);
+
+    const T v2(44);
+    auto it = hpx::parallel::fill_n(fill_policy, c.begin()+1, size-2, v2);
+    HPX_TEST(it == c.end()-1);
+    verify_values(c.begin()+1, c.end()-1, v2);
+    verify_values(c.begin(), c.begin()+1, v2, false);
+    verify_values(c.end()-1, c.end(), v2, false);
 }
 
 template <typename T, typename DistPolicy, typename ExPolicy>
@@ -101,6 +108,14 @@ void fill_algo_tests_with_policy_async(std::size_t size,
     verify_values(c.begin()+1, c.end()-1, v1);
     verify_values(c.begin(), c.begin()+1, v1, false);
     verify_values(c.end()-1, c.end(), v1, false);
+
+    const T v2(44);
+    auto f2 = hpx::parallel::fill_n(fill_policy, c.begin()+1, size-2, v2);
+    HPX_TEST(f2.get() == c.end()-1);
+
+    verify_values(c.begin()+1, c.end()-1, v2);
+    verify_values(c.begin(), c.begin()+1, v2, false);
+    verify_values(c.end()-1, c.end(), v2, false);
 }
 
 template <typename T, typename DistPolicy>
@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v, T val)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for(/**/; it != end; ++it)
+        *it = val++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void mismatch_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& mismatch_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c1(size, policy);
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c1, T(1234));
+    iota_vector(c2, T(1234));
+
+    std::pair<iterator, iterator> result = hpx::parallel::mismatch(
+        mismatch_policy, c1.begin(), c1.end(), c2.begin());
+    HPX_TEST(result.first == c1.end());
+    HPX_TEST(result.second == c2.end());
+
+    // introduce two mismatches, the first one has to be reported
+    c2[size - 2] = T(42);
+    c2[size / 2] = T(42);
+
+    result = hpx::parallel::mismatch(
+        mismatch_policy, c1.begin(), c1.end(), c2.begin());
+    HPX_TEST(result.first == c1.begin() + size / 2);
+    HPX_TEST(result.second == c2.begin() + size / 2);
+
+    result = hpx::parallel::mismatch(mismatch_policy,
+        c1.begin(), c1.end(), c2.begin(), c2.begin() + size / 2);
+    HPX_TEST(result.first == c1.begin() + size / 2);
+    HPX_TEST(result.second == c2.begin() + size / 2);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void mismatch_algo_tests_misaligned(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& mismatch_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c1(size, policy);
+    iota_vector(c1, T(1234));
+
+    // both sequences start at the same offset
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c2, T(1234));
+    c2[size - 2] = T(42);
+
+    std::pair<iterator, iterator> result = hpx::parallel::mismatch(
+        mismatch_policy, c1.begin() + 1, c1.end() - 1, c2.begin() + 1);
+    HPX_TEST(result.first == c1.begin() + size - 2);
+    HPX_TEST(result.second == c2.begin() + size - 2);
+
+    // the second sequence is shifted by one element
+    hpx::partitioned_vector<T> c3(size, policy);
+    iota_vector(c3, T(1233));
+
+    result = hpx::parallel::mismatch(mismatch_policy,
+        c1.begin(), c1.end() - 1, c3.begin() + 1, c3.end());
+    HPX_TEST(result.first == c1.end() - 1);
+    HPX_TEST(result.second == c3.end());
+
+    c3[size / 2] = T(42);
+    result = hpx::parallel::mismatch(mismatch_policy,
+        c1.begin(), c1.end() - 1, c3.begin() + 1);
+    HPX_TEST(result.first == c1.begin() + size / 2 - 1);
+    HPX_TEST(result.second == c3.begin() + size / 2);
+
+    // the second sequence is partitioned differently
+    hpx::partitioned_vector<T> c4(size, hpx::container_layout(2));
+    iota_vector(c4, T(1234));
+
+    result = hpx::parallel::mismatch(mismatch_policy,
+        c1.begin(), c1.end(), c4.begin(), c4.end());
+    HPX_TEST(result.first == c1.end());
+    HPX_TEST(result.second == c4.end());
+
+    c4[size / 2 + 1] = T(42);
+    result = hpx::parallel::mismatch(mismatch_policy,
+        c1.begin(), c1.end(), c4.begin());
+    HPX_TEST(result.first == c1.begin() + size / 2 + 1);
+    HPX_TEST(result.second == c4.begin() + size / 2 + 1);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void mismatch_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& mismatch_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c1(size, policy);
+    hpx::partitioned_vector<T> c2(size, policy);
+    iota_vector(c1, T(1234));
+    iota_vector(c2, T(1234));
+
+    c2[size / 2] = T(42);
+
+    hpx::future<std::pair<iterator, iterator> > f = hpx::parallel::mismatch(
+        mismatch_policy, c1.begin(), c1.end(), c2.begin(), c2.end());
+
+    std::pair<iterator, iterator> result = f.get();
+    HPX_TEST(result.first == c1.begin() + size / 2);
+    HPX_TEST(result.second == c2.begin() + size / 2);
+}
+
+template <typename T, typename DistPolicy>
+void mismatch_tests_with_policy(std::size_t size, std::size_t localities,
+    DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    mismatch_algo_tests_with_policy<T>(size, policy, seq);
+    mismatch_algo_tests_with_policy<T>(size, policy, par);
+
+    mismatch_algo_tests_misaligned<T>(size, policy, seq);
+    mismatch_algo_tests_misaligned<T>(size, policy, par);
+
+    //async
+    mismatch_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    mismatch_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void mismatch_tests()
+{
+    std::size_t const length = 12;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    mismatch_tests_with_policy<T>(length, 1, hpx::container_layout);
+    mismatch_tests_with_policy<T>(length, 3, hpx::container_layout(3));
+    mismatch_tests_with_policy<T>(length, 3,
+        hpx::container_layout(3, localities));
+    mismatch_tests_with_policy<T>(length, localities.size(),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    mismatch_tests<double>();
+    mismatch_tests<int>();
+
+    return hpx::util::report_errors();
+}
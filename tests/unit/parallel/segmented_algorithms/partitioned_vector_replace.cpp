@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_replace.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct is_odd
+{
+    bool operator()(T const& val) const
+    {
+        return int(val) % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned version)
+    {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v, T val)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for(/**/; it != end; ++it)
+        *it = val++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v, T const& val,
+    bool odd_replaced)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator const_iterator;
+
+    T expected = T(0);
+
+    const_iterator end = v.end();
+    for (const_iterator it = v.begin(); it != end; ++it, ++expected)
+    {
+        if (expected == T(1) || (odd_replaced && int(expected) % 2 != 0))
+        {
+            HPX_TEST_EQ(*it, val);
+        }
+        else
+        {
+            HPX_TEST_EQ(*it, expected);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void replace_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& replace_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    iota_vector(c, T(0));
+
+    auto result = hpx::parallel::replace(
+        replace_policy, c.begin(), c.end(), T(1), T(42));
+    HPX_TEST(result == c.end());
+    verify_vector(c, T(42), false);
+
+    result = hpx::parallel::replace_if(
+        replace_policy, c.begin(), c.end(), is_odd<T>(), T(42));
+    HPX_TEST(result == c.end());
+    verify_vector(c, T(42), true);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void replace_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& replace_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    iota_vector(c, T(0));
+
+    auto f = hpx::parallel::replace(
+        replace_policy, c.begin(), c.end(), T(1), T(42));
+    HPX_TEST(f.get() == c.end());
+    verify_vector(c, T(42), false);
+
+    auto f1 = hpx::parallel::replace_if(
+        replace_policy, c.begin(), c.end(), is_odd<T>(), T(42));
+    HPX_TEST(f1.get() == c.end());
+    verify_vector(c, T(42), true);
+}
+
+template <typename T, typename DistPolicy>
+void replace_tests_with_policy(std::size_t size, std::size_t localities,
+    DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    replace_algo_tests_with_policy<T>(size, policy, seq);
+    replace_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    replace_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    replace_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void replace_tests()
+{
+    std::size_t const length = 12;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    replace_tests_with_policy<T>(length, 1, hpx::container_layout);
+    replace_tests_with_policy<T>(length, 3, hpx::container_layout(3));
+    replace_tests_with_policy<T>(length, 3,
+        hpx::container_layout(3, localities));
+    replace_tests_with_policy<T>(length, localities.size(),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    replace_tests<double>();
+    replace_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_sort.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v, int range)
+{
+    std::uniform_int_distribution<> dis(0, range - 1);
+
+    std::vector<T> values(v.size());
+    for (T& val : values)
+        val = T(dis(gen));
+
+    std::vector<std::size_t> positions(v.size());
+    std::iota(positions.begin(), positions.end(), std::size_t(0));
+
+    v.set_values(positions, values);
+    return values;
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    std::vector<std::size_t> positions(v.size());
+    std::iota(positions.begin(), positions.end(), std::size_t(0));
+
+    return v.get_values(hpx::launch::sync, positions);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_sort(ExPolicy && policy, hpx::partitioned_vector<T>& v, int range)
+{
+    std::vector<T> expected = fill_vector(v, range);
+    std::sort(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::sort(policy, v.begin(), v.end());
+    HPX_TEST(result == v.end());
+
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_async(ExPolicy && policy, hpx::partitioned_vector<T>& v,
+    int range)
+{
+    std::vector<T> expected = fill_vector(v, range);
+    std::sort(expected.begin(), expected.end(), std::greater<T>());
+
+    auto result = hpx::parallel::sort(policy, v.begin(), v.end(),
+        std::greater<T>());
+    HPX_TEST(result.get() == v.end());
+
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename T>
+void test_sort_range(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> expected = fill_vector(v, 1000);
+
+    // sort a range starting and ending in the middle of a partition
+    std::size_t const first = v.size() / 3;
+    std::size_t const last = v.size() - v.size() / 5;
+    std::sort(expected.begin() + first, expected.begin() + last);
+
+    hpx::parallel::sort(hpx::parallel::execution::par,
+        v.begin() + first, v.begin() + last);
+
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename T>
+void sort_tests(hpx::partitioned_vector<T>& v)
+{
+    using namespace hpx::parallel;
+
+    // few values result in many equivalent elements in each partition
+    for (int range : { 3, 1000, 1000000 })
+    {
+        test_sort(execution::seq, v, range);
+        test_sort(execution::par, v, range);
+
+        test_sort_async(execution::seq(execution::task), v, range);
+        test_sort_async(execution::par(execution::task), v, range);
+    }
+
+    test_sort_range(v);
+}
+
+template <typename T>
+void sort_tests(std::vector<hpx::id_type>& localities)
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(localities));
+        sort_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num,
+            hpx::container_layout(3 * localities.size(), localities));
+        sort_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    sort_tests<int>(localities);
+    sort_tests<double>(localities);
+    return hpx::util::report_errors();
+}
@@ -62,6 +62,31 @@ test_transform_reduce_async(ExPolicy && policy,
         );
 }
 
+template <typename ExPolicy, typename T>
+T test_transform_reduce_binary(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T> const& yvalues)
+{
+    return
+        hpx::parallel::transform_reduce(policy,
+            std::begin(xvalues), std::end(xvalues), std::begin(yvalues),
+            T(1)
+        );
+}
+
+template <typename ExPolicy, typename T>
+hpx::future<T>
+test_transform_reduce_binary_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T> const& yvalues)
+{
+    return
+        hpx::parallel::transform_reduce(policy,
+            std::begin(xvalues), std::end(xvalues), std::begin(yvalues),
+            T(1)
+        );
+}
+
 template <typename T>
 void transform_reduce_tests(std::size_t num,
     hpx::partitioned_vector<T> const& xvalues,
@@ -84,6 +109,26 @@ void transform_reduce_tests(std::size_t num,
             hpx::parallel::execution::par(hpx::parallel::execution::task),
             xvalues, yvalues).get(),
         T(num + 1));
+
+    HPX_TEST_EQ(
+        test_transform_reduce_binary(
+            hpx::parallel::execution::seq, xvalues, yvalues),
+        T(num + 1));
+    HPX_TEST_EQ(
+        test_transform_reduce_binary(
+            hpx::parallel::execution::par, xvalues, yvalues),
+        T(num + 1));
+
+    HPX_TEST_EQ(
+        test_transform_reduce_binary_async(
+            hpx::parallel::execution::seq(hpx::parallel::execution::task),
+            xvalues, yvalues).get(),
+        T(num + 1));
+    HPX_TEST_EQ(
+        test_transform_reduce_binary_async(
+            hpx::parallel::execution::par(hpx::parallel::execution::task),
+            xvalues, yvalues).get(),
+        T(num + 1));
 }
 
 template <typename T>
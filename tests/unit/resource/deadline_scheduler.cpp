@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Simple test verifying that the deadline scheduler executes threads in
+// earliest deadline first order and that it counts missed deadlines
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::vector<std::size_t> order;
+
+void work(std::size_t i)
+{
+    order.push_back(i);
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_tasks = 100;
+
+    // all threads are created before any of them can run (there is only one
+    // worker thread), create them in the order of decreasing deadline
+    {
+        std::vector<hpx::future<void> > futures;
+        futures.reserve(num_tasks);
+
+        auto now = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            hpx::parallel::execution::deadline_executor exec(
+                now + std::chrono::seconds(num_tasks - i));
+            futures.push_back(hpx::async(exec, &work, num_tasks - i - 1));
+        }
+
+        hpx::wait_all(futures);
+    }
+
+    HPX_TEST_EQ(order.size(), num_tasks);
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+
+    // a thread with an expired deadline is reported as such
+    hpx::threads::detail::thread_pool_base& pool =
+        hpx::resource::get_thread_pool("default");
+
+    std::size_t const all_threads = std::size_t(-1);
+    HPX_TEST_EQ(pool.get_num_missed_deadlines(all_threads, false), 0);
+
+    {
+        hpx::parallel::execution::deadline_executor exec(
+            std::chrono::steady_clock::now() - std::chrono::seconds(1));
+        hpx::async(exec, &work, num_tasks).get();
+    }
+
+    // the counter is updated once the thread has been cleaned up
+    hpx::util::high_resolution_timer t;
+    while (pool.get_num_missed_deadlines(all_threads, false) == 0 &&
+        t.elapsed() < 10.0)
+    {
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(pool.get_num_missed_deadlines(all_threads, false), 1);
+
+    return hpx::finalize();
+}
+
+// this test must be run with 1 thread
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.os_threads=1"
+    };
+
+    // create the resource partitioner
+    hpx::resource::partitioner rp(argc, argv, std::move(cfg));
+
+    rp.create_thread_pool("default",
+        hpx::resource::scheduling_policy::deadline);
+
+    // now run the test
+    HPX_TEST_EQ(hpx::init(), 0);
+    return hpx::util::report_errors();
+}
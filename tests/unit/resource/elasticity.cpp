@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elasticity controller suspends processing units of an idle
+// pool and resumes them once work is piling up.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/policies/scheduler_mode.hpp>
+#include <hpx/runtime/threads/policies/schedulers.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+void busy_wait(double seconds)
+{
+    hpx::util::high_resolution_timer t;
+    while (t.elapsed() < seconds) {}
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    hpx::threads::detail::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+
+    std::size_t const num_threads = tp.get_os_thread_count();
+    HPX_TEST_EQ(std::size_t(4), num_threads);
+
+    // an idle pool is shrunk down to the minimal number of threads
+    {
+        hpx::util::high_resolution_timer t;
+        while (tp.get_active_os_thread_count() != 1 && t.elapsed() < 10)
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), std::size_t(1));
+    }
+
+    // suspended processing units are resumed when work is piling up
+    {
+        std::size_t max_active = 0;
+
+        std::vector<hpx::future<void>> fs;
+        fs.reserve(num_threads * 500);
+        for (std::size_t i = 0; i != num_threads * 500; ++i)
+        {
+            fs.push_back(hpx::async(&busy_wait, 0.001));
+        }
+
+        hpx::util::high_resolution_timer t;
+        while (!std::all_of(fs.begin(), fs.end(),
+                   [](hpx::future<void> const& f) { return f.is_ready(); }) &&
+            t.elapsed() < 10)
+        {
+            std::size_t active = tp.get_active_os_thread_count();
+            if (active > max_active)
+                max_active = active;
+
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        hpx::wait_all(fs);
+
+        HPX_TEST_LT(std::size_t(1), max_active);
+    }
+
+    return hpx::finalize();
+}
+
+template <typename Scheduler>
+void test_scheduler(int argc, char* argv[])
+{
+    std::vector<std::string> cfg =
+    {
+        "hpx.os_threads=4",
+        "hpx.elasticity.enabled=1",
+        "hpx.elasticity.interval=10",
+        "hpx.elasticity.min_threads=1",
+        "hpx.elasticity.grow_intervals=1",
+        "hpx.elasticity.shrink_intervals=2"
+    };
+
+    hpx::resource::partitioner rp(argc, argv, std::move(cfg));
+
+    rp.create_thread_pool("default",
+        [](hpx::threads::policies::callback_notifier& notifier,
+            std::size_t num_threads, std::size_t thread_offset,
+            std::size_t pool_index, std::string const& pool_name)
+        -> std::unique_ptr<hpx::threads::detail::thread_pool_base>
+        {
+            typename Scheduler::init_parameter_type init(num_threads);
+            std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+            auto mode = hpx::threads::policies::scheduler_mode(
+                hpx::threads::policies::do_background_work |
+                hpx::threads::policies::reduce_thread_priority |
+                hpx::threads::policies::delay_exit |
+                hpx::threads::policies::enable_elasticity);
+
+            std::unique_ptr<hpx::threads::detail::thread_pool_base> pool(
+                new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                    std::move(scheduler), notifier, pool_index, pool_name, mode,
+                    thread_offset));
+
+            return pool;
+        });
+
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler<hpx::threads::policies::local_queue_scheduler<>>(argc, argv);
+    test_scheduler<hpx::threads::policies::local_priority_queue_scheduler<>>(argc,
+        argv);
+
+    return hpx::util::report_errors();
+}
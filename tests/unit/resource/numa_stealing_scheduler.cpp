@@ -0,0 +1,89 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Simple test verifying that the NUMA stealing scheduler executes all work
+// and that its per-level stealing counters are consistent
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    // do something which takes a bit of time to give others the chance to
+    // steal the remaining tasks
+    hpx::util::high_resolution_timer t;
+    while (t.elapsed() < 1e-4)
+        /**/;
+    ++count;
+}
+
+void spawn(std::size_t num_tasks)
+{
+    // all tasks are created on the same worker thread, the other worker
+    // threads have to steal them
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        futures.push_back(hpx::async(&work));
+
+    hpx::wait_all(futures);
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_tasks = 10000;
+
+    hpx::async(&spawn, num_tasks).get();
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    hpx::threads::detail::thread_pool_base& pool =
+        hpx::resource::get_thread_pool("default");
+
+    std::size_t const all_threads = std::size_t(-1);
+    std::int64_t stolen =
+        pool.get_num_stolen_from_l2(all_threads, false) +
+        pool.get_num_stolen_from_l3(all_threads, false) +
+        pool.get_num_stolen_from_numa_node(all_threads, false) +
+        pool.get_num_stolen_from_remote(all_threads, false);
+
+    // every stolen pending thread is accounted for at exactly one level
+    HPX_TEST_EQ(stolen, pool.get_num_stolen_to_pending(all_threads, false));
+#endif
+
+    return hpx::finalize();
+}
+
+// this test must be run with 4 threads
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.os_threads=4"
+    };
+
+    // create the resource partitioner
+    hpx::resource::partitioner rp(argc, argv, std::move(cfg));
+
+    rp.create_thread_pool("default",
+        hpx::resource::scheduling_policy::numa_stealing);
+
+    // now run the test
+    HPX_TEST_EQ(hpx::init(), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that thread stacks are recycled by the stack pool, also across OS
+// threads and after the cache of an exiting OS thread has been destroyed.
+
+#include <hpx/config.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+// every test uses its own stack size, i.e. its own stack pool
+std::size_t const reuse_stack_size = 7 * EXEC_PAGESIZE;
+std::size_t const thread_exit_stack_size = 9 * EXEC_PAGESIZE;
+std::size_t const late_release_stack_size = 11 * EXEC_PAGESIZE;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    std::int64_t pool_size = posix::get_stack_pool_size(false);
+    std::int64_t pool_hits = posix::get_stack_pool_hits(false);
+
+    void* stack = posix::alloc_stack(reuse_stack_size);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST_EQ(posix::get_stack_pool_size(false), pool_size + 1);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), pool_hits);
+
+    posix::free_stack(stack, reuse_stack_size);
+
+    // the released stack is reused by the same OS thread
+    HPX_TEST_EQ(posix::alloc_stack(reuse_stack_size), stack);
+    HPX_TEST_EQ(posix::get_stack_pool_size(false), pool_size + 1);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), pool_hits + 1);
+
+    posix::free_stack(stack, reuse_stack_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_thread_exit()
+{
+    std::vector<void*> stacks(10);
+
+    hpx::compat::thread t(
+        [&stacks]()
+        {
+            for (void*& stack : stacks)
+                stack = posix::alloc_stack(thread_exit_stack_size);
+            for (void* stack : stacks)
+                posix::free_stack(stack, thread_exit_stack_size);
+        });
+    t.join();
+
+    std::int64_t pool_size = posix::get_stack_pool_size(false);
+    std::int64_t pool_hits = posix::get_stack_pool_hits(false);
+
+    // the stacks cached by the exited OS thread have been handed back to the
+    // global pool
+    std::vector<void*> reused;
+    for (std::size_t i = 0; i != stacks.size(); ++i)
+    {
+        void* stack = posix::alloc_stack(thread_exit_stack_size);
+        HPX_TEST(std::find(stacks.begin(), stacks.end(), stack) !=
+            stacks.end());
+        reused.push_back(stack);
+    }
+
+    HPX_TEST_EQ(posix::get_stack_pool_size(false), pool_size);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false),
+        pool_hits + std::int64_t(stacks.size()));
+
+    for (void* stack : reused)
+        posix::free_stack(stack, thread_exit_stack_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// releases a stack while the thread_local objects of an exiting OS thread
+// are being destroyed
+struct release_on_exit
+{
+    ~release_on_exit()
+    {
+        if (stack_ != nullptr)
+            posix::free_stack(stack_, late_release_stack_size);
+    }
+
+    void* stack_ = nullptr;
+};
+
+void test_late_release()
+{
+    void* stack = nullptr;
+
+    hpx::compat::thread t(
+        [&stack]()
+        {
+            // construct this before the stack cache of this OS thread to
+            // have it destroyed after the cache
+            static thread_local release_on_exit release;
+
+            stack = posix::alloc_stack(late_release_stack_size);
+            release.stack_ = stack;
+        });
+    t.join();
+
+    std::int64_t pool_size = posix::get_stack_pool_size(false);
+
+    // the stack was released into the global pool
+    void* reused = posix::alloc_stack(late_release_stack_size);
+    HPX_TEST_EQ(reused, stack);
+    HPX_TEST_EQ(posix::get_stack_pool_size(false), pool_size);
+
+    posix::free_stack(reused, late_release_stack_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reuse();
+    test_thread_exit();
+    test_late_release();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that all work items created in bulk are executed, regardless of
+// their priority and of whether they have to run on a particular OS thread
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_work_nullary(std::size_t num_tasks)
+{
+    count = 0;
+    hpx::lcos::local::latch l(num_tasks + 1);
+
+    std::vector<hpx::util::unique_function_nonser<void()> > funcs;
+    funcs.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        funcs.push_back([&l]() { ++count; l.count_down(1); });
+    }
+
+    hpx::threads::register_work_nullary(funcs,
+        "test_register_work_nullary");
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::threads::thread_result_type work(hpx::lcos::local::latch& l,
+    std::size_t num_thread, hpx::threads::thread_state_ex_enum)
+{
+    if (num_thread != std::size_t(-1))
+    {
+        HPX_TEST_EQ(num_thread, hpx::get_worker_thread_num());
+    }
+
+    ++count;
+    l.count_down(1);
+
+    return hpx::threads::thread_result_type(hpx::threads::terminated, nullptr);
+}
+
+void test_register_work_plain(std::size_t num_tasks)
+{
+    count = 0;
+    hpx::lcos::local::latch l(num_tasks + 1);
+
+    hpx::threads::thread_priority const priorities[] =
+    {
+        hpx::threads::thread_priority_normal,
+        hpx::threads::thread_priority_high,
+        hpx::threads::thread_priority_low,
+        hpx::threads::thread_priority_default
+    };
+
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // every 7th thread is bound to a particular OS thread
+        std::size_t num_thread =
+            (i % 7 == 0) ? (i / 7) % num_os_threads : std::size_t(-1);
+
+        data.emplace_back(
+            hpx::util::bind(&work, std::ref(l), num_thread,
+                hpx::util::placeholders::_1),
+            "test_register_work_plain", 0, priorities[i % 4], num_thread);
+    }
+
+    hpx::threads::register_work_plain(data);
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_async_execute(std::size_t num_tasks)
+{
+    hpx::parallel::execution::parallel_executor exec;
+
+    std::vector<std::size_t> v(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        v[i] = i;
+
+    std::vector<hpx::future<std::size_t> > results =
+        hpx::parallel::execution::bulk_async_execute(exec,
+            [](std::size_t i) { return 2 * i; }, v);
+
+    HPX_TEST_EQ(results.size(), num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), 2 * i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    for (std::size_t num_tasks : { 1, 3, 100, 10000 })
+    {
+        test_register_work_nullary(num_tasks);
+        test_register_work_plain(num_tasks);
+        test_bulk_async_execute(num_tasks);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
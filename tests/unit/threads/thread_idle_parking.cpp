@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that idle worker threads are parked if hpx.idle_mode=park and that
+// they are reliably woken up again when new work arrives
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    ++count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> start_time(0);
+
+void record_start()
+{
+    start_time.store(hpx::util::high_resolution_clock::now());
+}
+
+// Enqueue a task for another (parked) worker thread through the staged
+// register_work path and return the time it took for the task to start
+// running. The current worker thread keeps spinning, so the task can only be
+// run if the target worker thread is woken up.
+std::uint64_t enqueue_to_start_latency(std::size_t num_thread)
+{
+    // give the other worker threads the chance to park
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    start_time.store(0);
+    std::uint64_t const enqueued = hpx::util::high_resolution_clock::now();
+
+    hpx::threads::register_work_nullary(&record_start, "record_start",
+        hpx::threads::pending, hpx::threads::thread_priority_normal,
+        num_thread);
+
+    // don't wait longer than 10s
+    std::uint64_t const timeout = 10000000000ull;
+    while (start_time.load() == 0 &&
+        hpx::util::high_resolution_clock::now() - enqueued < timeout)
+    {
+    }
+
+    HPX_TEST_NEQ(start_time.load(), std::uint64_t(0));
+    return start_time.load() - enqueued;
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    hpx::threads::detail::thread_pool_base& pool =
+        hpx::resource::get_thread_pool("default");
+
+    std::size_t const all_threads = std::size_t(-1);
+    std::size_t expected = 0;
+
+    for (int i = 0; i != 10; ++i)
+    {
+        // give the other worker threads the chance to park
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        std::vector<hpx::future<void> > futures;
+        for (int j = 0; j != 100; ++j)
+            futures.push_back(hpx::async(&work));
+
+        hpx::wait_all(futures);
+
+        expected += 100;
+        HPX_TEST_EQ(count.load(), expected);
+    }
+
+    HPX_TEST_LT(std::int64_t(0), pool.get_num_parks(all_threads, false));
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    if (num_threads > 1)
+    {
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        std::int64_t const unparks = pool.get_num_unparks(all_threads, false);
+
+        for (int i = 0; i != 10; ++i)
+        {
+            // the worker threads are parked for up to one second (see below),
+            // waking them up has to be much faster than that
+            std::uint64_t latency = enqueue_to_start_latency(
+                (num_thread + 1 + i % (num_threads - 1)) % num_threads);
+            HPX_TEST_LT(latency, std::uint64_t(100000000));
+        }
+
+        HPX_TEST_LT(unparks, pool.get_num_unparks(all_threads, false));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.idle_mode=park",
+        "hpx.max_idle_loop_count=1000",
+        "hpx.max_park_duration=1000000"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/parallel/executors/default_executor.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> count(0);
+
+int test_nostack(int i)
+{
+    HPX_TEST(hpx::threads::get_self_ptr());
+    HPX_TEST(hpx::threads::get_ctx_ptr()->is_stackless());
+    HPX_TEST_EQ(hpx::threads::get_self_stacksize(),
+        std::size_t(hpx::get_runtime().get_config().get_stack_size(
+            hpx::threads::thread_stacksize_nostack)));
+
+    ++count;
+    return i;
+}
+
+void test_nostack_suspend()
+{
+    HPX_TEST(hpx::threads::get_ctx_ptr()->is_stackless());
+
+    // suspending a stackless thread is rejected
+    bool caught_exception = false;
+    try {
+        hpx::this_thread::suspend();
+    }
+    catch (hpx::exception const& e) {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // the error can be reported through an error_code as well
+    hpx::error_code ec(hpx::lightweight);
+    hpx::this_thread::suspend(hpx::threads::pending, "suspend", ec);
+    HPX_TEST(ec);
+}
+
+bool is_stackless_child()
+{
+    // threads created by a stackless thread are able to suspend
+    HPX_TEST(!hpx::threads::get_ctx_ptr()->is_stackless());
+    HPX_TEST_NEQ(hpx::threads::get_self_stacksize(),
+        std::size_t(HPX_NOSTACK_STACK_SIZE));
+
+    hpx::this_thread::yield();
+    return hpx::threads::get_ctx_ptr()->is_stackless();
+}
+
+hpx::future<bool> test_nostack_fork()
+{
+    HPX_TEST(hpx::threads::get_ctx_ptr()->is_stackless());
+
+    // the stack size is not inherited from a stackless thread
+    HPX_TEST_EQ(hpx::threads::get_stack_size(
+        hpx::threads::thread_stacksize_current),
+        hpx::threads::get_default_stack_size());
+
+    // forking must not yield to the new thread
+    return hpx::async(hpx::launch::fork, &is_stackless_child);
+}
+
+hpx::future<int> test_nostack_continuation()
+{
+    HPX_TEST(hpx::threads::get_ctx_ptr()->is_stackless());
+
+    hpx::lcos::local::promise<int> p;
+    hpx::future<int> f = p.get_future().then(hpx::launch::fork,
+        [](hpx::future<int> && f) -> int
+        {
+            HPX_TEST(!is_stackless_child());
+            return f.get() + 1;
+        });
+
+    // the continuation is scheduled from this stackless thread
+    p.set_value(41);
+    return f;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    hpx::parallel::execution::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    {
+        std::vector<hpx::future<int> > futures;
+        for (int i = 0; i != 100; ++i)
+            futures.push_back(hpx::async(exec, &test_nostack, i));
+
+        for (int i = 0; i != 100; ++i)
+            HPX_TEST_EQ(futures[i].get(), i);
+
+        HPX_TEST_EQ(count.load(), std::size_t(100));
+    }
+
+    {
+        hpx::future<void> f = hpx::async(exec, &test_nostack_suspend);
+        f.get();
+    }
+
+    {
+        hpx::future<hpx::future<bool> > f =
+            hpx::async(exec, &test_nostack_fork);
+        HPX_TEST(!f.get().get());
+    }
+
+    {
+        hpx::future<hpx::future<int> > f =
+            hpx::async(exec, &test_nostack_continuation);
+        HPX_TEST_EQ(f.get().get(), 42);
+    }
+
+    HPX_TEST_EQ(std::string(hpx::threads::get_stack_size_name(
+        hpx::get_runtime().get_config().get_stack_size(
+            hpx::threads::thread_stacksize_nostack))), std::string("nostack"));
+
+    return hpx::util::report_errors();
+}
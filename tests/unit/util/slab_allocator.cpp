@@ -0,0 +1,136 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/slab_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_local_reuse()
+{
+    std::int64_t allocations = hpx::util::get_slab_allocations(false);
+
+    void* p = hpx::util::slab_allocate(100);
+    HPX_TEST(p != nullptr);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+        alignof(std::max_align_t), std::uintptr_t(0));
+    hpx::util::slab_deallocate(p);
+
+    // the block is reused by the thread which released it
+    void* q = hpx::util::slab_allocate(100);
+    HPX_TEST_EQ(p, q);
+    hpx::util::slab_deallocate(q);
+
+    // other worker threads may allocate concurrently
+    HPX_TEST_LTE(allocations + 2, hpx::util::get_slab_allocations(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_deallocation()
+{
+    std::int64_t remote =
+        hpx::util::get_slab_remote_deallocations(false);
+
+    void* p = hpx::util::slab_allocate(200);
+    std::memset(p, 0xcd, 200);
+
+    // release the block on a different OS thread
+    hpx::compat::thread t([p]() { hpx::util::slab_deallocate(p); });
+    t.join();
+
+    HPX_TEST_LTE(remote + 1, hpx::util::get_slab_remote_deallocations(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deallocation_after_thread_exit()
+{
+    std::int64_t remote =
+        hpx::util::get_slab_remote_deallocations(false);
+
+    void* p = nullptr;
+    hpx::compat::thread t1([&p]() { p = hpx::util::slab_allocate(300); });
+    t1.join();
+
+    // the thread which allocated the block has exited already
+    HPX_TEST(p != nullptr);
+    std::memset(p, 0xcd, 300);
+    hpx::util::slab_deallocate(p);
+
+    HPX_TEST_LTE(remote + 1, hpx::util::get_slab_remote_deallocations(false));
+
+    // the cache of the exited thread is taken over by new threads
+    hpx::compat::thread t2(
+        []()
+        {
+            for (int i = 0; i != 1000; ++i)
+            {
+                void* q = hpx::util::slab_allocate(300);
+                std::memset(q, 0xcd, 300);
+                hpx::util::slab_deallocate(q);
+            }
+        });
+    t2.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_large_allocation()
+{
+    std::int64_t heap = hpx::util::get_slab_heap_allocations(false);
+
+    // blocks larger than the biggest size class come from the global heap
+    std::size_t const size = 64 * 1024;
+    void* p = hpx::util::slab_allocate(size);
+    HPX_TEST(p != nullptr);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+        alignof(std::max_align_t), std::uintptr_t(0));
+    std::memset(p, 0xcd, size);
+    hpx::util::slab_deallocate(p);
+
+    HPX_TEST_LTE(heap + 1, hpx::util::get_slab_heap_allocations(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+struct alignas(4 * alignof(std::max_align_t)) overaligned
+{
+    int value;
+};
+
+void test_overaligned_shared_state()
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        hpx::lcos::local::promise<overaligned> p;
+        hpx::shared_future<overaligned> f = p.get_future();
+        p.set_value(overaligned{i});
+
+        // the result is stored inside the shared state
+        overaligned const& result = f.get();
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(&result) %
+            alignof(overaligned), std::uintptr_t(0));
+        HPX_TEST_EQ(result.value, i);
+    }
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_local_reuse();
+    test_remote_deallocation();
+    test_deallocation_after_thread_exit();
+    test_large_allocation();
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+    test_overaligned_shared_state();
+#endif
+
+    return hpx::util::report_errors();
+}